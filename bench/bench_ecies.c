@@ -0,0 +1,471 @@
+// bench_ecies: cycles/op and ops/sec for every primitive, as JSON.
+//
+//   bench_ecies [--samples N] [--filter SUBSTRING] [--out FILE]
+//
+// Each benchmark is warmed up, then timed as N samples of a fixed batch of
+// operations (the batch is sized so one sample takes about SAMPLE_NS). The
+// per-op cost of every sample is kept and reported as min / median / p90 /
+// p99, so one noisy sample cannot move the headline (median) number.
+//
+// Built with ECIES_STATS, each result also carries the operation counts per
+// op and per-stage latencies recorded by the library's instrumentation.
+//
+// Cycles come from the TSC on x86 (reference cycles: constant rate, not
+// scaled by turbo) and from the nanosecond clock elsewhere.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bigint.h"
+#include "ec.h"
+#include "aes.h"
+#include "sha256.h"
+#include "ecies.h"
+#include "ecies_stats.h"
+#include "cpu.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC 1
+#endif
+
+#define BENCH_VERSION    1
+#define SAMPLES_DEFAULT  31
+#define SAMPLES_MAX      1001
+#define SAMPLE_NS        2000000ull    // Target duration of one sample
+#define WARMUP_NS        50000000ull   // Spin before the batch size is fixed
+
+// --- TIMING ---
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t now_ticks(void) {
+#ifdef BENCH_TSC
+    _mm_lfence();   // Keep earlier work from drifting past the read
+    uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    return now_ns();
+#endif
+}
+
+// Opaque use of p: the compiler must assume the pointed-to result is read
+static inline void bench_clobber(const void *p) {
+    __asm__ volatile("" : : "r"(p) : "memory");
+}
+
+// --- BENCHMARK CASES ---
+
+typedef struct {
+    const char *name;
+    size_t bytes;                                // Payload per op (0 if not a throughput case)
+    void (*run)(void *state, size_t iters);
+    void *state;
+} bench_case_t;
+
+typedef struct {
+    bigint256_t a, b, r;
+    bigint512_t wide;
+    ec_point_t p, q, pr;
+    bigint256_t k;
+} bench_math_t;
+
+typedef struct {
+    aes_ctx_t aes;
+    sha256_ctx_t sha;
+    uint8_t nonce[16];
+    uint8_t *buf;
+} bench_sym_t;
+
+typedef struct {
+    ec_point_t pub;
+    bigint256_t priv;
+    size_t len;
+    uint8_t *plain, *cipher;     // cipher holds one encryption of plain
+    size_t cipher_len;
+} bench_ecies_t;
+
+// BATCH_MSGS small messages to one key, each with its own ephemeral R
+#define BATCH_MSGS 64
+
+typedef struct {
+    const bigint256_t *priv;
+    ecies_msg_t msgs[BATCH_MSGS];
+    ecies_out_t out[BATCH_MSGS];
+    uint8_t *store;
+} bench_batch_t;
+
+static void run_bigint_mul(void *s, size_t n) {
+    bench_math_t *m = s;
+    for (size_t i = 0; i < n; i++) {
+        bigint_mul(&m->wide, &m->a, &m->b);
+        bench_clobber(&m->wide);
+    }
+}
+
+static void run_bigint_mod_p(void *s, size_t n) {
+    bench_math_t *m = s;
+    for (size_t i = 0; i < n; i++) {
+        bigint_mod_p(&m->r, &m->wide);
+        bench_clobber(&m->r);
+    }
+}
+
+static void run_bigint_inv_mod_p(void *s, size_t n) {
+    bench_math_t *m = s;
+    for (size_t i = 0; i < n; i++) {
+        bigint_inv_mod_p(&m->r, &m->a);
+        bench_clobber(&m->r);
+    }
+}
+
+static void run_ec_double(void *s, size_t n) {
+    bench_math_t *m = s;
+    for (size_t i = 0; i < n; i++) {
+        ec_double(&m->pr, &m->p);
+        bench_clobber(&m->pr);
+    }
+}
+
+static void run_ec_add(void *s, size_t n) {
+    bench_math_t *m = s;
+    for (size_t i = 0; i < n; i++) {
+        ec_add(&m->pr, &m->p, &m->q);
+        bench_clobber(&m->pr);
+    }
+}
+
+static void run_ec_mul(void *s, size_t n) {
+    bench_math_t *m = s;
+    for (size_t i = 0; i < n; i++) {
+        ec_mul(&m->pr, &m->k, &m->p);
+        bench_clobber(&m->pr);
+    }
+}
+
+static void run_ec_mul_g(void *s, size_t n) {
+    bench_math_t *m = s;
+    for (size_t i = 0; i < n; i++) {
+        ec_mul_g(&m->pr, &m->k);
+        bench_clobber(&m->pr);
+    }
+}
+
+static void run_aes_encrypt_block(void *s, size_t n) {
+    bench_sym_t *c = s;
+    for (size_t i = 0; i < n; i++) {
+        aes_encrypt_block(&c->aes, c->buf, c->buf);   // Chained: measures latency
+        bench_clobber(c->buf);
+    }
+}
+
+static void run_aes_ctr(void *s, size_t n, size_t len) {
+    bench_sym_t *c = s;
+    for (size_t i = 0; i < n; i++) {
+        aes_ctr_encrypt(&c->aes, c->nonce, c->buf, len);
+        bench_clobber(c->buf);
+    }
+}
+
+static void run_sha256(void *s, size_t n, size_t len) {
+    bench_sym_t *c = s;
+    for (size_t i = 0; i < n; i++) {
+        sha256_update(&c->sha, c->buf, len);
+        bench_clobber(&c->sha);
+    }
+}
+
+#define AES_CTR_RUNNER(len) static void run_aes_ctr_##len(void *s, size_t n) { run_aes_ctr(s, n, len); }
+#define SHA256_RUNNER(len)  static void run_sha256_##len(void *s, size_t n) { run_sha256(s, n, len); }
+AES_CTR_RUNNER(16)
+AES_CTR_RUNNER(64)
+AES_CTR_RUNNER(1024)
+AES_CTR_RUNNER(16384)
+AES_CTR_RUNNER(1048576)
+SHA256_RUNNER(64)
+SHA256_RUNNER(1024)
+SHA256_RUNNER(16384)
+SHA256_RUNNER(1048576)
+#undef AES_CTR_RUNNER
+#undef SHA256_RUNNER
+
+static void run_ecies_encrypt(void *s, size_t n) {
+    bench_ecies_t *e = s;
+    for (size_t i = 0; i < n; i++) {
+        ecies_stream_t st;
+        size_t a, b;
+        uint8_t *out = e->cipher;
+        if (!ecies_encrypt_init(&st, &e->pub, 0, out)) abort();
+        out += ECIES_HEADER_SIZE;
+        if (!ecies_encrypt_update(&st, e->plain, e->len, out, &a) ||
+            !ecies_encrypt_final(&st, out + a, &b))
+            abort();
+        ecies_stream_free(&st);
+        bench_clobber(e->cipher);
+    }
+}
+
+static void run_ecies_decrypt(void *s, size_t n) {
+    bench_ecies_t *e = s;
+    for (size_t i = 0; i < n; i++) {
+        ecies_stream_t st;
+        size_t a, b;
+        if (!ecies_decrypt_init(&st, &e->priv, e->cipher) ||
+            !ecies_decrypt_update(&st, e->cipher + ECIES_HEADER_SIZE, e->cipher_len - ECIES_HEADER_SIZE, e->plain, &a) ||
+            !ecies_decrypt_final(&st, e->plain + a, &b))
+            abort();
+        ecies_stream_free(&st);
+        bench_clobber(e->plain);
+    }
+}
+
+static void run_ecies_decrypt_batch(void *s, size_t n) {
+    bench_batch_t *b = s;
+    for (size_t i = 0; i < n; i++) {
+        if (ecies_decrypt_batch(b->priv, b->msgs, BATCH_MSGS, b->out, NULL) != BATCH_MSGS) abort();
+        bench_clobber(b->out);
+    }
+}
+
+// --- STATISTICS ---
+
+typedef struct {
+    double min, median, p90, p99, mean;
+} bench_dist_t;
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted v
+static double percentile(const double *v, size_t n, double pct) {
+    size_t rank = (size_t)(pct / 100.0 * (double)n + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return v[rank - 1];
+}
+
+static bench_dist_t summarize(double *v, size_t n) {
+    bench_dist_t d;
+    double sum = 0;
+    qsort(v, n, sizeof(*v), cmp_double);
+    for (size_t i = 0; i < n; i++) sum += v[i];
+    d.min = v[0];
+    d.median = n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+    d.p90 = percentile(v, n, 90);
+    d.p99 = percentile(v, n, 99);
+    d.mean = sum / (double)n;
+    return d;
+}
+
+static void print_dist(FILE *f, const char *key, const bench_dist_t *d) {
+    fprintf(f, "\"%s\": {\"min\": %.2f, \"median\": %.2f, \"p90\": %.2f, \"p99\": %.2f, \"mean\": %.2f}",
+            key, d->min, d->median, d->p90, d->p99, d->mean);
+}
+
+#ifdef ECIES_STATS
+// Library counters for the timed samples: operations per op and stage latencies
+static void print_stats(FILE *f, size_t ops) {
+    ecies_stats_t st;
+    ecies_stats_snapshot(&st);
+
+    fprintf(f, ",\n     \"counts_per_op\": {");
+    for (int i = 0, n = 0; i < ECIES_STAT_COUNT; i++) {
+        if (!st.ops[i]) continue;
+        fprintf(f, "%s\"%s\": %.2f", n++ ? ", " : "", ecies_stat_name(i), (double)st.ops[i] / (double)ops);
+    }
+    fprintf(f, "}");
+
+    fprintf(f, ",\n     \"stages\": {");
+    for (int i = 0, n = 0; i < ECIES_STAGE_COUNT; i++) {
+        const ecies_stage_stats_t *sg = &st.stages[i];
+        if (!sg->count) continue;
+        fprintf(f, "%s\"%s\": {\"count\": %llu, \"mean_ticks\": %.1f, \"p50_ticks_le\": %llu, \"p99_ticks_le\": %llu, \"max_ticks\": %llu}",
+                n++ ? ", " : "", ecies_stage_name(i), (unsigned long long)sg->count,
+                (double)sg->total_ticks / (double)sg->count,
+                (unsigned long long)ecies_stats_percentile(sg, 50), (unsigned long long)ecies_stats_percentile(sg, 99),
+                (unsigned long long)sg->max_ticks);
+    }
+    fprintf(f, "}");
+}
+#endif
+
+// --- DRIVER ---
+
+static void run_case(FILE *f, const bench_case_t *c, size_t samples, int first) {
+    static double cyc[SAMPLES_MAX], ns[SAMPLES_MAX];
+
+    // Warm caches, branch predictors and clocks; grow the batch while doing it
+    size_t iters = 1;
+    uint64_t start = now_ns(), t;
+    for (;;) {
+        uint64_t t0 = now_ns();
+        c->run(c->state, iters);
+        t = now_ns() - t0;
+        if (t < SAMPLE_NS / 2) iters *= 2;
+        if (now_ns() - start >= WARMUP_NS && t >= SAMPLE_NS / 2) break;
+    }
+
+    ecies_stats_reset();
+    for (size_t i = 0; i < samples; i++) {
+        uint64_t n0 = now_ns(), c0 = now_ticks();
+        c->run(c->state, iters);
+        uint64_t c1 = now_ticks(), n1 = now_ns();
+        cyc[i] = (double)(c1 - c0) / (double)iters;
+        ns[i] = (double)(n1 - n0) / (double)iters;
+    }
+
+    bench_dist_t dc = summarize(cyc, samples), dn = summarize(ns, samples);
+    fprintf(f, "%s\n    {\"name\": \"%s\", \"bytes\": %zu, \"samples\": %zu, \"iters_per_sample\": %zu,\n     ",
+            first ? "" : ",", c->name, c->bytes, samples, iters);
+    print_dist(f, "cycles_per_op", &dc);
+    fprintf(f, ",\n     ");
+    print_dist(f, "ns_per_op", &dn);
+    fprintf(f, ",\n     \"ops_per_sec\": %.1f", 1e9 / dn.median);
+    if (c->bytes) {
+        fprintf(f, ", \"cycles_per_byte\": %.3f, \"mb_per_sec\": %.1f",
+                dc.median / (double)c->bytes, (double)c->bytes * 1e3 / dn.median);
+    }
+#ifdef ECIES_STATS
+    print_stats(f, samples * iters);
+#endif
+    fprintf(f, "}");
+    fflush(f);
+}
+
+// Ticks per nanosecond, so cycle counts can be cross-checked against wall time
+static double tick_rate(void) {
+    uint64_t n0 = now_ns(), c0 = now_ticks();
+    while (now_ns() - n0 < 50000000ull) {}
+    return (double)(now_ticks() - c0) / (double)(now_ns() - n0);
+}
+
+static void random_scalar(bigint256_t *k) {
+    uint8_t raw[32];
+    if (!ecies_random(raw, sizeof(raw))) abort();
+    raw[0] &= 0x7f;   // Below n
+    bigint_set_bytes(k, raw);
+}
+
+int main(int argc, char **argv) {
+    size_t samples = SAMPLES_DEFAULT;
+    const char *filter = NULL, *out_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) samples = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) filter = argv[++i];
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) out_path = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [--samples N] [--filter SUBSTRING] [--out FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (samples < 1) samples = 1;
+    if (samples > SAMPLES_MAX) samples = SAMPLES_MAX;
+
+    FILE *f = out_path ? fopen(out_path, "w") : stdout;
+    if (!f) {
+        perror(out_path);
+        return 1;
+    }
+
+    // --- FIXTURES ---
+    static bench_math_t math;
+    ec_point_t g;
+    ec_init_g(&g);
+    random_scalar(&math.a);
+    random_scalar(&math.b);
+    random_scalar(&math.k);
+    bigint_mul(&math.wide, &math.a, &math.b);
+    ec_mul_g(&math.p, &math.a);
+    ec_mul_g(&math.q, &math.b);
+
+    static bench_sym_t sym;
+    uint8_t key[32];
+    ecies_random(key, sizeof(key));
+    aes_setkey(&sym.aes, key, sizeof(key));
+    sha256_init(&sym.sha);
+    sym.buf = calloc(1, 1 << 20);
+
+    static bench_ecies_t ec_small, ec_large;
+    bench_ecies_t *ecs[2] = {&ec_small, &ec_large};
+    size_t ec_lens[2] = {64, 1 << 20};
+    for (int i = 0; i < 2; i++) {
+        bench_ecies_t *e = ecs[i];
+        ecies_keygen(&e->priv, &e->pub);
+        e->len = ec_lens[i];
+        e->plain = calloc(1, e->len + ECIES_CHUNK_DEFAULT);
+        e->cipher_len = (size_t)ecies_ciphertext_size(e->len, ECIES_CHUNK_DEFAULT);
+        e->cipher = malloc(e->cipher_len);
+        if (!sym.buf || !e->plain || !e->cipher) return 1;
+        run_ecies_encrypt(e, 1);
+    }
+
+    static bench_batch_t batch;
+    batch.priv = &ec_small.priv;
+    batch.store = malloc(BATCH_MSGS * 2 * ec_small.cipher_len);
+    if (!batch.store) return 1;
+    for (int i = 0; i < BATCH_MSGS; i++) {
+        uint8_t *msg = batch.store + 2 * i * ec_small.cipher_len;
+        run_ecies_encrypt(&ec_small, 1);
+        memcpy(msg, ec_small.cipher, ec_small.cipher_len);
+        batch.msgs[i].data = msg;
+        batch.msgs[i].len = ec_small.cipher_len;
+        batch.out[i].data = msg + ec_small.cipher_len;
+    }
+
+    const bench_case_t cases[] = {
+        {"bigint_mul", 0, run_bigint_mul, &math},
+        {"bigint_mod_p", 0, run_bigint_mod_p, &math},
+        {"bigint_inv_mod_p", 0, run_bigint_inv_mod_p, &math},
+        {"ec_double", 0, run_ec_double, &math},
+        {"ec_add", 0, run_ec_add, &math},
+        {"ec_mul", 0, run_ec_mul, &math},
+        {"ec_mul_g", 0, run_ec_mul_g, &math},
+        {"aes_encrypt_block", 16, run_aes_encrypt_block, &sym},
+        {"aes_ctr_encrypt/16", 16, run_aes_ctr_16, &sym},
+        {"aes_ctr_encrypt/64", 64, run_aes_ctr_64, &sym},
+        {"aes_ctr_encrypt/1024", 1024, run_aes_ctr_1024, &sym},
+        {"aes_ctr_encrypt/16384", 16384, run_aes_ctr_16384, &sym},
+        {"aes_ctr_encrypt/1048576", 1048576, run_aes_ctr_1048576, &sym},
+        {"sha256_update/64", 64, run_sha256_64, &sym},
+        {"sha256_update/1024", 1024, run_sha256_1024, &sym},
+        {"sha256_update/16384", 16384, run_sha256_16384, &sym},
+        {"sha256_update/1048576", 1048576, run_sha256_1048576, &sym},
+        {"ecies_encrypt/64", 64, run_ecies_encrypt, &ec_small},
+        {"ecies_decrypt/64", 64, run_ecies_decrypt, &ec_small},
+        {"ecies_decrypt_batch/64x64", 64 * BATCH_MSGS, run_ecies_decrypt_batch, &batch},
+        {"ecies_encrypt/1048576", 1048576, run_ecies_encrypt, &ec_large},
+        {"ecies_decrypt/1048576", 1048576, run_ecies_decrypt, &ec_large},
+    };
+
+    fprintf(f, "{\n  \"version\": %d,\n", BENCH_VERSION);
+#ifdef BENCH_TSC
+    fprintf(f, "  \"timer\": \"rdtsc\", \"ticks_per_ns\": %.4f,\n", tick_rate());
+#else
+    fprintf(f, "  \"timer\": \"clock_monotonic\", \"ticks_per_ns\": %.4f,\n", tick_rate());
+#endif
+    fprintf(f, "  \"cpu_features\": \"0x%x\",\n  \"results\": [", cpu_features());
+
+    int first = 1;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (filter && !strstr(cases[i].name, filter)) continue;
+        run_case(f, &cases[i], samples, first);
+        first = 0;
+    }
+    fprintf(f, "\n  ]\n}\n");
+
+    if (out_path) fclose(f);
+    free(batch.store);
+    for (int i = 0; i < 2; i++) {
+        free(ecs[i]->plain);
+        free(ecs[i]->cipher);
+    }
+    free(sym.buf);
+    return 0;
+}
\ No newline at end of file
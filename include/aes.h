@@ -3,16 +3,106 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
+#include "threadpool.h"
 
-// AES-128 Context
+// CTR implementations (see aes_set_impl)
+typedef enum {
+    AES_IMPL_AUTO = 0,   // AES-NI if available, else bitsliced
+    AES_IMPL_TABLE,      // T-tables: fast, but lookups depend on key and data (cache timing)
+    AES_IMPL_BITSLICED,  // Constant time, 8 blocks per call, no CPU requirements
+    AES_IMPL_AESNI       // Hardware AES (x86 with AES-NI and SSE4.1)
+} aes_impl_t;
+
+#define AES_MAX_ROUNDS    14
+#define AES_BS_SKEY_WORDS (8 * (AES_MAX_ROUNDS + 1))
+
+// AES Context: the key size (128, 192 or 256 bits) is picked by aes_setkey
 typedef struct {
-    uint32_t round_keys[44]; // 11 round keys * 4 words
+    uint32_t round_keys[4 * (AES_MAX_ROUNDS + 1)]; // (nr + 1) round keys * 4 words
+    int nr;                                        // Rounds: 10, 12 or 14
+    aes_impl_t impl;                               // CTR backend, AES_IMPL_AUTO after setkey
+    uint64_t bs_skey[AES_BS_SKEY_WORDS];           // Round keys prepared for the bitsliced backend
 } aes_ctx_t;
 
-void aes_init(aes_ctx_t *ctx, const uint8_t *key);
-void aes_encrypt_block(aes_ctx_t *ctx, const uint8_t *in, uint8_t *out);
+// Expand a 16, 24 or 32-byte key. Returns 0 (ctx unchanged) for any other length.
+int aes_setkey(aes_ctx_t *ctx, const uint8_t *key, size_t key_len);
+void aes_init(aes_ctx_t *ctx, const uint8_t *key);   // AES-128: aes_setkey(ctx, key, 16)
+void aes_encrypt_block(const aes_ctx_t *ctx, const uint8_t *in, uint8_t *out);
+
+// A context is fully prepared by aes_setkey and holds no pointers, so it can
+// be copied to reuse the schedule across messages of a session
+void aes_ctx_clone(aes_ctx_t *dst, const aes_ctx_t *src);
 
-// CTR Mode: Encrypts buffer in place
+// Pick the CTR backend for this context. Returns 0 (ctx unchanged) if the CPU lacks it.
+int aes_set_impl(aes_ctx_t *ctx, aes_impl_t impl);
+
+// CTR Mode: Encrypts buffer in place with the context's backend
 void aes_ctr_encrypt(aes_ctx_t *ctx, uint8_t *nonce, uint8_t *buf, size_t len);
 
+// Seekable CTR: XOR the keystream bytes [offset, offset + len) into buf.
+// Any byte range of a stream can be (de)crypted on its own; aes_ctr_encrypt
+// is offset 0. The 32-bit block counter wraps past 64 GiB per nonce.
+void aes_ctr_xor(const aes_ctx_t *ctx, const uint8_t *nonce, uint64_t offset, uint8_t *buf, size_t len);
+
+// Bulk CTR: as aes_ctr_xor, split by counter range across the pool (NULL = this thread)
+#define AES_CTR_MIN_CHUNK (64 * 1024)
+void aes_ctr_xor_parallel(const aes_ctx_t *ctx, const uint8_t *nonce, uint64_t offset, uint8_t *buf, size_t len, threadpool_t *pool);
+
+// --- GCM ---
+// AEAD over the context's cipher: CTR from counter 2 with a GHASH tag, in one pass.
+// Uses AES-NI + PCLMULQDQ when the context's backend allows AES-NI, otherwise
+// the context's CTR backend with a 4-bit table GHASH (table lookups depend on
+// the data, so that path is not cache-timing safe).
+#define AES_GCM_IV_SIZE  12
+#define AES_GCM_TAG_SIZE 16
+
+typedef struct {
+    aes_ctx_t aes;
+    uint64_t hl[16], hh[16];  // Multiples of H by every 4-bit value (Shoup's table)
+    uint8_t hpow[8][16];      // H^1..H^8 for the carry-less path
+} aes_gcm_ctx_t;
+
+void aes_gcm_init(aes_gcm_ctx_t *gcm, const aes_ctx_t *aes);
+
+// Encrypt buf in place and write the tag
+void aes_gcm_encrypt(const aes_gcm_ctx_t *gcm, const uint8_t iv[AES_GCM_IV_SIZE], const uint8_t *aad, size_t aad_len,
+                     uint8_t *buf, size_t len, uint8_t tag[AES_GCM_TAG_SIZE]);
+
+// Decrypt buf in place. Returns 0 and zeroes buf if the tag does not match.
+int aes_gcm_decrypt(const aes_gcm_ctx_t *gcm, const uint8_t iv[AES_GCM_IV_SIZE], const uint8_t *aad, size_t aad_len,
+                    uint8_t *buf, size_t len, const uint8_t tag[AES_GCM_TAG_SIZE]);
+
+// --- BACKENDS ---
+// dst ^= src, eight bytes at a time (the compiler vectorizes the word loop)
+static inline void aes_xor_bytes(uint8_t *dst, const uint8_t *src, size_t len) {
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t a, b;
+        memcpy(&a, dst + i, 8);
+        memcpy(&b, src + i, 8);
+        a ^= b;
+        memcpy(dst + i, &a, 8);
+    }
+    for (; i < len; i++) dst[i] ^= src[i];
+}
+
+// XOR the CTR keystream into buf, starting at block counter `counter`
+// (12-byte nonce || 32-bit big-endian counter, as aes_ctr_encrypt).
+void aes_ctr_xor_table(const aes_ctx_t *ctx, const uint8_t *nonce, uint32_t counter, uint8_t *buf, size_t len);
+void aes_ctr_xor_bitsliced(const aes_ctx_t *ctx, const uint8_t *nonce, uint32_t counter, uint8_t *buf, size_t len);
+
+// Bitsliced core: round keys in bitsliced form (done by aes_setkey), then 8 blocks encrypted in place
+void aes_bs_key_schedule(uint64_t skey[AES_BS_SKEY_WORDS], const aes_ctx_t *ctx);
+void aes_bs_encrypt8(const uint64_t skey[AES_BS_SKEY_WORDS], int nr, uint8_t blocks[128]);
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AES_NI_AVAILABLE 1
+void aes_ctr_xor_aesni(const aes_ctx_t *ctx, const uint8_t *nonce, uint32_t counter, uint8_t *buf, size_t len); // Needs CPU_AESNI | CPU_SSE41
+
+// Fused GCM data pass: CTR from counter 2 and GHASH of the ciphertext into y,
+// 8 blocks per reduction. Needs CPU_AESNI | CPU_SSE41 | CPU_PCLMUL
+void aes_gcm_crypt_clmul(const aes_gcm_ctx_t *gcm, const uint8_t *iv, uint8_t y[16], uint8_t *buf, size_t len, int decrypt);
+#endif
+
 #endif
\ No newline at end of file
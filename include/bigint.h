@@ -19,8 +19,10 @@ typedef struct {
 } bigint512_t;
 
 void bigint_set_hex(bigint256_t *dest, const char *hex_str);
+void bigint_set_bytes(bigint256_t *dest, const uint8_t in[32]);   // Big-endian
 void bigint_print(const bigint256_t *src);
 void bigint_print_512(const bigint512_t *src);
+void bigint_get_bytes(uint8_t out[32], const bigint256_t *src);   // Big-endian
 
 limb_t bigint_add(bigint256_t *res, const bigint256_t *a, const bigint256_t *b);
 limb_t bigint_sub(bigint256_t *res, const bigint256_t *a, const bigint256_t *b);
@@ -29,4 +31,16 @@ void bigint_mul(bigint512_t *res, const bigint256_t *a, const bigint256_t *b);
 void bigint_mod_p(bigint256_t *dest, const bigint512_t *src);
 void bigint_inv_mod_p(bigint256_t *dest, const bigint256_t *src);
 
+// Modular inverse mod the group order n (constant time, 0 maps to 0)
+void bigint_inv_mod_n(bigint256_t *dest, const bigint256_t *src);
+
+// Scalar arithmetic mod the group order n (constant time)
+void bigint_mod_n(bigint256_t *dest, const bigint512_t *src);
+void bigint_add_mod_n(bigint256_t *res, const bigint256_t *a, const bigint256_t *b);   // a, b < n
+void bigint_neg_mod_n(bigint256_t *res, const bigint256_t *a);                         // a < n
+void bigint_mul_mod_n(bigint256_t *res, const bigint256_t *a, const bigint256_t *b);
+
+// dest[i] = src[i]^-1 mod p using a single inversion (zeros map to zero)
+void bigint_batch_inv_mod_p(bigint256_t *dest, const bigint256_t *src, size_t n);
+
 #endif
\ No newline at end of file
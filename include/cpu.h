@@ -0,0 +1,20 @@
+#ifndef CPU_H
+#define CPU_H
+
+// Runtime CPU feature detection (x86 CPUID). Every SIMD or crypto-extension
+// path checks these bits and falls back to portable code when they are clear.
+#define CPU_SSSE3  (1u << 0)
+#define CPU_SSE41  (1u << 1)
+#define CPU_AVX2   (1u << 2)   // Also requires OS support for the YMM state
+#define CPU_BMI2   (1u << 3)
+#define CPU_AESNI  (1u << 4)
+#define CPU_PCLMUL (1u << 5)
+#define CPU_SHA    (1u << 6)
+
+// Detected features (probed once, then cached); 0 on non-x86 targets
+unsigned int cpu_features(void);
+
+// 1 if every feature in mask is available
+int cpu_has(unsigned int mask);
+
+#endif // CPU_H
\ No newline at end of file
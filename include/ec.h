@@ -2,6 +2,7 @@
 #define EC_H
 
 #include "bigint.h"
+#include "field.h"
 
 // The Curve Equation: y^2 = x^3 + 7
 // (a = 0, b = 7)
@@ -12,6 +13,48 @@ typedef struct {
     int is_infinity; // 1 if this is the Point at Infinity (Zero), 0 otherwise
 } ec_point_t;
 
+// Affine Point on the field layer (x, y normalized); used on hot paths and tables
+typedef struct {
+    fe_t x;
+    fe_t y;
+    int is_infinity;
+} ec_apoint_t;
+
+// Jacobian Coordinates: (X, Y, Z) represents the affine point (X/Z^2, Y/Z^3)
+// Lets us add and double without a field inversion per step.
+typedef struct {
+    fe_t x;
+    fe_t y;
+    fe_t z;
+    int is_infinity;
+} ec_jpoint_t;
+
+// SEC1 encoded sizes
+#define EC_POINT_COMPRESSED_SIZE   33
+#define EC_POINT_UNCOMPRESSED_SIZE 65
+
+// Compact affine storage for precomputed tables (entries are never infinity)
+typedef struct {
+    bigint256_t x;
+    bigint256_t y;
+} ec_point_storage_t;
+
+// Fixed-base comb tables: one window of 16 entries per 4 bits of scalar,
+//   table[i][j] = j * 16^i * P + offset_i
+// The offsets (column 0 of ec_gen_table) sum to zero over all windows, so no
+// entry is infinity and the windows add up to exactly k * P.
+#define EC_GEN_WINDOWS     64
+#define EC_GEN_WINDOW_SIZE 16
+
+// Table for the generator G, generated by tools/gen_ec_table.c (src/ec_gen_table.c)
+extern const ec_point_storage_t ec_gen_table[EC_GEN_WINDOWS][EC_GEN_WINDOW_SIZE];
+
+// Prepared public key: a comb table for one long-lived point (opaque, ~64 KiB)
+typedef struct ec_prepared ec_prepared_t;
+
+// Bounded LRU cache of prepared keys, keyed by point coordinates (not thread-safe)
+typedef struct ec_prepared_cache ec_prepared_cache_t;
+
 // --- FUNCTIONS ---
 
 // 1. Initialize to the Generator Point G (defined in standards)
@@ -26,6 +69,91 @@ void ec_double(ec_point_t *res, const ec_point_t *p);
 // 4. Scalar Multiplication: res = k * P
 void ec_mul(ec_point_t *res, const bigint256_t *k, const ec_point_t *p);
 
+// 5. Generator Multiplication: res = k * G (precomputed table, no doublings)
+void ec_mul_g(ec_point_t *res, const bigint256_t *k);
+
+// 6. Comb Multiplication with any table laid out like ec_gen_table (constant time in k)
+void ec_mul_table(ec_point_t *res, const bigint256_t *k, const ec_point_storage_t table[EC_GEN_WINDOWS][EC_GEN_WINDOW_SIZE]);
+
+// 7. Conversions (Jacobian to affine costs one inversion)
+void ec_apoint_set(ec_apoint_t *res, const ec_point_t *p);
+void ec_apoint_get(ec_point_t *res, const ec_apoint_t *p);
+void ec_apoint_neg(ec_apoint_t *res, const ec_apoint_t *p);
+void ec_jacobian_from_affine(ec_jpoint_t *res, const ec_apoint_t *p);
+void ec_jacobian_to_affine(ec_apoint_t *res, const ec_jpoint_t *p);
+void ec_batch_to_affine(ec_apoint_t *res, const ec_jpoint_t *p, size_t n); // One inversion for all n
+
+// 8. Jacobian Doubling (a = 0): res = P + P
+void ec_jdouble(ec_jpoint_t *res, const ec_jpoint_t *p);
+
+// 9. Mixed Addition (Jacobian + Affine): res = P + Q
+void ec_jadd_mixed(ec_jpoint_t *res, const ec_jpoint_t *p, const ec_apoint_t *q);
+
+// 10. Jacobian Addition: res = P + Q
+void ec_jadd(ec_jpoint_t *res, const ec_jpoint_t *p, const ec_jpoint_t *q);
+
+// 11. Scalar Recoding and Tables for windowed multiplication
+int ec_wnaf(int *wnaf, const bigint256_t *k, int w);                // wnaf must hold 257 digits
+void ec_jadd_digit(ec_jpoint_t *acc, const ec_apoint_t *table, int d); // acc += d * P for a wNAF digit d (0 adds nothing)
+void ec_odd_multiples(ec_apoint_t *table, const ec_apoint_t *p, int n); // P, 3P, ..., (2n-1)P; n <= 32
+
+// 12. GLV Decomposition: k = k1 + k2 * lambda (mod n), k1 and k2 ~128 bits in absolute value
+void ec_scalar_split_lambda(bigint256_t *k1, bigint256_t *k2, const bigint256_t *k);
+int ec_scalar_is_high(const bigint256_t *k);                        // k > n/2 (constant time)
+void ec_apoint_mul_lambda(ec_apoint_t *r, const ec_apoint_t *p);    // lambda * P = (beta * x, y)
+
+// 13. Prepared Public Keys: pay ~1 ms once, then k * P costs about as much as k * G.
+// ec_prepare returns NULL on allocation failure, for a point off the curve, or for
+// one whose table would contain infinity; callers fall back to ec_mul.
+ec_prepared_t *ec_prepare(const ec_point_t *p);
+void ec_prepared_free(ec_prepared_t *pp);
+void ec_mul_prepared(ec_point_t *res, const bigint256_t *k, const ec_prepared_t *pp);
+
+// Cache of prepared keys holding at most capacity entries (least recently used is evicted).
+// ec_prepared_cache_get prepares p on a miss and returns NULL if that fails; the result
+// stays valid until the next get or mul on the cache. ec_prepared_cache_mul falls back
+// to ec_mul instead. ec_prepared_cache_contains leaves the recency order alone.
+ec_prepared_cache_t *ec_prepared_cache_new(size_t capacity);
+void ec_prepared_cache_free(ec_prepared_cache_t *cache);
+const ec_prepared_t *ec_prepared_cache_get(ec_prepared_cache_t *cache, const ec_point_t *p);
+int ec_prepared_cache_contains(const ec_prepared_cache_t *cache, const ec_point_t *p);
+void ec_prepared_cache_mul(ec_prepared_cache_t *cache, ec_point_t *res, const bigint256_t *k, const ec_point_t *p);
+
+// 14. Multi-Scalar Multiplication: res = sum k_i * P_i (Strauss for small n, Pippenger
+// for large n). Variable time. Returns 0 on allocation failure, 1 otherwise.
+int ec_multi_mul(ec_point_t *res, const bigint256_t *scalars, const ec_point_t *points, size_t n);
+
+// 15. Validation: 1 if P is infinity-free, has coordinates < p and satisfies y^2 = x^3 + 7
+int ec_is_on_curve(const ec_point_t *p);
+
+// 16. ECDH: out32 = big-endian x-coordinate of priv * pub, via an x-only Montgomery
+// ladder (constant time in priv, y is never computed). Returns 0 and zeroes out32 if
+// pub is not on the curve or the shared point is infinity, 1 otherwise.
+int ecdh_shared_x(uint8_t out32[32], const bigint256_t *priv, const ec_point_t *pub);
+
+// 17. SEC1 Encoding: 0x02/0x03 || x (compressed, parity of y in the prefix),
+// 0x04 || x || y (uncompressed), a single 0x00 for infinity.
+// ec_point_encode returns the number of bytes written (out must hold 65).
+// ec_point_decode returns 1 only for a well-formed encoding of a point on the curve.
+// ec_point_decode_batch decodes n encodings of len bytes each laid out back to back;
+// failed entries are set to infinity and it returns 1 only if all n succeeded.
+size_t ec_point_encode(uint8_t *out, const ec_point_t *p, int compressed);
+int ec_point_decode(ec_point_t *res, const uint8_t *in, size_t len);
+int ec_point_decode_batch(ec_point_t *res, const uint8_t *in, size_t len, size_t n);
+
+// 18. Four Independent Multiplications: res[j] = k[j] * p[j]. With AVX2 the four run
+// in SIMD lanes (GLV halves, fixed 4-bit signed windows, branch-free recoding, the
+// same operation sequence for every k); lanes whose result is infinity or that hit
+// an exceptional addition are redone with ec_mul, which is variable time. Without
+// AVX2 this is four ec_mul calls. Not for secret scalars: use ecdh_shared_x4.
+void ec_mul_x4(ec_point_t res[4], const bigint256_t k[4], const ec_point_t p[4]);
+
+// 19. Four ECDH Exchanges with one private key: out[j] and ok[j] as ecdh_shared_x
+// for pub[j]. With AVX2 the four run in ec_mul_x4's lanes, and exceptional lanes
+// are redone on the ladder instead of ec_mul, so the key never takes a variable-time
+// path; without AVX2 this is four ladder calls. Returns 1 if all four succeeded.
+int ecdh_shared_x4(uint8_t out[4][32], int ok[4], const bigint256_t *priv, const ec_point_t pub[4]);
+
 // Helper to print a point
 void ec_print(const char *name, const ec_point_t *p);
 
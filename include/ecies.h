@@ -0,0 +1,138 @@
+#ifndef ECIES_H
+#define ECIES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "bigint.h"
+#include "ec.h"
+#include "aes.h"
+#include "threadpool.h"
+
+// Streaming ECIES over secp256k1: ECDH with a fresh ephemeral key, HKDF-SHA256,
+// then AES-256-GCM over fixed-size chunks.
+//
+// Wire format:
+//   header  = "ECS1" || chunk_size (u32 BE) || R (33-byte compressed point)
+//   records = chunk_i ciphertext || tag_i, every chunk chunk_size bytes except
+//             the last, which may be shorter or empty but is always present
+//
+// Chunk i is sealed with nonce = prefix (7 bytes from the KDF) || i (u32 BE) ||
+// last flag (1 byte), and the header as AAD, so reordered, dropped or
+// truncated chunks fail authentication (the STREAM construction).
+#define ECIES_MAGIC          "ECS1"
+#define ECIES_HEADER_SIZE    (4 + 4 + EC_POINT_COMPRESSED_SIZE)
+#define ECIES_TAG_SIZE       AES_GCM_TAG_SIZE
+#define ECIES_CHUNK_DEFAULT  (64 * 1024)
+#define ECIES_CHUNK_MIN      16
+#define ECIES_CHUNK_MAX      (16 * 1024 * 1024)
+
+typedef struct {
+    aes_gcm_ctx_t gcm;
+    uint8_t header[ECIES_HEADER_SIZE];
+    uint8_t nonce_prefix[7];
+    uint32_t chunk_index;   // Next chunk to seal or open
+    size_t chunk_size;
+    size_t record_size;     // chunk_size + tag for decryption, chunk_size for encryption
+    uint8_t *buf;           // Held-back input: the stream's last record is only known at final
+    size_t buffered;
+    int decrypt;
+    int failed;             // Sticky: set by an authentication failure or misuse
+} ecies_stream_t;
+
+// Fill buf from the OS random source (getrandom). Returns 0 on failure.
+int ecies_random(uint8_t *buf, size_t len);
+
+// Fresh key pair: priv uniform in [1, n-1]
+int ecies_keygen(bigint256_t *priv, ec_point_t *pub);
+
+// Sizes of a whole stream, for preallocating output. ecies_plaintext_size
+// returns 0 and leaves *plain_len alone if cipher_len is not a valid length.
+uint64_t ecies_ciphertext_size(uint64_t plain_len, size_t chunk_size);
+int ecies_plaintext_size(uint64_t *plain_len, uint64_t cipher_len, size_t chunk_size);
+
+// --- ENCRYPT ---
+// chunk_size = 0 picks ECIES_CHUNK_DEFAULT. Writes the header to send first.
+int ecies_encrypt_init(ecies_stream_t *s, const ec_point_t *recipient, size_t chunk_size, uint8_t header[ECIES_HEADER_SIZE]);
+
+// Same, for a recipient prepared with ec_prepare (or taken from an
+// ec_prepared_cache_t): the ephemeral multiplication runs on its comb table
+// at about the cost of k * G instead of a full ladder.
+int ecies_encrypt_init_prepared(ecies_stream_t *s, const ec_prepared_t *recipient, size_t chunk_size, uint8_t header[ECIES_HEADER_SIZE]);
+
+// Seal whole chunks into out (*out_len bytes written, at most ecies_update_bound).
+// Returns 0 once the stream has failed: the chunk counter ran out, or final
+// was already called. Records sealed before the failure are still counted.
+int ecies_encrypt_update(ecies_stream_t *s, const uint8_t *in, size_t len, uint8_t *out, size_t *out_len);
+
+// Seal the last chunk (out needs chunk_size + ECIES_TAG_SIZE bytes). Returns 0
+// if the stream has failed, in which case the output is incomplete.
+int ecies_encrypt_final(ecies_stream_t *s, uint8_t *out, size_t *out_len);
+
+// --- DECRYPT ---
+// Returns 0 for a malformed header or an invalid R.
+int ecies_decrypt_init(ecies_stream_t *s, const bigint256_t *priv, const uint8_t header[ECIES_HEADER_SIZE]);
+
+// Open whole records into out (*out_len bytes written, at most ecies_update_bound).
+// Plaintext is released per chunk once that chunk's tag checks out; only
+// ecies_decrypt_final confirms the stream was not truncated. Returns 0 on
+// authentication failure.
+int ecies_decrypt_update(ecies_stream_t *s, const uint8_t *in, size_t len, uint8_t *out, size_t *out_len);
+
+// Open the last record (out needs chunk_size bytes). Returns 0 if it fails
+// authentication or the stream was cut short.
+int ecies_decrypt_final(ecies_stream_t *s, uint8_t *out, size_t *out_len);
+
+// Largest output one update call of len input bytes can produce
+size_t ecies_update_bound(const ecies_stream_t *s, size_t len);
+
+// Wipe keys and release the chunk buffer (safe to call more than once)
+void ecies_stream_free(ecies_stream_t *s);
+
+// --- BATCH DECRYPT ---
+// Many whole streams (header and every record) to one private key. Messages
+// are decrypted in groups: their R points are decoded together, ECDH runs
+// four at a time through ecdh_shared_x4 (constant time in the key, on the
+// ladder without AVX2), HKDF runs through multi-buffer SHA-256, and records
+// are opened with GCM.
+#define ECIES_BATCH_GROUP 16
+
+typedef struct {
+    const uint8_t *data;    // Header followed by every record
+    size_t len;
+} ecies_msg_t;
+
+typedef struct {
+    uint8_t *data;          // Caller's buffer; the message's len bytes always suffice
+    size_t len;             // Plaintext bytes (0 on failure)
+    int ok;                 // 1 if the whole stream authenticated; else no plaintext is left in data
+} ecies_out_t;
+
+// Decrypt msgs[i] into out[i].data, with groups spread over the pool by work
+// stealing (NULL = calling thread). Returns the number that decrypted.
+size_t ecies_decrypt_batch(const bigint256_t *priv, const ecies_msg_t *msgs, size_t n, ecies_out_t *out, threadpool_t *pool);
+
+// --- DECRYPT SERVICE ---
+// Asynchronous front end: submit queues a message and returns; pool workers
+// decrypt queued messages a group at a time and report each through its
+// callback. The queue is bounded, so submit blocks while it is full.
+#define ECIES_SERVICE_QUEUE_DEFAULT 1024
+
+typedef struct ecies_service ecies_service_t;
+
+// Runs on a pool worker (or inside submit without workers). out->data is the
+// buffer given to submit. Must not call ecies_service_submit or _wait.
+typedef void (*ecies_done_fn)(void *user, const ecies_out_t *out);
+
+// queue_cap = 0 picks ECIES_SERVICE_QUEUE_DEFAULT. The pool must outlive the service.
+ecies_service_t *ecies_service_new(const bigint256_t *priv, threadpool_t *pool, size_t queue_cap);
+
+// msg and out (len bytes suffice) must stay valid until done is called
+int ecies_service_submit(ecies_service_t *svc, const uint8_t *msg, size_t len, uint8_t *out, ecies_done_fn done, void *user);
+
+// Block until every submitted message has been reported
+void ecies_service_wait(ecies_service_t *svc);
+
+// Wait, then wipe the key and release the service
+void ecies_service_free(ecies_service_t *svc);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,91 @@
+#ifndef ECIES_STATS_H
+#define ECIES_STATS_H
+
+#include <stdint.h>
+
+// Optional hot-path instrumentation, compiled in with -DECIES_STATS (CMake
+// option ECIES_STATS). Operation counts and per-stage latencies go to
+// counters owned by the recording thread: no locks, no shared cache lines.
+// A snapshot sums every thread, including ones that have exited.
+// Without ECIES_STATS the recording macros expand to nothing, so release
+// builds pay no cost, and snapshots read as all zero.
+
+typedef enum {
+    ECIES_STAT_FE_MUL,          // Field multiplications (a 4-lane multiply counts 4)
+    ECIES_STAT_FE_SQR,          // Field squarings (likewise)
+    ECIES_STAT_INV,             // Modular inversions, mod p and mod n
+    ECIES_STAT_POINT_ADD,       // Point additions, ladder differential adds included
+    ECIES_STAT_POINT_DOUBLE,
+    ECIES_STAT_AES_BLOCK,       // AES block encryptions, CTR / GCM keystream included
+    ECIES_STAT_SHA256_BLOCK,    // SHA-256 compressions (per lane for multi-buffer)
+    ECIES_STAT_COUNT
+} ecies_stat_t;
+
+typedef enum {
+    ECIES_STAGE_KEYGEN,         // Ephemeral key pair (encryption only)
+    ECIES_STAGE_ECDH,           // Shared-secret scalar multiplication (and decoding R)
+    ECIES_STAGE_KDF,            // HKDF plus AES / GHASH key setup
+    ECIES_STAGE_CIPHER,         // Sealing or opening one record
+    ECIES_STAGE_COUNT
+} ecies_stage_t;
+
+// Latency histogram with log2 buckets: bucket i counts samples of
+// [2^i, 2^(i+1)) ticks (bucket 0 also takes 0)
+#define ECIES_STATS_BUCKETS 48
+
+typedef struct {
+    uint64_t count;
+    uint64_t total_ticks;
+    uint64_t max_ticks;
+    uint64_t hist[ECIES_STATS_BUCKETS];
+} ecies_stage_stats_t;
+
+typedef struct {
+    uint64_t ops[ECIES_STAT_COUNT];
+    ecies_stage_stats_t stages[ECIES_STAGE_COUNT];
+    double ticks_per_ns;        // Ticks are TSC cycles on x86, nanoseconds elsewhere
+} ecies_stats_t;
+
+// Sum of all threads' counters. Threads still recording may be mid-update,
+// so a snapshot taken under load is consistent per counter, not across them.
+void ecies_stats_snapshot(ecies_stats_t *out);
+void ecies_stats_reset(void);
+
+// Upper bound (in ticks) of the histogram bucket holding the pct-th percentile
+uint64_t ecies_stats_percentile(const ecies_stage_stats_t *stage, double pct);
+
+const char *ecies_stat_name(ecies_stat_t stat);
+const char *ecies_stage_name(ecies_stage_t stage);
+
+// --- RECORDING ---
+#ifdef ECIES_STATS
+
+extern _Thread_local ecies_stats_t *ecies_stats_tls;
+ecies_stats_t *ecies_stats_register(void);   // First use on a thread
+uint64_t ecies_stats_ticks(void);
+void ecies_stats_stage(ecies_stage_t stage, uint64_t ticks);
+
+static inline ecies_stats_t *ecies_stats_local(void) {
+    ecies_stats_t *s = ecies_stats_tls;
+    return s ? s : ecies_stats_register();
+}
+
+// Only the owning thread writes; relaxed accesses keep snapshot reads well defined
+#define ECIES_STAT_ADD(stat, n) do { \
+        uint64_t *c_ = &ecies_stats_local()->ops[stat]; \
+        __atomic_store_n(c_, __atomic_load_n(c_, __ATOMIC_RELAXED) + (uint64_t)(n), __ATOMIC_RELAXED); \
+    } while (0)
+#define ECIES_STAT_INC(stat)         ECIES_STAT_ADD(stat, 1)
+#define ECIES_STAGE_BEGIN(t)         uint64_t t = ecies_stats_ticks()
+#define ECIES_STAGE_END(stage, t)    ecies_stats_stage(stage, ecies_stats_ticks() - (t))
+
+#else
+
+#define ECIES_STAT_ADD(stat, n)      ((void)0)
+#define ECIES_STAT_INC(stat)         ((void)0)
+#define ECIES_STAGE_BEGIN(t)         ((void)0)
+#define ECIES_STAGE_END(stage, t)    ((void)0)
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef FIELD_H
+#define FIELD_H
+
+#include <stdint.h>
+#include "bigint.h"
+
+// Field element mod p = 2^256 - 2^32 - 977 in 5 x 52-bit limbs:
+//   value = n[0] + n[1]*2^52 + n[2]*2^104 + n[3]*2^156 + n[4]*2^208
+//
+// Limbs are allowed to grow past 52 bits (lazy reduction). The "magnitude"
+// of an element is how many normalized values were summed to produce it:
+// mul/sqr output has magnitude 1, fe_add adds magnitudes, fe_mul_int
+// multiplies them. Inputs to mul/sqr must have magnitude <= 8.
+// Only normalized elements (fully reduced, < p) may be compared or exported.
+typedef struct {
+    uint64_t n[5];
+} fe_t;
+
+// --- CONVERSION ---
+void fe_set_int(fe_t *r, uint64_t v);
+void fe_set_bigint(fe_t *r, const bigint256_t *a);   // a must be < p
+void fe_get_bigint(bigint256_t *r, const fe_t *a);   // a must be normalized
+
+// --- REDUCTION ---
+void fe_normalize(fe_t *r);        // Fully reduce to [0, p)
+void fe_normalize_weak(fe_t *r);   // Reduce to magnitude 1
+int fe_normalizes_to_zero(const fe_t *a);
+
+// --- PREDICATES (inputs must be normalized) ---
+int fe_is_zero(const fe_t *a);
+int fe_is_odd(const fe_t *a);
+int fe_equal(const fe_t *a, const fe_t *b);
+
+// --- ARITHMETIC ---
+void fe_add(fe_t *r, const fe_t *a);                  // r += a
+void fe_mul_int(fe_t *r, uint64_t k);                 // r *= k (small k)
+void fe_negate(fe_t *r, const fe_t *a, int m);        // r = -a, a has magnitude <= m
+void fe_mul(fe_t *r, const fe_t *a, const fe_t *b);   // Fused multiply-and-reduce
+void fe_sqr(fe_t *r, const fe_t *a);                  // Fused square-and-reduce
+void fe_inv(fe_t *r, const fe_t *a);                  // r = a^-1 (0 maps to 0)
+int fe_sqrt(fe_t *r, const fe_t *a);                  // r^2 = a; returns 0 if a is not a square
+
+// Constant-time select: r = flag ? a : r
+void fe_cmov(fe_t *r, const fe_t *a, int flag);
+
+// Constant-time swap: if flag, exchange a and b
+void fe_cswap(fe_t *a, fe_t *b, int flag);
+
+#endif
\ No newline at end of file
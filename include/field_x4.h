@@ -0,0 +1,46 @@
+#ifndef FIELD_X4_H
+#define FIELD_X4_H
+
+#include "field.h"
+
+// Four independent field elements in AVX2 lanes, 10 x 26-bit limbs each:
+//   lane j of n[i] holds limb i of element j (one limb per 64-bit lane)
+//   value = sum n[i] * 2^(26 i)
+//
+// Same lazy-reduction rules as fe_t: mul/sqr output has magnitude 1, inputs
+// to mul/sqr must have magnitude <= 8. Products are formed with 32x32->64
+// lane multiplies, so the 26-bit radix leaves room for ten-term column sums.
+//
+// Only available on x86; every fe4_ function needs AVX2 at run time
+// (check cpu_has(CPU_AVX2) first). The file itself builds without -mavx2.
+#if defined(__x86_64__) || defined(__i386__)
+#define FE4_AVAILABLE 1
+#include <immintrin.h>
+
+#define FE4_TARGET __attribute__((target("avx2")))
+
+typedef struct {
+    __m256i n[10];
+} fe4_t;
+
+// --- CONVERSION ---
+FE4_TARGET void fe4_set(fe4_t *r, const fe_t a[4]);     // a must have magnitude 1
+FE4_TARGET void fe4_get(fe_t r[4], const fe4_t *a);     // Output has magnitude 1
+FE4_TARGET void fe4_set_int(fe4_t *r, uint32_t v);      // Same v in all lanes
+
+// --- REDUCTION ---
+FE4_TARGET void fe4_normalize_weak(fe4_t *r);
+
+// --- ARITHMETIC ---
+FE4_TARGET void fe4_add(fe4_t *r, const fe4_t *a);                  // r += a
+FE4_TARGET void fe4_mul_int(fe4_t *r, uint32_t k);                  // r *= k (small k)
+FE4_TARGET void fe4_negate(fe4_t *r, const fe4_t *a, int m);        // r = -a, a has magnitude <= m
+FE4_TARGET void fe4_mul(fe4_t *r, const fe4_t *a, const fe4_t *b);
+FE4_TARGET void fe4_sqr(fe4_t *r, const fe4_t *a);
+
+// Constant-time per-lane select and swap: lanes of mask are all-ones (take a / swap) or zero
+FE4_TARGET void fe4_cmov(fe4_t *r, const fe4_t *a, __m256i mask);
+FE4_TARGET void fe4_cswap(fe4_t *a, fe4_t *b, __m256i mask);
+#endif
+
+#endif // FIELD_X4_H
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef KDF_H
+#define KDF_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sha256.h"
+
+// --- HMAC-SHA256 ---
+// A prepared key: SHA-256 contexts that have already absorbed K ^ ipad and
+// K ^ opad. Each MAC clones them, saving two compressions per message.
+typedef struct {
+    sha256_ctx_t inner;
+    sha256_ctx_t outer;
+} hmac_sha256_key_t;
+
+typedef struct {
+    sha256_ctx_t inner;
+    const hmac_sha256_key_t *key;   // Must outlive the MAC computation
+} hmac_sha256_ctx_t;
+
+void hmac_sha256_key_init(hmac_sha256_key_t *key, const uint8_t *k, size_t k_len);
+void hmac_sha256_init(hmac_sha256_ctx_t *ctx, const hmac_sha256_key_t *key);
+void hmac_sha256_update(hmac_sha256_ctx_t *ctx, const uint8_t *data, size_t len);
+void hmac_sha256_final(hmac_sha256_ctx_t *ctx, uint8_t mac[32]);
+void hmac_sha256(uint8_t mac[32], const hmac_sha256_key_t *key, const uint8_t *data, size_t len);
+
+// --- HKDF-SHA256 (RFC 5869) ---
+#define HKDF_SHA256_MAX_OKM (255 * 32)
+
+// Extract with a salt prepared as an HMAC key (an empty salt is 32 zero bytes)
+void hkdf_sha256_extract(uint8_t prk[32], const hmac_sha256_key_t *salt, const uint8_t *ikm, size_t ikm_len);
+
+// Expand; returns 0 if okm_len > HKDF_SHA256_MAX_OKM
+int hkdf_sha256_expand(uint8_t *okm, size_t okm_len, const uint8_t prk[32], const uint8_t *info, size_t info_len);
+
+// Extract-then-expand in one call
+int hkdf_sha256(uint8_t *okm, size_t okm_len, const uint8_t *salt, size_t salt_len,
+                const uint8_t *ikm, size_t ikm_len, const uint8_t *info, size_t info_len);
+
+// n secrets of equal length under one salt and info: okm + i * okm_len gets
+// HKDF(salt, ikm[i], info). Both HMAC layers run through sha256_batch.
+// Returns 0 if okm_len is too large or memory runs out.
+int hkdf_sha256_batch(uint8_t *okm, size_t okm_len, const hmac_sha256_key_t *salt,
+                      const uint8_t *const *ikm, size_t n, size_t ikm_len, const uint8_t *info, size_t info_len);
+
+// As hkdf_sha256_batch, but secret i is extracted under its own salt[i]
+// (all salt_len bytes, at most one 64-byte block). Returns 0 if salt_len > 64.
+int hkdf_sha256_batch_salts(uint8_t *okm, size_t okm_len, const uint8_t *const *salt, size_t salt_len,
+                            const uint8_t *const *ikm, size_t n, size_t ikm_len, const uint8_t *info, size_t info_len);
+
+// --- ANSI X9.63 KDF (SEC 1, 3.6.1) ---
+// out = SHA256(Z || 1 || SharedInfo) || SHA256(Z || 2 || SharedInfo) || ...
+// (32-bit big-endian counter), truncated to out_len
+void x963_kdf_sha256(uint8_t *out, size_t out_len, const uint8_t *z, size_t z_len, const uint8_t *shared_info, size_t info_len);
+
+#endif
\ No newline at end of file
@@ -4,15 +4,56 @@
 #include <stdint.h>
 #include <stddef.h>
 
+// Block backends (see sha256_set_impl)
+typedef enum {
+    SHA256_IMPL_AUTO = 0,   // SHA-NI, else AVX2, else SSSE3, else scalar
+    SHA256_IMPL_SCALAR,     // Portable C
+    SHA256_IMPL_SSSE3,      // SIMD message schedule, scalar rounds
+    SHA256_IMPL_AVX2,       // As SSSE3, two blocks' schedules per pass (AVX2 + BMI2)
+    SHA256_IMPL_SHANI       // x86 SHA extensions
+} sha256_impl_t;
+
 typedef struct {
     uint8_t data[64];
     uint32_t datalen;
     uint64_t bitlen;
     uint32_t state[8];
+    sha256_impl_t impl;     // SHA256_IMPL_AUTO after sha256_init
 } sha256_ctx_t;
 
 void sha256_init(sha256_ctx_t *ctx);
 void sha256_update(sha256_ctx_t *ctx, const uint8_t *data, size_t len);
 void sha256_final(sha256_ctx_t *ctx, uint8_t hash[32]);
 
+// Pick the block backend for this context. Returns 0 (ctx unchanged) if the CPU lacks it.
+int sha256_set_impl(sha256_ctx_t *ctx, sha256_impl_t impl);
+
+// Compress nblocks full 64-byte blocks into ctx->state with the context's
+// backend. Buffered data and bitlen are left alone.
+void sha256_transform_blocks(sha256_ctx_t *ctx, const uint8_t *data, size_t nblocks);
+
+// --- MULTI-BUFFER ---
+// Hash independent messages of the same length side by side, one per SIMD
+// lane: out[i] = SHA-256(in[i][0..len)). sha256_x8 uses AVX2 when present
+// and falls back to two 4-way passes; sha256_x4 uses 128-bit vectors.
+void sha256_x8(uint8_t out[8][32], const uint8_t *const in[8], size_t len);
+void sha256_x4(uint8_t out[4][32], const uint8_t *const in[4], size_t len);
+
+// Any number of equal-length messages, 8 (or 4) lanes at a time. Each one
+// continues from mid (a context holding whole blocks only, e.g. an HMAC pad
+// midstate), or from a fresh context if mid is NULL.
+void sha256_batch(uint8_t (*out)[32], const sha256_ctx_t *mid, const uint8_t *const *in, size_t n, size_t len);
+
+// --- BACKENDS ---
+// All take the chaining state directly and hash nblocks consecutive blocks.
+extern const uint32_t sha256_k[64];
+void sha256_blocks_scalar(uint32_t state[8], const uint8_t *data, size_t nblocks);
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SHA256_X86_AVAILABLE 1
+void sha256_blocks_ssse3(uint32_t state[8], const uint8_t *data, size_t nblocks);  // Needs CPU_SSSE3
+void sha256_blocks_avx2(uint32_t state[8], const uint8_t *data, size_t nblocks);   // Needs CPU_AVX2 | CPU_BMI2
+void sha256_blocks_shani(uint32_t state[8], const uint8_t *data, size_t nblocks);  // Needs CPU_SHA | CPU_SSE41
+#endif
+
 #endif
\ No newline at end of file
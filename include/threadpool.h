@@ -0,0 +1,36 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <stddef.h>
+
+// Fixed-size pool of worker threads for data-parallel loops and queued tasks.
+// One parallel_for runs at a time per pool; the calling thread works too.
+typedef struct threadpool threadpool_t;
+
+// Loop body: called once for every index in [0, n)
+typedef void (*threadpool_fn)(void *arg, size_t index);
+
+// Queued task: called once on a worker thread
+typedef void (*threadpool_task_fn)(void *arg);
+
+// nthreads = 0 uses the number of online CPUs. Returns NULL on failure.
+threadpool_t *threadpool_new(size_t nthreads);
+
+// Waits for queued tasks to finish, then stops the workers
+void threadpool_free(threadpool_t *pool);
+
+// Threads that run loop bodies, counting the caller
+size_t threadpool_size(const threadpool_t *pool);
+
+// Run fn(arg, i) for i = 0..n-1 across the pool and wait for all of them.
+// Every thread starts on its own contiguous share of the range and, once that
+// runs dry, steals the upper half of another thread's remainder, so uneven
+// bodies still balance. A NULL pool runs the loop on the calling thread.
+void threadpool_parallel_for(threadpool_t *pool, size_t n, threadpool_fn fn, void *arg);
+
+// Queue fn(arg) to run on a worker (FIFO; loops take priority) and return
+// without waiting. Without workers it runs on the calling thread before
+// returning. Returns 0 if the task could not be queued.
+int threadpool_submit(threadpool_t *pool, threadpool_task_fn fn, void *arg);
+
+#endif
\ No newline at end of file
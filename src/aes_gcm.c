@@ -0,0 +1,159 @@
+#include "aes.h"
+#include "cpu.h"
+#include "ecies_stats.h"
+#include <string.h>
+
+// Data is hashed in L1-sized chunks right after (or before) it is XORed,
+// so the portable path also reads the buffer only once
+#define AES_GCM_CHUNK 4096
+
+// Reduction of the 4 bits shifted out of the low end, for x^128 + x^7 + x^2 + x + 1
+static const uint16_t ghash_last4[16] = {
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+static uint64_t gcm_get64(const uint8_t *p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v = (v << 8) | p[i];
+    return v;
+}
+
+static void gcm_put64(uint8_t *p, uint64_t v) {
+    for (int i = 7; i >= 0; i--) { p[i] = (uint8_t)v; v >>= 8; }
+}
+
+// x = x * H, one nibble at a time from the last byte (GCM bit order is reflected)
+static void ghash_mul(const aes_gcm_ctx_t *gcm, uint8_t x[16]) {
+    uint64_t zh, zl;
+    uint8_t lo = x[15] & 0x0F;
+    zh = gcm->hh[lo];
+    zl = gcm->hl[lo];
+
+    for (int i = 15; i >= 0; i--) {
+        uint8_t hi = x[i] >> 4;
+        uint8_t rem;
+        lo = x[i] & 0x0F;
+
+        if (i != 15) {
+            rem = (uint8_t)(zl & 0x0F);
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ ((uint64_t)ghash_last4[rem] << 48);
+            zh ^= gcm->hh[lo];
+            zl ^= gcm->hl[lo];
+        }
+        rem = (uint8_t)(zl & 0x0F);
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ ((uint64_t)ghash_last4[rem] << 48);
+        zh ^= gcm->hh[hi];
+        zl ^= gcm->hl[hi];
+    }
+
+    gcm_put64(x, zh);
+    gcm_put64(x + 8, zl);
+}
+
+// Absorb data into y; a partial last block is zero padded
+static void ghash_update(const aes_gcm_ctx_t *gcm, uint8_t y[16], const uint8_t *data, size_t len) {
+    while (len > 0) {
+        size_t n = len < 16 ? len : 16;
+        aes_xor_bytes(y, data, n);
+        ghash_mul(gcm, y);
+        data += n;
+        len -= n;
+    }
+}
+
+void aes_gcm_init(aes_gcm_ctx_t *gcm, const aes_ctx_t *aes) {
+    uint8_t h[16] = {0};
+    gcm->aes = *aes;
+    aes_encrypt_block(aes, h, h);
+
+    // hl/hh[8] = H (the top nibble bit is x^0); halving walks down to [1]
+    uint64_t vh = gcm_get64(h), vl = gcm_get64(h + 8);
+    gcm->hh[0] = gcm->hl[0] = 0;
+    gcm->hh[8] = vh;
+    gcm->hl[8] = vl;
+    for (int i = 4; i > 0; i >>= 1) {
+        uint64_t t = (vl & 1) ? 0xE100000000000000ULL : 0;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ t;
+        gcm->hh[i] = vh;
+        gcm->hl[i] = vl;
+    }
+    for (int i = 2; i <= 8; i *= 2) {
+        for (int j = 1; j < i; j++) {
+            gcm->hh[i + j] = gcm->hh[i] ^ gcm->hh[j];
+            gcm->hl[i + j] = gcm->hl[i] ^ gcm->hl[j];
+        }
+    }
+
+    // Powers of H for aggregated reduction
+    memcpy(gcm->hpow[0], h, 16);
+    for (int i = 1; i < 8; i++) {
+        memcpy(gcm->hpow[i], gcm->hpow[i - 1], 16);
+        ghash_mul(gcm, gcm->hpow[i]);
+    }
+}
+
+static int aes_gcm_use_clmul(const aes_gcm_ctx_t *gcm) {
+#ifdef AES_NI_AVAILABLE
+    aes_impl_t impl = gcm->aes.impl;
+    return (impl == AES_IMPL_AUTO || impl == AES_IMPL_AESNI) && cpu_has(CPU_AESNI | CPU_SSE41 | CPU_PCLMUL);
+#else
+    (void)gcm;
+    return 0;
+#endif
+}
+
+// Shared pass: GHASH(aad, ciphertext, lengths) XOR E(J0), where J0 = iv || 1
+static void aes_gcm_crypt(const aes_gcm_ctx_t *gcm, const uint8_t *iv, const uint8_t *aad, size_t aad_len,
+                          uint8_t *buf, size_t len, uint8_t tag[16], int decrypt) {
+    uint8_t y[16] = {0};
+    ghash_update(gcm, y, aad, aad_len);
+
+#ifdef AES_NI_AVAILABLE
+    if (aes_gcm_use_clmul(gcm)) {
+        ECIES_STAT_ADD(ECIES_STAT_AES_BLOCK, (len + 15) / 16);
+        aes_gcm_crypt_clmul(gcm, iv, y, buf, len, decrypt);
+    } else
+#endif
+    {
+        // Keystream offset 32 is block counter 2, the first one after J0
+        for (size_t pos = 0; pos < len; pos += AES_GCM_CHUNK) {
+            size_t n = len - pos < AES_GCM_CHUNK ? len - pos : AES_GCM_CHUNK;
+            if (decrypt) ghash_update(gcm, y, buf + pos, n);
+            aes_ctr_xor(&gcm->aes, iv, 32 + (uint64_t)pos, buf + pos, n);
+            if (!decrypt) ghash_update(gcm, y, buf + pos, n);
+        }
+    }
+
+    uint8_t lens[16];
+    gcm_put64(lens, (uint64_t)aad_len * 8);
+    gcm_put64(lens + 8, (uint64_t)len * 8);
+    ghash_update(gcm, y, lens, 16);
+
+    // Tag = y XOR E(J0): J0 is keystream block 1
+    memcpy(tag, y, 16);
+    aes_ctr_xor(&gcm->aes, iv, 16, tag, 16);
+}
+
+void aes_gcm_encrypt(const aes_gcm_ctx_t *gcm, const uint8_t iv[AES_GCM_IV_SIZE], const uint8_t *aad, size_t aad_len,
+                     uint8_t *buf, size_t len, uint8_t tag[AES_GCM_TAG_SIZE]) {
+    aes_gcm_crypt(gcm, iv, aad, aad_len, buf, len, tag, 0);
+}
+
+int aes_gcm_decrypt(const aes_gcm_ctx_t *gcm, const uint8_t iv[AES_GCM_IV_SIZE], const uint8_t *aad, size_t aad_len,
+                    uint8_t *buf, size_t len, const uint8_t tag[AES_GCM_TAG_SIZE]) {
+    uint8_t expect[16];
+    aes_gcm_crypt(gcm, iv, aad, aad_len, buf, len, expect, 1);
+
+    // Constant-time compare; on mismatch no unauthenticated plaintext is released
+    uint8_t diff = 0;
+    for (int i = 0; i < 16; i++) diff |= expect[i] ^ tag[i];
+    if (diff != 0) {
+        memset(buf, 0, len);
+        return 0;
+    }
+    return 1;
+}
\ No newline at end of file
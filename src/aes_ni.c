@@ -0,0 +1,233 @@
+#include "aes.h"
+
+#ifdef AES_NI_AVAILABLE
+#include <immintrin.h>
+#include <string.h>
+
+#define AES_NI_TARGET __attribute__((target("aes,sse4.1")))
+#define AES_NI_LANES  8   // aesenc has ~4 cycles latency and 1-2/cycle throughput
+
+// Lane and round loops must unroll so the blocks stay in registers
+#define AES_NI_UNROLL _Pragma("GCC unroll 14")
+
+// Round keys as the bytes AES-NI expects: each word of round_keys is a big-endian column
+static AES_NI_TARGET void aes_ni_load_keys(__m128i rk[AES_MAX_ROUNDS + 1], const aes_ctx_t *ctx) {
+    uint8_t b[16];
+    for (int r = 0; r <= ctx->nr; r++) {
+        for (int c = 0; c < 4; c++) {
+            uint32_t w = ctx->round_keys[r * 4 + c];
+            b[4 * c] = (uint8_t)(w >> 24);
+            b[4 * c + 1] = (uint8_t)(w >> 16);
+            b[4 * c + 2] = (uint8_t)(w >> 8);
+            b[4 * c + 3] = (uint8_t)w;
+        }
+        rk[r] = _mm_loadu_si128((const __m128i *)b);
+    }
+}
+
+static AES_NI_TARGET inline __m128i aes_ni_encrypt(__m128i x, const __m128i rk[AES_MAX_ROUNDS + 1], int nr) {
+    x = _mm_xor_si128(x, rk[0]);
+    for (int r = 1; r < nr; r++) x = _mm_aesenc_si128(x, rk[r]);
+    return _mm_aesenclast_si128(x, rk[nr]);
+}
+
+// Bulk loops are instantiated per round count, so the round loops unroll fully
+#define AES_NI_INLINE AES_NI_TARGET inline __attribute__((always_inline))
+
+static AES_NI_INLINE void aes_ni_ctr(const aes_ctx_t *ctx, const uint8_t *nonce, uint32_t counter, uint8_t *buf, size_t len, const int nr) {
+    __m128i rk[AES_MAX_ROUNDS + 1];
+    aes_ni_load_keys(rk, ctx);
+
+    // Counter block: 12-byte nonce, then the 32-bit big-endian block counter
+    uint8_t blk[16];
+    memcpy(blk, nonce, 12);
+    memset(blk + 12, 0, 4);
+    const __m128i base = _mm_loadu_si128((const __m128i *)blk);
+
+    // 8 independent blocks per pass so the aesenc pipeline stays full
+    while (len >= 16 * AES_NI_LANES) {
+        __m128i x[AES_NI_LANES];
+        AES_NI_UNROLL for (int j = 0; j < AES_NI_LANES; j++) {
+            x[j] = _mm_insert_epi32(base, (int)__builtin_bswap32(counter + (uint32_t)j), 3);
+            x[j] = _mm_xor_si128(x[j], rk[0]);
+        }
+        AES_NI_UNROLL for (int r = 1; r < nr; r++) {
+            AES_NI_UNROLL for (int j = 0; j < AES_NI_LANES; j++) x[j] = _mm_aesenc_si128(x[j], rk[r]);
+        }
+        AES_NI_UNROLL for (int j = 0; j < AES_NI_LANES; j++) {
+            __m128i p = _mm_loadu_si128((const __m128i *)(buf + 16 * j));
+            x[j] = _mm_aesenclast_si128(x[j], rk[nr]);
+            _mm_storeu_si128((__m128i *)(buf + 16 * j), _mm_xor_si128(p, x[j]));
+        }
+        counter += AES_NI_LANES;
+        buf += 16 * AES_NI_LANES;
+        len -= 16 * AES_NI_LANES;
+    }
+
+    while (len >= 16) {
+        __m128i x = aes_ni_encrypt(_mm_insert_epi32(base, (int)__builtin_bswap32(counter), 3), rk, nr);
+        __m128i p = _mm_loadu_si128((const __m128i *)buf);
+        _mm_storeu_si128((__m128i *)buf, _mm_xor_si128(p, x));
+        counter++;
+        buf += 16;
+        len -= 16;
+    }
+
+    if (len > 0) {
+        uint8_t ks[16];
+        __m128i x = aes_ni_encrypt(_mm_insert_epi32(base, (int)__builtin_bswap32(counter), 3), rk, nr);
+        _mm_storeu_si128((__m128i *)ks, x);
+        for (size_t i = 0; i < len; i++) buf[i] ^= ks[i];
+    }
+}
+
+AES_NI_TARGET void aes_ctr_xor_aesni(const aes_ctx_t *ctx, const uint8_t *nonce, uint32_t counter, uint8_t *buf, size_t len) {
+    switch (ctx->nr) {
+    case 10: aes_ni_ctr(ctx, nonce, counter, buf, len, 10); break;
+    case 12: aes_ni_ctr(ctx, nonce, counter, buf, len, 12); break;
+    default: aes_ni_ctr(ctx, nonce, counter, buf, len, 14); break;
+    }
+}
+
+// --- GCM ---
+#define AES_GCM_TARGET __attribute__((target("aes,sse4.1,pclmul")))
+
+// Products of byte-reversed blocks, left unreduced so 8 of them share one reduction.
+// Karatsuba: hk holds hi ^ lo of H's two halves in both lanes, so the middle
+// term costs one multiply instead of two
+static AES_GCM_TARGET inline void gcm_clmul_acc(__m128i a, __m128i h, __m128i hk, __m128i *lo, __m128i *mid, __m128i *hi) {
+    __m128i ak = _mm_xor_si128(a, _mm_shuffle_epi32(a, 0x4E));
+    *lo = _mm_xor_si128(*lo, _mm_clmulepi64_si128(a, h, 0x00));
+    *hi = _mm_xor_si128(*hi, _mm_clmulepi64_si128(a, h, 0x11));
+    *mid = _mm_xor_si128(*mid, _mm_clmulepi64_si128(ak, hk, 0x00));
+}
+
+// Fold the 256-bit product back to 128 bits: shift left by one for the
+// reflected bit order, then reduce mod x^128 + x^7 + x^2 + x + 1
+static AES_GCM_TARGET inline __m128i gcm_clmul_reduce(__m128i lo, __m128i mid, __m128i hi) {
+    mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+    lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+    hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+    __m128i c_lo = _mm_srli_epi32(lo, 31);
+    __m128i c_hi = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    hi = _mm_or_si128(hi, _mm_srli_si128(c_lo, 12));
+    hi = _mm_or_si128(hi, _mm_slli_si128(c_hi, 4));
+    lo = _mm_or_si128(lo, _mm_slli_si128(c_lo, 4));
+
+    __m128i t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)), _mm_slli_epi32(lo, 25));
+    __m128i carry = _mm_srli_si128(t, 4);
+    lo = _mm_xor_si128(lo, _mm_slli_si128(t, 12));
+
+    t = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)), _mm_srli_epi32(lo, 7));
+    t = _mm_xor_si128(t, carry);
+    return _mm_xor_si128(hi, _mm_xor_si128(lo, t));
+}
+
+// acc = (acc ^ c[0]) * H^8 ^ c[1] * H^7 ^ ... ^ c[7] * H, blocks already byte-reversed
+static AES_GCM_TARGET inline __m128i gcm_ghash8(__m128i acc, const __m128i c[AES_NI_LANES], const __m128i h[AES_NI_LANES], const __m128i hk[AES_NI_LANES]) {
+    __m128i lo = _mm_setzero_si128(), mid = _mm_setzero_si128(), hi = _mm_setzero_si128();
+    gcm_clmul_acc(_mm_xor_si128(acc, c[0]), h[AES_NI_LANES - 1], hk[AES_NI_LANES - 1], &lo, &mid, &hi);
+    AES_NI_UNROLL for (int j = 1; j < AES_NI_LANES; j++) {
+        gcm_clmul_acc(c[j], h[AES_NI_LANES - 1 - j], hk[AES_NI_LANES - 1 - j], &lo, &mid, &hi);
+    }
+    return gcm_clmul_reduce(lo, mid, hi);
+}
+
+static AES_GCM_TARGET inline __m128i gcm_ghash1(__m128i acc, __m128i c, __m128i h, __m128i hk) {
+    __m128i lo = _mm_setzero_si128(), mid = _mm_setzero_si128(), hi = _mm_setzero_si128();
+    gcm_clmul_acc(_mm_xor_si128(acc, c), h, hk, &lo, &mid, &hi);
+    return gcm_clmul_reduce(lo, mid, hi);
+}
+
+static AES_GCM_TARGET inline __attribute__((always_inline)) void aes_gcm_clmul(const aes_gcm_ctx_t *gcm, const uint8_t *iv, uint8_t y[16], uint8_t *buf, size_t len, int decrypt, const int nr) {
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i rk[AES_MAX_ROUNDS + 1], h[AES_NI_LANES], hk[AES_NI_LANES];
+    aes_ni_load_keys(rk, &gcm->aes);
+    for (int j = 0; j < AES_NI_LANES; j++) {
+        h[j] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)gcm->hpow[j]), bswap);
+        hk[j] = _mm_xor_si128(h[j], _mm_shuffle_epi32(h[j], 0x4E));
+    }
+    __m128i acc = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)y), bswap);
+
+    uint8_t blk[16];
+    memcpy(blk, iv, 12);
+    memset(blk + 12, 0, 4);
+    const __m128i base = _mm_loadu_si128((const __m128i *)blk);
+    uint32_t counter = 2;
+
+    // GHASH runs one group behind when encrypting, so it never waits on the
+    // aesenc chain it is interleaved with; decryption hashes its input directly
+    __m128i pend[AES_NI_LANES] = { 0 };
+    int pending = 0;
+
+    while (len >= 16 * AES_NI_LANES) {
+        __m128i x[AES_NI_LANES], p[AES_NI_LANES];
+        AES_NI_UNROLL for (int j = 0; j < AES_NI_LANES; j++) {
+            p[j] = _mm_loadu_si128((const __m128i *)(buf + 16 * j));
+            x[j] = _mm_insert_epi32(base, (int)__builtin_bswap32(counter + (uint32_t)j), 3);
+            x[j] = _mm_xor_si128(x[j], rk[0]);
+        }
+        if (decrypt) {
+            AES_NI_UNROLL for (int j = 0; j < AES_NI_LANES; j++) pend[j] = _mm_shuffle_epi8(p[j], bswap);
+            pending = 1;
+        }
+        // One GHASH multiply per AES round keeps both units busy
+        __m128i lo = _mm_setzero_si128(), mid = _mm_setzero_si128(), hi = _mm_setzero_si128();
+        AES_NI_UNROLL for (int r = 1; r < nr; r++) {
+            AES_NI_UNROLL for (int j = 0; j < AES_NI_LANES; j++) x[j] = _mm_aesenc_si128(x[j], rk[r]);
+            if (pending && r <= AES_NI_LANES) {
+                __m128i c = r == 1 ? _mm_xor_si128(acc, pend[0]) : pend[r - 1];
+                gcm_clmul_acc(c, h[AES_NI_LANES - r], hk[AES_NI_LANES - r], &lo, &mid, &hi);
+            }
+        }
+        if (pending) acc = gcm_clmul_reduce(lo, mid, hi);
+        AES_NI_UNROLL for (int j = 0; j < AES_NI_LANES; j++) {
+            x[j] = _mm_xor_si128(p[j], _mm_aesenclast_si128(x[j], rk[nr]));
+            _mm_storeu_si128((__m128i *)(buf + 16 * j), x[j]);
+        }
+        if (!decrypt) {
+            AES_NI_UNROLL for (int j = 0; j < AES_NI_LANES; j++) pend[j] = _mm_shuffle_epi8(x[j], bswap);
+            pending = 1;
+        }
+        counter += AES_NI_LANES;
+        buf += 16 * AES_NI_LANES;
+        len -= 16 * AES_NI_LANES;
+    }
+    if (!decrypt && pending) acc = gcm_ghash8(acc, pend, h, hk);
+
+    while (len >= 16) {
+        __m128i x = aes_ni_encrypt(_mm_insert_epi32(base, (int)__builtin_bswap32(counter), 3), rk, nr);
+        __m128i p = _mm_loadu_si128((const __m128i *)buf);
+        __m128i c = _mm_xor_si128(p, x);
+        _mm_storeu_si128((__m128i *)buf, c);
+        acc = gcm_ghash1(acc, _mm_shuffle_epi8(decrypt ? p : c, bswap), h[0], hk[0]);
+        counter++;
+        buf += 16;
+        len -= 16;
+    }
+
+    if (len > 0) {
+        // Partial block: the ciphertext is hashed zero padded
+        uint8_t ks[16], c[16] = {0};
+        _mm_storeu_si128((__m128i *)ks, aes_ni_encrypt(_mm_insert_epi32(base, (int)__builtin_bswap32(counter), 3), rk, nr));
+        if (decrypt) memcpy(c, buf, len);
+        for (size_t i = 0; i < len; i++) buf[i] ^= ks[i];
+        if (!decrypt) memcpy(c, buf, len);
+        acc = gcm_ghash1(acc, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)c), bswap), h[0], hk[0]);
+    }
+
+    _mm_storeu_si128((__m128i *)y, _mm_shuffle_epi8(acc, bswap));
+}
+
+AES_GCM_TARGET void aes_gcm_crypt_clmul(const aes_gcm_ctx_t *gcm, const uint8_t *iv, uint8_t y[16], uint8_t *buf, size_t len, int decrypt) {
+    switch (gcm->aes.nr) {
+    case 10: aes_gcm_clmul(gcm, iv, y, buf, len, decrypt, 10); break;
+    case 12: aes_gcm_clmul(gcm, iv, y, buf, len, decrypt, 12); break;
+    default: aes_gcm_clmul(gcm, iv, y, buf, len, decrypt, 14); break;
+    }
+}
+
+#endif // AES_NI_AVAILABLE
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "bigint.h"
+#include "ecies_stats.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -36,6 +37,14 @@ void bigint_set_hex(bigint256_t *dest, const char *hex_str) {
     }
 }
 
+void bigint_set_bytes(bigint256_t *dest, const uint8_t in[32]) {
+    for (int i = 0; i < NUM_LIMBS; i++) {
+        limb_t limb = 0;
+        for (int j = 0; j < 8; j++) limb = (limb << 8) | in[i * 8 + j];
+        dest->limbs[NUM_LIMBS - 1 - i] = limb;
+    }
+}
+
 void bigint_print(const bigint256_t *src) {
     printf("0x");
     for (int i = NUM_LIMBS - 1; i >= 0; i--) printf("%016lx", src->limbs[i]);
@@ -48,6 +57,13 @@ void bigint_print_512(const bigint512_t *src) {
     printf("\n");
 }
 
+void bigint_get_bytes(uint8_t out[32], const bigint256_t *src) {
+    for (int i = 0; i < NUM_LIMBS; i++) {
+        limb_t limb = src->limbs[NUM_LIMBS - 1 - i];
+        for (int j = 0; j < 8; j++) out[i * 8 + j] = (uint8_t)(limb >> (56 - j * 8));
+    }
+}
+
 // --- ARITHMETIC ---
 
 limb_t bigint_add(bigint256_t *res, const bigint256_t *a, const bigint256_t *b) {
@@ -152,99 +168,299 @@ void bigint_mod_p(bigint256_t *dest, const bigint512_t *src) {
     }
 }
 
-// --- OPTIMIZED INVERSION (Fully Inlined Binary GCD) ---
+// --- CONSTANT-TIME INVERSION (safegcd: Bernstein-Yang divsteps) ---
+// Values are held in signed 62-bit limbs: v[0] + v[1]*2^62 + ... + v[4]*2^248.
+// Each batch runs 62 divsteps on the low bits of f, g only, producing a 2x2
+// transition matrix (scaled by 2^62) that is then applied to the full-size
+// f, g and to the Bezout coefficients d, e. 10 batches (620 divsteps) are
+// enough for any 256-bit input, so the run time does not depend on the value.
+
+typedef struct {
+    int64_t v[5];
+} signed62_t;
+
+typedef struct {
+    signed62_t modulus;
+    uint64_t modulus_inv62; // modulus^-1 mod 2^62
+} modinv_info_t;
+
+typedef struct {
+    int64_t u, v, q, r;
+} trans2x2_t;
+
+#define M62 (UINT64_MAX >> 2)
+
+// p = 2^256 - 0x1000003D1
+static const modinv_info_t MODINV_P = {
+    {{-0x1000003D1LL, 0, 0, 0, 256}},
+    0x27C7F6E22DDACACFULL
+};
+
+// n = 2^256 - 0x14551231950B75FC4402DA1732FC9BEBF
+static const modinv_info_t MODINV_N = {
+    {{0x3FD25E8CD0364141LL, 0x2ABB739ABD2280EELL, -0x15LL, 0, 256}},
+    0x34F20099AA774EC1ULL
+};
+
+static const bigint256_t SECP256K1_N = {{
+    0xBFD25E8CD0364141ULL,
+    0xBAAEDCE6AF48A03BULL,
+    0xFFFFFFFFFFFFFFFEULL,
+    0xFFFFFFFFFFFFFFFFULL
+}};
+
+static void signed62_from_bigint(signed62_t *r, const bigint256_t *a) {
+    const limb_t *l = a->limbs;
+    r->v[0] = (int64_t)(l[0] & M62);
+    r->v[1] = (int64_t)(((l[0] >> 62) | (l[1] << 2)) & M62);
+    r->v[2] = (int64_t)(((l[1] >> 60) | (l[2] << 4)) & M62);
+    r->v[3] = (int64_t)(((l[2] >> 58) | (l[3] << 6)) & M62);
+    r->v[4] = (int64_t)(l[3] >> 56);
+}
+
+static void signed62_to_bigint(bigint256_t *r, const signed62_t *a) {
+    const uint64_t v0 = a->v[0], v1 = a->v[1], v2 = a->v[2], v3 = a->v[3], v4 = a->v[4];
+    r->limbs[0] = v0 | (v1 << 62);
+    r->limbs[1] = (v1 >> 2) | (v2 << 60);
+    r->limbs[2] = (v2 >> 4) | (v3 << 58);
+    r->limbs[3] = (v3 >> 6) | (v4 << 56);
+}
+
+// 62 branch-free divsteps. zeta = -(delta + 1/2); f0, g0 are the low limbs of f, g.
+static int64_t modinv_divsteps_62(int64_t zeta, uint64_t f0, uint64_t g0, trans2x2_t *t) {
+    uint64_t u = 1, v = 0, q = 0, r = 1;
+    uint64_t f = f0, g = g0;
+    for (int i = 0; i < 62; i++) {
+        uint64_t c1 = (uint64_t)(zeta >> 63);   // all ones if delta > 0
+        uint64_t c2 = -(g & 1);                 // all ones if g is odd
+        // If delta > 0 negate f (and its row), then add it to g when g is odd
+        uint64_t x = (f ^ c1) - c1;
+        uint64_t y = (u ^ c1) - c1;
+        uint64_t z = (v ^ c1) - c1;
+        g += x & c2;
+        q += y & c2;
+        r += z & c2;
+        // Swap case (delta > 0 and g odd): f takes the old g, delta -> 1 - delta
+        c1 &= c2;
+        zeta = (zeta ^ (int64_t)c1) - 1;
+        f += g & c1;
+        u += q & c1;
+        v += r & c1;
+        // Halve g; scale the f row up instead of dividing the g row
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+    t->u = (int64_t)u; t->v = (int64_t)v;
+    t->q = (int64_t)q; t->r = (int64_t)r;
+    return zeta;
+}
+
+// [f, g] = t * [f, g] / 2^62 (the low 62 bits of the product are zero by construction)
+static void modinv_update_fg(signed62_t *f, signed62_t *g, const trans2x2_t *t) {
+    const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+    __int128 cf = (__int128)u * f->v[0] + (__int128)v * g->v[0];
+    __int128 cg = (__int128)q * f->v[0] + (__int128)r * g->v[0];
+    cf >>= 62;
+    cg >>= 62;
+    for (int i = 1; i < 5; i++) {
+        cf += (__int128)u * f->v[i] + (__int128)v * g->v[i];
+        cg += (__int128)q * f->v[i] + (__int128)r * g->v[i];
+        f->v[i - 1] = (int64_t)cf & M62; cf >>= 62;
+        g->v[i - 1] = (int64_t)cg & M62; cg >>= 62;
+    }
+    f->v[4] = (int64_t)cf;
+    g->v[4] = (int64_t)cg;
+}
+
+// [d, e] = (t * [d, e] + modulus * [md, me]) / 2^62, with md, me chosen so the
+// division is exact. Keeps d, e in (-2*modulus, modulus).
+static void modinv_update_de(signed62_t *d, signed62_t *e, const trans2x2_t *t, const modinv_info_t *mi) {
+    const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+    const int64_t *m = mi->modulus.v;
+
+    // Start md, me at [u, q] if d < 0 and [v, r] if e < 0 (keeps the output range)
+    int64_t sd = d->v[4] >> 63;
+    int64_t se = e->v[4] >> 63;
+    int64_t md = (u & sd) + (v & se);
+    int64_t me = (q & sd) + (r & se);
+
+    __int128 cd = (__int128)u * d->v[0] + (__int128)v * e->v[0];
+    __int128 ce = (__int128)q * d->v[0] + (__int128)r * e->v[0];
+
+    // Correct md, me so the bottom 62 bits cancel
+    md -= (int64_t)((mi->modulus_inv62 * (uint64_t)cd + (uint64_t)md) & M62);
+    me -= (int64_t)((mi->modulus_inv62 * (uint64_t)ce + (uint64_t)me) & M62);
+
+    cd += (__int128)m[0] * md;
+    ce += (__int128)m[0] * me;
+    cd >>= 62;
+    ce >>= 62;
+
+    for (int i = 1; i < 5; i++) {
+        cd += (__int128)u * d->v[i] + (__int128)v * e->v[i];
+        ce += (__int128)q * d->v[i] + (__int128)r * e->v[i];
+        if (m[i]) { // Depends on the (public) modulus only
+            cd += (__int128)m[i] * md;
+            ce += (__int128)m[i] * me;
+        }
+        d->v[i - 1] = (int64_t)cd & M62; cd >>= 62;
+        e->v[i - 1] = (int64_t)ce & M62; ce >>= 62;
+    }
+    d->v[4] = (int64_t)cd;
+    e->v[4] = (int64_t)ce;
+}
+
+// Bring r from (-2*modulus, modulus) to [0, modulus), negating first if sign < 0
+static void modinv_normalize(signed62_t *r, int64_t sign, const modinv_info_t *mi) {
+    const int64_t *m = mi->modulus.v;
+    int64_t v[5];
+    for (int i = 0; i < 5; i++) v[i] = r->v[i];
+
+    int64_t cond_add = v[4] >> 63;
+    for (int i = 0; i < 5; i++) v[i] += m[i] & cond_add;
+    int64_t cond_negate = sign >> 63;
+    for (int i = 0; i < 5; i++) v[i] = (v[i] ^ cond_negate) - cond_negate;
+    for (int i = 0; i < 4; i++) { v[i + 1] += v[i] >> 62; v[i] &= M62; }
+
+    cond_add = v[4] >> 63;
+    for (int i = 0; i < 5; i++) v[i] += m[i] & cond_add;
+    for (int i = 0; i < 4; i++) { v[i + 1] += v[i] >> 62; v[i] &= M62; }
+
+    for (int i = 0; i < 5; i++) r->v[i] = v[i];
+}
+
+static void modinv_ct(bigint256_t *dest, const bigint256_t *src, const modinv_info_t *mi) {
+    signed62_t d = {{0, 0, 0, 0, 0}};
+    signed62_t e = {{1, 0, 0, 0, 0}};
+    signed62_t f = mi->modulus;
+    signed62_t g;
+    int64_t zeta = -1; // delta = 1/2
+    ECIES_STAT_INC(ECIES_STAT_INV);   // Both moduli count
+
+    signed62_from_bigint(&g, src);
+    for (int i = 0; i < 10; i++) {
+        trans2x2_t t;
+        zeta = modinv_divsteps_62(zeta, (uint64_t)f.v[0], (uint64_t)g.v[0], &t);
+        modinv_update_de(&d, &e, &t, mi);
+        modinv_update_fg(&f, &g, &t);
+    }
+
+    // g is now 0 and f = +/-1 (or +/-modulus for a zero input, giving d = 0)
+    modinv_normalize(&d, f.v[4], mi);
+    signed62_to_bigint(dest, &d);
+}
+
+// Branch-free a mod m for a < 2^256 (a single subtraction suffices for p and n)
+static void bigint_reduce_once(bigint256_t *r, const bigint256_t *a, const bigint256_t *m) {
+    bigint256_t t;
+    limb_t borrow = bigint_sub(&t, a, m);
+    limb_t mask = borrow - 1; // all ones if a >= m
+    for (int i = 0; i < NUM_LIMBS; i++) r->limbs[i] = (t.limbs[i] & mask) | (a->limbs[i] & ~mask);
+}
+
 static int bigint_is_zero(const bigint256_t *a) {
     return (a->limbs[0] | a->limbs[1] | a->limbs[2] | a->limbs[3]) == 0;
 }
 
 void bigint_inv_mod_p(bigint256_t *dest, const bigint256_t *src) {
-    if (bigint_is_zero(src)) { memset(dest, 0, sizeof(bigint256_t)); return; }
+    bigint256_t a;
+    bigint_reduce_once(&a, src, &SECP256K1_P);
+    modinv_ct(dest, &a, &MODINV_P);
+}
 
-    bigint256_t u = *src;
-    bigint256_t v = SECP256K1_P;
-    bigint256_t x1, x2;
-    memset(&x1, 0, sizeof(bigint256_t)); x1.limbs[0] = 1;
-    memset(&x2, 0, sizeof(bigint256_t));
+void bigint_inv_mod_n(bigint256_t *dest, const bigint256_t *src) {
+    bigint256_t a;
+    bigint_reduce_once(&a, src, &SECP256K1_N);
+    modinv_ct(dest, &a, &MODINV_N);
+}
 
-    // We process until u or v is 0. 
-    // Inlining shifts and adds to remove function call overhead.
-    while (!bigint_is_zero(&u) && !bigint_is_zero(&v)) {
-        
-        // 1. Shift u while even
-        while ((u.limbs[0] & 1) == 0) {
-            // u = u >> 1
-            limb_t carry = 0;
-            // Unrolled loop for 4 limbs
-            limb_t n3 = (u.limbs[3] & 1) << 63; u.limbs[3] = (u.limbs[3] >> 1) | carry; carry = n3;
-            limb_t n2 = (u.limbs[2] & 1) << 63; u.limbs[2] = (u.limbs[2] >> 1) | carry; carry = n2;
-            limb_t n1 = (u.limbs[1] & 1) << 63; u.limbs[1] = (u.limbs[1] >> 1) | carry; carry = n1;
-            /* n0 */                            u.limbs[0] = (u.limbs[0] >> 1) | carry;
-
-            // If x1 even: x1 = x1 >> 1
-            if ((x1.limbs[0] & 1) == 0) {
-                carry = 0;
-                n3 = (x1.limbs[3] & 1) << 63; x1.limbs[3] = (x1.limbs[3] >> 1) | carry; carry = n3;
-                n2 = (x1.limbs[2] & 1) << 63; x1.limbs[2] = (x1.limbs[2] >> 1) | carry; carry = n2;
-                n1 = (x1.limbs[1] & 1) << 63; x1.limbs[1] = (x1.limbs[1] >> 1) | carry; carry = n1;
-                                              x1.limbs[0] = (x1.limbs[0] >> 1) | carry;
-            } else {
-                // x1 = (x1 + P) >> 1
-                limb_t add_carry = 0;
-                // Inline Add P
-                dlimb_t sum = (dlimb_t)x1.limbs[0] + SECP256K1_P.limbs[0]; x1.limbs[0] = (limb_t)sum; add_carry = (limb_t)(sum >> 64);
-                sum = (dlimb_t)x1.limbs[1] + SECP256K1_P.limbs[1] + add_carry; x1.limbs[1] = (limb_t)sum; add_carry = (limb_t)(sum >> 64);
-                sum = (dlimb_t)x1.limbs[2] + SECP256K1_P.limbs[2] + add_carry; x1.limbs[2] = (limb_t)sum; add_carry = (limb_t)(sum >> 64);
-                sum = (dlimb_t)x1.limbs[3] + SECP256K1_P.limbs[3] + add_carry; x1.limbs[3] = (limb_t)sum; add_carry = (limb_t)(sum >> 64);
-                
-                // Now Shift
-                carry = add_carry << 63; // The overflow bit from addition becomes MSB
-                n3 = (x1.limbs[3] & 1) << 63; x1.limbs[3] = (x1.limbs[3] >> 1) | carry; carry = n3;
-                n2 = (x1.limbs[2] & 1) << 63; x1.limbs[2] = (x1.limbs[2] >> 1) | carry; carry = n2;
-                n1 = (x1.limbs[1] & 1) << 63; x1.limbs[1] = (x1.limbs[1] >> 1) | carry; carry = n1;
-                                              x1.limbs[0] = (x1.limbs[0] >> 1) | carry;
-            }
-        }
+// --- SCALAR ARITHMETIC (mod n) ---
+
+// 2^256 - n (129 bits)
+static const limb_t SECP256K1_N_C[3] = {
+    0x402DA1732FC9BEBFULL, 0x4551231950B75FC4ULL, 0x1ULL
+};
 
-        // 2. Shift v while even
-        while ((v.limbs[0] & 1) == 0) {
-            // v = v >> 1
+// Fixed number of folds hi * 2^256 -> hi * (2^256 - n), then one conditional subtraction
+void bigint_mod_n(bigint256_t *dest, const bigint512_t *src) {
+    limb_t t[NUM_LIMBS * 2];
+    for (int i = 0; i < NUM_LIMBS * 2; i++) t[i] = src->limbs[i];
+
+    // 512 -> 386 -> 260 -> 257 -> 256 bits
+    for (int round = 0; round < 4; round++) {
+        limb_t hi[NUM_LIMBS];
+        for (int i = 0; i < NUM_LIMBS; i++) { hi[i] = t[NUM_LIMBS + i]; t[NUM_LIMBS + i] = 0; }
+
+        for (int i = 0; i < NUM_LIMBS; i++) {
             limb_t carry = 0;
-            limb_t n3 = (v.limbs[3] & 1) << 63; v.limbs[3] = (v.limbs[3] >> 1) | carry; carry = n3;
-            limb_t n2 = (v.limbs[2] & 1) << 63; v.limbs[2] = (v.limbs[2] >> 1) | carry; carry = n2;
-            limb_t n1 = (v.limbs[1] & 1) << 63; v.limbs[1] = (v.limbs[1] >> 1) | carry; carry = n1;
-                                                v.limbs[0] = (v.limbs[0] >> 1) | carry;
-
-            if ((x2.limbs[0] & 1) == 0) {
-                carry = 0;
-                n3 = (x2.limbs[3] & 1) << 63; x2.limbs[3] = (x2.limbs[3] >> 1) | carry; carry = n3;
-                n2 = (x2.limbs[2] & 1) << 63; x2.limbs[2] = (x2.limbs[2] >> 1) | carry; carry = n2;
-                n1 = (x2.limbs[1] & 1) << 63; x2.limbs[1] = (x2.limbs[1] >> 1) | carry; carry = n1;
-                                              x2.limbs[0] = (x2.limbs[0] >> 1) | carry;
-            } else {
-                limb_t add_carry = 0;
-                dlimb_t sum = (dlimb_t)x2.limbs[0] + SECP256K1_P.limbs[0]; x2.limbs[0] = (limb_t)sum; add_carry = (limb_t)(sum >> 64);
-                sum = (dlimb_t)x2.limbs[1] + SECP256K1_P.limbs[1] + add_carry; x2.limbs[1] = (limb_t)sum; add_carry = (limb_t)(sum >> 64);
-                sum = (dlimb_t)x2.limbs[2] + SECP256K1_P.limbs[2] + add_carry; x2.limbs[2] = (limb_t)sum; add_carry = (limb_t)(sum >> 64);
-                sum = (dlimb_t)x2.limbs[3] + SECP256K1_P.limbs[3] + add_carry; x2.limbs[3] = (limb_t)sum; add_carry = (limb_t)(sum >> 64);
-                
-                carry = add_carry << 63;
-                n3 = (x2.limbs[3] & 1) << 63; x2.limbs[3] = (x2.limbs[3] >> 1) | carry; carry = n3;
-                n2 = (x2.limbs[2] & 1) << 63; x2.limbs[2] = (x2.limbs[2] >> 1) | carry; carry = n2;
-                n1 = (x2.limbs[1] & 1) << 63; x2.limbs[1] = (x2.limbs[1] >> 1) | carry; carry = n1;
-                                              x2.limbs[0] = (x2.limbs[0] >> 1) | carry;
+            for (int j = 0; j < 3; j++) {
+                dlimb_t sum = (dlimb_t)hi[i] * SECP256K1_N_C[j] + t[i + j] + carry;
+                t[i + j] = (limb_t)sum;
+                carry = (limb_t)(sum >> 64);
+            }
+            for (int k = i + 3; k < NUM_LIMBS * 2; k++) {
+                dlimb_t sum = (dlimb_t)t[k] + carry;
+                t[k] = (limb_t)sum;
+                carry = (limb_t)(sum >> 64);
             }
         }
+    }
 
-        // 3. Subtract
-        if (bigint_ge(&u, &v)) {
-            bigint_sub(&u, &u, &v);
-            if (bigint_sub(&x1, &x1, &x2)) bigint_add(&x1, &x1, &SECP256K1_P);
-        } else {
-            bigint_sub(&v, &v, &u);
-            if (bigint_sub(&x2, &x2, &x1)) bigint_add(&x2, &x2, &SECP256K1_P);
-        }
+    bigint256_t lo;
+    for (int i = 0; i < NUM_LIMBS; i++) lo.limbs[i] = t[i];
+    bigint_reduce_once(dest, &lo, &SECP256K1_N);
+}
+
+void bigint_add_mod_n(bigint256_t *res, const bigint256_t *a, const bigint256_t *b) {
+    bigint256_t sum, t;
+    limb_t carry = bigint_add(&sum, a, b);
+    limb_t borrow = bigint_sub(&t, &sum, &SECP256K1_N);
+    // Keep the reduced value if the sum overflowed 2^256 or is >= n
+    limb_t mask = (limb_t)0 - (limb_t)(carry | (borrow ^ 1));
+    for (int i = 0; i < NUM_LIMBS; i++) res->limbs[i] = (t.limbs[i] & mask) | (sum.limbs[i] & ~mask);
+}
+
+void bigint_neg_mod_n(bigint256_t *res, const bigint256_t *a) {
+    bigint256_t t;
+    bigint_sub(&t, &SECP256K1_N, a);
+    // -0 is 0, not n
+    limb_t nz = a->limbs[0] | a->limbs[1] | a->limbs[2] | a->limbs[3];
+    limb_t mask = (limb_t)0 - (limb_t)(nz != 0);
+    for (int i = 0; i < NUM_LIMBS; i++) res->limbs[i] = t.limbs[i] & mask;
+}
+
+void bigint_mul_mod_n(bigint256_t *res, const bigint256_t *a, const bigint256_t *b) {
+    bigint512_t tmp_mul;
+    bigint_mul(&tmp_mul, a, b);
+    bigint_mod_n(res, &tmp_mul);
+}
+
+// --- BATCH INVERSION (Montgomery's trick) ---
+// One inversion for the whole array plus 3 multiplications per element.
+// Zero entries are skipped and map to zero. dest must not overlap src.
+void bigint_batch_inv_mod_p(bigint256_t *dest, const bigint256_t *src, size_t n) {
+    bigint512_t tmp_mul;
+    bigint256_t acc, inv, t;
+
+    // Forward pass: dest[i] = product of all non-zero src[j], j < i
+    memset(&acc, 0, sizeof(acc)); acc.limbs[0] = 1;
+    for (size_t i = 0; i < n; i++) {
+        dest[i] = acc;
+        if (bigint_is_zero(&src[i])) continue;
+        bigint_mul(&tmp_mul, &acc, &src[i]);
+        bigint_mod_p(&acc, &tmp_mul);
     }
 
-    if (bigint_is_zero(&v)) *dest = x1;
-    else *dest = x2;
+    bigint_inv_mod_p(&inv, &acc);
+
+    // Backward pass: inv holds the inverse of the prefix product ending at i
+    for (size_t i = n; i-- > 0; ) {
+        if (bigint_is_zero(&src[i])) { memset(&dest[i], 0, sizeof(bigint256_t)); continue; }
+        bigint_mul(&tmp_mul, &inv, &dest[i]);
+        bigint_mod_p(&t, &tmp_mul);
+        bigint_mul(&tmp_mul, &inv, &src[i]);
+        bigint_mod_p(&inv, &tmp_mul);
+        dest[i] = t;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "cpu.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+
+// XCR0: the OS must save the XMM (bit 1) and YMM (bit 2) state for AVX to be usable
+static unsigned int cpu_xgetbv0(void) {
+    unsigned int eax, edx;
+    __asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+}
+
+static unsigned int cpu_probe(void) {
+    unsigned int eax, ebx, ecx, edx, f = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+
+    if (ecx & (1u << 9))  f |= CPU_SSSE3;
+    if (ecx & (1u << 19)) f |= CPU_SSE41;
+    if (ecx & (1u << 25)) f |= CPU_AESNI;
+    if (ecx & (1u << 1))  f |= CPU_PCLMUL;
+    int avx = (ecx & (1u << 27)) && (ecx & (1u << 28)) && (cpu_xgetbv0() & 6) == 6;
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        if (avx && (ebx & (1u << 5))) f |= CPU_AVX2;
+        if (ebx & (1u << 8))  f |= CPU_BMI2;
+        if (ebx & (1u << 29)) f |= CPU_SHA;
+    }
+    return f;
+}
+#else
+static unsigned int cpu_probe(void) {
+    return 0;
+}
+#endif
+
+// Set in the cache once it is filled, so one atomic word holds everything
+#define CPU_PROBED (1u << 31)
+
+unsigned int cpu_features(void) {
+    // Racing first callers all probe and store the same value
+    static unsigned int cache = 0;
+    unsigned int f = __atomic_load_n(&cache, __ATOMIC_RELAXED);
+    if (!(f & CPU_PROBED)) {
+        f = cpu_probe() | CPU_PROBED;
+        __atomic_store_n(&cache, f, __ATOMIC_RELAXED);
+    }
+    return f & ~CPU_PROBED;
+}
+
+int cpu_has(unsigned int mask) {
+    return (cpu_features() & mask) == mask;
+}
\ No newline at end of file
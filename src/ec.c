@@ -1,19 +1,26 @@
 #include "ec.h"
+#include "ecies_stats.h"
 #include <stdio.h>
 #include <string.h>
 
-static int bigint_eq(const bigint256_t *a, const bigint256_t *b) {
-    for(int i=0; i<NUM_LIMBS; i++) if(a->limbs[i] != b->limbs[i]) return 0;
-    return 1;
-}
+// --- CONSTANTS ---
+static const bigint256_t SECP256K1_GX = {{
+    0x59F2815B16F81798ULL,
+    0x029BFCDB2DCE28D9ULL,
+    0x55A06295CE870B07ULL,
+    0x79BE667EF9DCBBACULL
+}};
 
-static void set_p(bigint256_t *p) {
-    bigint_set_hex(p, "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
-}
+static const bigint256_t SECP256K1_GY = {{
+    0x9C47D08FFB10D4B8ULL,
+    0xFD17B448A6855419ULL,
+    0x5DA4FBFC0E1108A8ULL,
+    0x483ADA7726A3C465ULL
+}};
 
 void ec_init_g(ec_point_t *g) {
-    bigint_set_hex(&g->x, "79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798");
-    bigint_set_hex(&g->y, "483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8");
+    g->x = SECP256K1_GX;
+    g->y = SECP256K1_GY;
     g->is_infinity = 0;
 }
 
@@ -27,121 +34,440 @@ void ec_print(const char *name, const ec_point_t *p) {
     }
 }
 
-void ec_double(ec_point_t *res, const ec_point_t *p) {
-    if (p->is_infinity) { res->is_infinity = 1; return; }
+// --- VALIDATION ---
 
-    bigint512_t tmp_mul;
-    bigint256_t x2, num, den, lambda;
-    bigint256_t prime;
-    set_p(&prime);
+int ec_is_on_curve(const ec_point_t *p) {
+    if (p->is_infinity) return 0;
 
-    bigint_mul(&tmp_mul, &p->x, &p->x);
-    bigint_mod_p(&x2, &tmp_mul);
+    fe_t x, y, lhs, rhs, seven;
+    bigint256_t cx, cy;
+    fe_set_bigint(&x, &p->x);
+    fe_set_bigint(&y, &p->y);
+    fe_normalize(&x);
+    fe_normalize(&y);
 
-    bigint256_t three;
-    bigint_set_hex(&three, "3");
-    bigint_mul(&tmp_mul, &three, &x2);
-    bigint_mod_p(&num, &tmp_mul);
+    // Normalizing reduces anything >= p, so a round trip catches non-canonical coordinates
+    fe_get_bigint(&cx, &x);
+    fe_get_bigint(&cy, &y);
+    if (memcmp(&cx, &p->x, sizeof(cx)) != 0 || memcmp(&cy, &p->y, sizeof(cy)) != 0) return 0;
 
-    bigint256_t two;
-    bigint_set_hex(&two, "2");
-    bigint_mul(&tmp_mul, &two, &p->y);
-    bigint_mod_p(&den, &tmp_mul);
+    fe_sqr(&lhs, &y);
+    fe_sqr(&rhs, &x);
+    fe_mul(&rhs, &rhs, &x);
+    fe_set_int(&seven, 7);
+    fe_add(&rhs, &seven);
+    fe_normalize(&lhs);
+    fe_normalize(&rhs);
+    return fe_equal(&lhs, &rhs);
+}
 
-    bigint256_t inv_den;
-    bigint_inv_mod_p(&inv_den, &den);
-    bigint_mul(&tmp_mul, &num, &inv_den);
-    bigint_mod_p(&lambda, &tmp_mul);
+// --- CONVERSIONS ---
 
-    bigint256_t x3;
-    bigint_mul(&tmp_mul, &lambda, &lambda); 
-    bigint_mod_p(&x3, &tmp_mul);
+void ec_apoint_set(ec_apoint_t *res, const ec_point_t *p) {
+    fe_set_bigint(&res->x, &p->x);
+    fe_set_bigint(&res->y, &p->y);
+    res->is_infinity = p->is_infinity;
+}
 
-    if (bigint_sub(&x3, &x3, &p->x)) bigint_add(&x3, &x3, &prime);
-    if (bigint_sub(&x3, &x3, &p->x)) bigint_add(&x3, &x3, &prime);
+void ec_apoint_get(ec_point_t *res, const ec_apoint_t *p) {
+    if (p->is_infinity) { memset(res, 0, sizeof(*res)); res->is_infinity = 1; return; }
+    fe_get_bigint(&res->x, &p->x);
+    fe_get_bigint(&res->y, &p->y);
+    res->is_infinity = 0;
+}
 
-    bigint256_t y3, dx;
-    dx = p->x;
-    if (bigint_sub(&dx, &dx, &x3)) bigint_add(&dx, &dx, &prime);
+void ec_jacobian_from_affine(ec_jpoint_t *res, const ec_apoint_t *p) {
+    res->x = p->x;
+    res->y = p->y;
+    fe_set_int(&res->z, 1);
+    res->is_infinity = p->is_infinity;
+}
 
-    bigint_mul(&tmp_mul, &lambda, &dx);
-    bigint_mod_p(&y3, &tmp_mul);
+void ec_jacobian_to_affine(ec_apoint_t *res, const ec_jpoint_t *p) {
+    if (p->is_infinity) { memset(res, 0, sizeof(*res)); res->is_infinity = 1; return; }
 
-    if (bigint_sub(&y3, &y3, &p->y)) bigint_add(&y3, &y3, &prime);
+    fe_t z_inv, z_inv2, z_inv3;
+    fe_inv(&z_inv, &p->z);
+    fe_sqr(&z_inv2, &z_inv);
+    fe_mul(&z_inv3, &z_inv2, &z_inv);
 
-    res->x = x3;
-    res->y = y3;
+    fe_mul(&res->x, &p->x, &z_inv2);
+    fe_mul(&res->y, &p->y, &z_inv3);
+    fe_normalize(&res->x);
+    fe_normalize(&res->y);
     res->is_infinity = 0;
 }
 
-void ec_add(ec_point_t *res, const ec_point_t *p, const ec_point_t *q) {
-    if (p->is_infinity) { *res = *q; return; }
+// Normalize n Jacobian points with one shared inversion (Montgomery's trick).
+// Points at infinity are passed through. res must not overlap p.
+void ec_batch_to_affine(ec_apoint_t *res, const ec_jpoint_t *p, size_t n) {
+    fe_t acc, inv, z_inv, z_inv2;
+
+    // Forward pass: stash the running product of the Z's in res[i].x
+    fe_set_int(&acc, 1);
+    for (size_t i = 0; i < n; i++) {
+        if (p[i].is_infinity) continue;
+        res[i].x = acc;
+        fe_mul(&acc, &acc, &p[i].z);
+    }
+
+    fe_inv(&inv, &acc);
+
+    for (size_t i = n; i-- > 0; ) {
+        if (p[i].is_infinity) { memset(&res[i], 0, sizeof(res[i])); res[i].is_infinity = 1; continue; }
+        fe_mul(&z_inv, &inv, &res[i].x);
+        fe_mul(&inv, &inv, &p[i].z);
+
+        fe_sqr(&z_inv2, &z_inv);
+        fe_mul(&res[i].x, &p[i].x, &z_inv2);
+        fe_mul(&z_inv2, &z_inv2, &z_inv);
+        fe_mul(&res[i].y, &p[i].y, &z_inv2);
+        fe_normalize(&res[i].x);
+        fe_normalize(&res[i].y);
+        res[i].is_infinity = 0;
+    }
+}
+
+// --- JACOBIAN ARITHMETIC ---
+// Coordinates of ec_jpoint_t are kept at magnitude 1 between operations.
+
+// dbl-2009-l: 2M + 5S
+void ec_jdouble(ec_jpoint_t *res, const ec_jpoint_t *p) {
+    ECIES_STAT_INC(ECIES_STAT_POINT_DOUBLE);
+    if (p->is_infinity || fe_normalizes_to_zero(&p->y)) { res->is_infinity = 1; return; }
+
+    fe_t a, b, c, d, e, f, t;
+    fe_sqr(&a, &p->x);                 // A = X^2
+    fe_sqr(&b, &p->y);                 // B = Y^2
+    fe_sqr(&c, &b);                    // C = B^2
+
+    t = p->x; fe_add(&t, &b);          // D = 2 * ((X + B)^2 - A - C)
+    fe_sqr(&d, &t);
+    fe_negate(&t, &a, 1); fe_add(&d, &t);
+    fe_negate(&t, &c, 1); fe_add(&d, &t);
+    fe_mul_int(&d, 2);
+    fe_normalize_weak(&d);
+
+    e = a; fe_mul_int(&e, 3);          // E = 3A
+    fe_sqr(&f, &e);                    // F = E^2
+
+    // Z3 first: res may alias p
+    fe_mul(&res->z, &p->y, &p->z);     // Z3 = 2 * Y * Z
+    fe_mul_int(&res->z, 2);
+    fe_normalize_weak(&res->z);
+
+    fe_negate(&t, &d, 1);              // X3 = F - 2D
+    fe_mul_int(&t, 2);
+    res->x = f; fe_add(&res->x, &t);
+    fe_normalize_weak(&res->x);
+
+    fe_negate(&t, &res->x, 1);         // Y3 = E * (D - X3) - 8C
+    fe_add(&t, &d);
+    fe_mul(&res->y, &e, &t);
+    fe_negate(&t, &c, 1);
+    fe_mul_int(&t, 8);
+    fe_add(&res->y, &t);
+    fe_normalize_weak(&res->y);
+    res->is_infinity = 0;
+}
+
+// madd-2004-hmv: 8M + 3S
+void ec_jadd_mixed(ec_jpoint_t *res, const ec_jpoint_t *p, const ec_apoint_t *q) {
+    ECIES_STAT_INC(ECIES_STAT_POINT_ADD);
     if (q->is_infinity) { *res = *p; return; }
+    if (p->is_infinity) { ec_jacobian_from_affine(res, q); return; }
 
-    if (bigint_eq(&p->x, &q->x)) {
-        if (bigint_eq(&p->y, &q->y)) {
-            ec_double(res, p);
-            return;
-        } else {
-            res->is_infinity = 1;
-            return;
-        }
+    fe_t z2, z3, u2, s2, h, r, t;
+    fe_sqr(&z2, &p->z);
+    fe_mul(&z3, &z2, &p->z);
+    fe_mul(&u2, &q->x, &z2);           // U2 = x2 * Z1^2
+    fe_mul(&s2, &q->y, &z3);           // S2 = y2 * Z1^3
+    fe_negate(&h, &p->x, 1); fe_add(&h, &u2);   // H = U2 - X1
+    fe_negate(&r, &p->y, 1); fe_add(&r, &s2);   // R = S2 - Y1
+
+    if (fe_normalizes_to_zero(&h)) {
+        // Same x: either P == Q (double) or P == -Q (infinity)
+        if (fe_normalizes_to_zero(&r)) ec_jdouble(res, p);
+        else res->is_infinity = 1;
+        return;
     }
 
-    bigint256_t prime;
-    set_p(&prime);
+    fe_t h2, h3, v;
+    fe_sqr(&h2, &h);
+    fe_mul(&h3, &h2, &h);
+    fe_mul(&v, &p->x, &h2);            // V = X1 * H^2
 
-    bigint256_t num, den, lambda;
-    num = q->y;
-    if (bigint_sub(&num, &num, &p->y)) bigint_add(&num, &num, &prime);
+    fe_mul(&res->z, &p->z, &h);        // Z3 = Z1 * H
+    fe_mul(&t, &p->y, &h3);            // Y1 * H^3 (p->y is read before overwrite)
 
-    den = q->x;
-    if (bigint_sub(&den, &den, &p->x)) bigint_add(&den, &den, &prime);
+    fe_sqr(&res->x, &r);               // X3 = R^2 - H^3 - 2V
+    fe_negate(&h3, &h3, 1); fe_add(&res->x, &h3);
+    fe_negate(&h2, &v, 1); fe_mul_int(&h2, 2); fe_add(&res->x, &h2);
+    fe_normalize_weak(&res->x);
 
-    bigint256_t inv_den;
-    bigint_inv_mod_p(&inv_den, &den);
+    fe_negate(&h2, &res->x, 1);        // Y3 = R * (V - X3) - Y1 * H^3
+    fe_add(&h2, &v);
+    fe_mul(&res->y, &r, &h2);
+    fe_negate(&t, &t, 1);
+    fe_add(&res->y, &t);
+    fe_normalize_weak(&res->y);
+    res->is_infinity = 0;
+}
 
-    bigint512_t tmp_mul;
-    bigint_mul(&tmp_mul, &num, &inv_den);
-    bigint_mod_p(&lambda, &tmp_mul);
+// add-1998-cmo-2: 12M + 4S
+void ec_jadd(ec_jpoint_t *res, const ec_jpoint_t *p, const ec_jpoint_t *q) {
+    ECIES_STAT_INC(ECIES_STAT_POINT_ADD);
+    if (q->is_infinity) { *res = *p; return; }
+    if (p->is_infinity) { *res = *q; return; }
 
-    bigint256_t x3;
-    bigint_mul(&tmp_mul, &lambda, &lambda);
-    bigint_mod_p(&x3, &tmp_mul);
+    fe_t z1z1, z2z2, u1, u2, s1, s2, h, r, t;
+    fe_sqr(&z1z1, &p->z);
+    fe_sqr(&z2z2, &q->z);
+    fe_mul(&u1, &p->x, &z2z2);         // U1 = X1 * Z2^2
+    fe_mul(&u2, &q->x, &z1z1);         // U2 = X2 * Z1^2
+    fe_mul(&s1, &p->y, &q->z);         // S1 = Y1 * Z2^3
+    fe_mul(&s1, &s1, &z2z2);
+    fe_mul(&s2, &q->y, &p->z);         // S2 = Y2 * Z1^3
+    fe_mul(&s2, &s2, &z1z1);
+    fe_negate(&h, &u1, 1); fe_add(&h, &u2);     // H = U2 - U1
+    fe_negate(&r, &s1, 1); fe_add(&r, &s2);     // R = S2 - S1
 
-    if (bigint_sub(&x3, &x3, &p->x)) bigint_add(&x3, &x3, &prime);
-    if (bigint_sub(&x3, &x3, &q->x)) bigint_add(&x3, &x3, &prime);
+    if (fe_normalizes_to_zero(&h)) {
+        if (fe_normalizes_to_zero(&r)) ec_jdouble(res, p);
+        else res->is_infinity = 1;
+        return;
+    }
 
-    bigint256_t y3, dx;
-    dx = p->x;
-    if (bigint_sub(&dx, &dx, &x3)) bigint_add(&dx, &dx, &prime);
+    fe_t h2, h3, v;
+    fe_sqr(&h2, &h);
+    fe_mul(&h3, &h2, &h);
+    fe_mul(&v, &u1, &h2);              // V = U1 * H^2
 
-    bigint_mul(&tmp_mul, &lambda, &dx);
-    bigint_mod_p(&y3, &tmp_mul);
+    fe_mul(&t, &p->z, &q->z);          // Z3 = Z1 * Z2 * H
+    fe_mul(&res->z, &t, &h);
 
-    if (bigint_sub(&y3, &y3, &p->y)) bigint_add(&y3, &y3, &prime);
+    fe_sqr(&res->x, &r);               // X3 = R^2 - H^3 - 2V
+    fe_negate(&t, &h3, 1); fe_add(&res->x, &t);
+    fe_negate(&t, &v, 1); fe_mul_int(&t, 2); fe_add(&res->x, &t);
+    fe_normalize_weak(&res->x);
 
-    res->x = x3;
-    res->y = y3;
+    fe_negate(&t, &res->x, 1);         // Y3 = R * (V - X3) - S1 * H^3
+    fe_add(&t, &v);
+    fe_mul(&res->y, &r, &t);
+    fe_mul(&t, &s1, &h3);
+    fe_negate(&t, &t, 1);
+    fe_add(&res->y, &t);
+    fe_normalize_weak(&res->y);
     res->is_infinity = 0;
 }
 
-// Result = k * P (Double-and-Add Algorithm)
+// --- AFFINE API ---
+
+void ec_double(ec_point_t *res, const ec_point_t *p) {
+    ec_apoint_t a;
+    ec_jpoint_t j;
+    ec_apoint_set(&a, p);
+    ec_jacobian_from_affine(&j, &a);
+    ec_jdouble(&j, &j);
+    ec_jacobian_to_affine(&a, &j);
+    ec_apoint_get(res, &a);
+}
+
+void ec_add(ec_point_t *res, const ec_point_t *p, const ec_point_t *q) {
+    ec_apoint_t a, b;
+    ec_jpoint_t j;
+    ec_apoint_set(&a, p);
+    ec_apoint_set(&b, q);
+    ec_jacobian_from_affine(&j, &a);
+    ec_jadd_mixed(&j, &j, &b);
+    ec_jacobian_to_affine(&a, &j);
+    ec_apoint_get(res, &a);
+}
+
+// --- VARIABLE-BASE MULTIPLICATION (wNAF) ---
+
+#define EC_WNAF_W     5
+#define EC_WNAF_TABLE (1 << (EC_WNAF_W - 2))  // P, 3P, ..., 15P
+#define EC_WNAF_LEN   257                     // 256 bits plus a final carry
+
+// Read count (<= 31) bits of k starting at bit; bits past 255 read as zero
+static unsigned int ec_scalar_bits(const bigint256_t *k, int bit, int count) {
+    if (bit >= 256) return 0;
+    int limb = bit / 64, shift = bit % 64;
+    uint64_t v = k->limbs[limb] >> shift;
+    if (shift + count > 64 && limb + 1 < NUM_LIMBS) v |= k->limbs[limb + 1] << (64 - shift);
+    return (unsigned int)(v & ((1u << count) - 1));
+}
+
+// Width-w NAF: every non-zero digit is odd, |digit| < 2^(w-1), and any two
+// non-zero digits are at least w positions apart. Returns the digit count.
+int ec_wnaf(int *wnaf, const bigint256_t *k, int w) {
+    int carry = 0, last_set_bit = -1;
+    memset(wnaf, 0, EC_WNAF_LEN * sizeof(int));
+
+    int bit = 0;
+    while (bit < EC_WNAF_LEN) {
+        if (ec_scalar_bits(k, bit, 1) == (unsigned int)carry) { bit++; continue; }
+
+        int now = w;
+        if (now > EC_WNAF_LEN - bit) now = EC_WNAF_LEN - bit;
+        int word = (int)ec_scalar_bits(k, bit, now) + carry;
+        carry = (word >> (w - 1)) & 1;
+        word -= carry << w;
+        wnaf[bit] = word;
+        last_set_bit = bit;
+        bit += now;
+    }
+    return last_set_bit + 1;
+}
+
+// Odd multiples P, 3P, 5P, ... in affine form with one shared inversion
+void ec_odd_multiples(ec_apoint_t *table, const ec_apoint_t *p, int n) {
+    ec_jpoint_t j[EC_WNAF_TABLE * 4];
+    ec_jpoint_t d;
+
+    ec_jacobian_from_affine(&j[0], p);
+    ec_jdouble(&d, &j[0]);
+    for (int i = 1; i < n; i++) ec_jadd(&j[i], &j[i - 1], &d);
+    ec_batch_to_affine(table, j, n);
+}
+
+void ec_apoint_neg(ec_apoint_t *r, const ec_apoint_t *a) {
+    r->x = a->x;
+    fe_negate(&r->y, &a->y, 1);
+    fe_normalize(&r->y);
+    r->is_infinity = a->is_infinity;
+}
+
+// --- GLV ENDOMORPHISM ---
+// lambda * (x, y) = (beta * x, y), with lambda^3 = 1 mod n and beta^3 = 1 mod p.
+// k = k1 + k2 * lambda (mod n) with |k1|, |k2| < 2^128 halves the doublings.
+
+static const bigint256_t GLV_LAMBDA = {{
+    0xDF02967C1B23BD72ULL, 0x122E22EA20816678ULL, 0xA5261C028812645AULL, 0x5363AD4CC05C30E0ULL
+}};
+
+static const fe_t GLV_BETA = {{
+    0x96C28719501EEULL, 0x7512F58995C13ULL, 0xC3434E99CF049ULL, 0x7106E64479EAULL, 0x7AE96A2B657CULL
+}};
+
+// Lattice basis: -b1, -b2 and g_i = round(2^384 * b_i / n)
+static const bigint256_t GLV_MINUS_B1 = {{
+    0x6F547FA90ABFE4C3ULL, 0xE4437ED6010E8828ULL, 0, 0
+}};
+static const bigint256_t GLV_MINUS_B2 = {{
+    0xD765CDA83DB1562CULL, 0x8A280AC50774346DULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL
+}};
+static const bigint256_t GLV_G1 = {{
+    0xE893209A45DBB031ULL, 0x3DAA8A1471E8CA7FULL, 0xE86C90E49284EB15ULL, 0x3086D221A7D46BCDULL
+}};
+static const bigint256_t GLV_G2 = {{
+    0x1571B4AE8AC47F71ULL, 0x221208AC9DF506C6ULL, 0x6F547FA90ABFE4C4ULL, 0xE4437ED6010E8828ULL
+}};
+
+// n / 2: scalars above this are "negative" and get negated before recoding
+static const bigint256_t SECP256K1_N_HALF = {{
+    0xDFE92F46681B20A0ULL, 0x5D576E7357A4501DULL, 0xFFFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL
+}};
+
+// round(a * b / 2^384)
+static void glv_mul_shift_384(bigint256_t *r, const bigint256_t *a, const bigint256_t *b) {
+    bigint512_t prod;
+    bigint_mul(&prod, a, b);
+    r->limbs[0] = prod.limbs[6];
+    r->limbs[1] = prod.limbs[7];
+    r->limbs[2] = 0;
+    r->limbs[3] = 0;
+    limb_t round_bit = prod.limbs[5] >> 63;
+    dlimb_t sum = (dlimb_t)r->limbs[0] + round_bit;
+    r->limbs[0] = (limb_t)sum;
+    r->limbs[1] += (limb_t)(sum >> 64);
+}
+
+void ec_scalar_split_lambda(bigint256_t *k1, bigint256_t *k2, const bigint256_t *k) {
+    bigint256_t kr, c1, c2, t;
+    bigint512_t wide;
+
+    // Reduce k mod n first (k may be any 256-bit value)
+    memset(&wide, 0, sizeof(wide));
+    memcpy(wide.limbs, k->limbs, sizeof(k->limbs));
+    bigint_mod_n(&kr, &wide);
+
+    glv_mul_shift_384(&c1, &kr, &GLV_G1);
+    glv_mul_shift_384(&c2, &kr, &GLV_G2);
+    bigint_mul_mod_n(&c1, &c1, &GLV_MINUS_B1);
+    bigint_mul_mod_n(&c2, &c2, &GLV_MINUS_B2);
+    bigint_add_mod_n(k2, &c1, &c2);              // k2 = c1 * (-b1) + c2 * (-b2)
+
+    bigint_mul_mod_n(&t, k2, &GLV_LAMBDA);       // k1 = k - k2 * lambda
+    bigint_neg_mod_n(&t, &t);
+    bigint_add_mod_n(k1, &kr, &t);
+}
+
+// k > n/2 exactly when n/2 - k borrows (constant time)
+int ec_scalar_is_high(const bigint256_t *k) {
+    bigint256_t t;
+    return (int)bigint_sub(&t, &SECP256K1_N_HALF, k);
+}
+
+void ec_apoint_mul_lambda(ec_apoint_t *r, const ec_apoint_t *p) {
+    fe_mul(&r->x, &p->x, &GLV_BETA);
+    fe_normalize(&r->x);
+    r->y = p->y;
+    r->is_infinity = p->is_infinity;
+}
+
+// Recode a split half: negate it (and remember the sign) if it is above n/2
+static int ec_wnaf_signed(int *wnaf, const bigint256_t *k, int w) {
+    bigint256_t a = *k;
+    int sign = 1;
+    if (ec_scalar_is_high(&a)) { bigint_neg_mod_n(&a, &a); sign = -1; }
+    int len = ec_wnaf(wnaf, &a, w);
+    if (sign < 0) for (int i = 0; i < len; i++) wnaf[i] = -wnaf[i];
+    return len;
+}
+
+void ec_jadd_digit(ec_jpoint_t *acc, const ec_apoint_t *table, int d) {
+    ec_apoint_t neg;
+    if (d > 0) {
+        ec_jadd_mixed(acc, acc, &table[(d - 1) / 2]);
+    } else if (d < 0) {
+        ec_apoint_neg(&neg, &table[(-d - 1) / 2]);
+        ec_jadd_mixed(acc, acc, &neg);
+    }
+}
+
+// Result = k * P: split k with the GLV endomorphism, then run one shared
+// doubling chain over the width-5 NAFs of both halves (Strauss-Shamir).
+// Variable time: use for public scalars or where timing is not observable.
 void ec_mul(ec_point_t *res, const bigint256_t *k, const ec_point_t *p) {
-    ec_point_t temp;
+    ec_apoint_t base, table[EC_WNAF_TABLE], table_lam[EC_WNAF_TABLE];
+    int wnaf1[EC_WNAF_LEN], wnaf2[EC_WNAF_LEN];
+    bigint256_t k1, k2;
+
+    ec_apoint_set(&base, p);
+    ec_jpoint_t temp;
     temp.is_infinity = 1; // Start at Infinity (Zero)
-    
-    // Scan bits from 255 down to 0
-    for (int i = 255; i >= 0; i--) {
-        // Double
-        ec_double(&temp, &temp);
-
-        // Add (if bit is 1)
-        int limb_idx = i / 64;
-        int bit_idx  = i % 64;
-        if ((k->limbs[limb_idx] >> bit_idx) & 1) {
-            ec_add(&temp, &temp, p);
+
+    ec_scalar_split_lambda(&k1, &k2, k);
+    int len1 = ec_wnaf_signed(wnaf1, &k1, EC_WNAF_W);
+    int len2 = ec_wnaf_signed(wnaf2, &k2, EC_WNAF_W);
+    int len = len1 > len2 ? len1 : len2;
+
+    if (len > 0 && !base.is_infinity) {
+        // Odd multiples of P, and of lambda * P for free: scale each x by beta
+        ec_odd_multiples(table, &base, EC_WNAF_TABLE);
+        for (int i = 0; i < EC_WNAF_TABLE; i++) ec_apoint_mul_lambda(&table_lam[i], &table[i]);
+
+        // Start at the top digit: no doublings of infinity
+        for (int i = len - 1; i >= 0; i--) {
+            if (!temp.is_infinity) ec_jdouble(&temp, &temp);
+            ec_jadd_digit(&temp, table, wnaf1[i]);
+            ec_jadd_digit(&temp, table_lam, wnaf2[i]);
         }
     }
-    *res = temp;
+
+    ec_apoint_t out;
+    ec_jacobian_to_affine(&out, &temp);
+    ec_apoint_get(res, &out);
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "ec.h"
+#include <string.h>
+
+// Load a coordinate, failing if it is not canonical (>= p)
+static int ec_fe_set_bytes(fe_t *r, bigint256_t *b, const uint8_t in[32]) {
+    bigint256_t c;
+    bigint_set_bytes(b, in);
+    fe_set_bigint(r, b);
+    fe_normalize(r);
+    fe_get_bigint(&c, r);
+    return memcmp(&c, b, sizeof(c)) == 0;
+}
+
+size_t ec_point_encode(uint8_t *out, const ec_point_t *p, int compressed) {
+    if (p->is_infinity) {
+        out[0] = 0x00;
+        return 1;
+    }
+
+    bigint_get_bytes(out + 1, &p->x);
+    if (compressed) {
+        out[0] = 0x02 | (uint8_t)(p->y.limbs[0] & 1);
+        return EC_POINT_COMPRESSED_SIZE;
+    }
+    out[0] = 0x04;
+    bigint_get_bytes(out + 33, &p->y);
+    return EC_POINT_UNCOMPRESSED_SIZE;
+}
+
+int ec_point_decode(ec_point_t *res, const uint8_t *in, size_t len) {
+    memset(res, 0, sizeof(*res));
+    res->is_infinity = 1;
+
+    if (len == 1 && in[0] == 0x00) return 1;
+
+    if (len == EC_POINT_UNCOMPRESSED_SIZE && in[0] == 0x04) {
+        ec_point_t p;
+        bigint_set_bytes(&p.x, in + 1);
+        bigint_set_bytes(&p.y, in + 33);
+        p.is_infinity = 0;
+        if (!ec_is_on_curve(&p)) return 0;
+        *res = p;
+        return 1;
+    }
+
+    if (len == EC_POINT_COMPRESSED_SIZE && (in[0] == 0x02 || in[0] == 0x03)) {
+        fe_t x, y, seven;
+        bigint256_t bx, by;
+        if (!ec_fe_set_bytes(&x, &bx, in + 1)) return 0;
+
+        // y^2 = x^3 + 7, then pick the root with the requested parity
+        fe_sqr(&y, &x);
+        fe_mul(&y, &y, &x);
+        fe_set_int(&seven, 7);
+        fe_add(&y, &seven);
+        if (!fe_sqrt(&y, &y)) return 0;
+        fe_normalize(&y);
+        if (fe_is_odd(&y) != (in[0] & 1)) {
+            fe_negate(&y, &y, 1);
+            fe_normalize(&y);
+        }
+
+        fe_get_bigint(&by, &y);
+        res->x = bx;
+        res->y = by;
+        res->is_infinity = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+int ec_point_decode_batch(ec_point_t *res, const uint8_t *in, size_t len, size_t n) {
+    int ok = 1;
+    for (size_t i = 0; i < n; i++) {
+        if (!ec_point_decode(&res[i], in + i * len, len)) {
+            res[i].is_infinity = 1;
+            ok = 0;
+        }
+    }
+    return ok;
+}
\ No newline at end of file
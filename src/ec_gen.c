@@ -0,0 +1,43 @@
+#include "ec.h"
+#include <string.h>
+
+// Constant-time table read: touches every entry of the window
+static void ec_table_lookup(ec_apoint_t *r, const ec_point_storage_t *row, unsigned int idx) {
+    bigint256_t x, y;
+    memset(&x, 0, sizeof(x));
+    memset(&y, 0, sizeof(y));
+    for (unsigned int j = 0; j < EC_GEN_WINDOW_SIZE; j++) {
+        limb_t mask = (limb_t)0 - (limb_t)(j == idx);
+        const ec_point_storage_t *e = &row[j];
+        for (int l = 0; l < NUM_LIMBS; l++) {
+            x.limbs[l] |= e->x.limbs[l] & mask;
+            y.limbs[l] |= e->y.limbs[l] & mask;
+        }
+    }
+    fe_set_bigint(&r->x, &x);
+    fe_set_bigint(&r->y, &y);
+    r->is_infinity = 0;
+}
+
+// Result = k * P for a comb table of P: one table read and one mixed addition per 4-bit window
+void ec_mul_table(ec_point_t *res, const bigint256_t *k, const ec_point_storage_t table[EC_GEN_WINDOWS][EC_GEN_WINDOW_SIZE]) {
+    ec_apoint_t entry;
+    ec_jpoint_t acc;
+
+    ec_table_lookup(&entry, table[0], k->limbs[0] & 0xF);
+    ec_jacobian_from_affine(&acc, &entry);
+
+    for (int i = 1; i < EC_GEN_WINDOWS; i++) {
+        unsigned int nibble = (k->limbs[i / 16] >> ((i % 16) * 4)) & 0xF;
+        ec_table_lookup(&entry, table[i], nibble);
+        ec_jadd_mixed(&acc, &acc, &entry);
+    }
+
+    ec_apoint_t out;
+    ec_jacobian_to_affine(&out, &acc);
+    ec_apoint_get(res, &out);
+}
+
+void ec_mul_g(ec_point_t *res, const bigint256_t *k) {
+    ec_mul_table(res, k, ec_gen_table);
+}
\ No newline at end of file
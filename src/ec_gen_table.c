@@ -0,0 +1,2181 @@
+// Generated by tools/gen_ec_table.c -- do not edit.
+#include "ec.h"
+
+const ec_point_storage_t ec_gen_table[EC_GEN_WINDOWS][EC_GEN_WINDOW_SIZE] = {
+  {
+    {{{0x0678bf05b35c04a7ULL, 0xe1fc443c6926f07eULL, 0xfab3eed253ff2ef7ULL, 0x1a450f6e82c5d2faULL}},
+     {{0x136b620e505f9f46ULL, 0xa931f9443ff26faeULL, 0x19e2915d142791ffULL, 0x03f56cb4077bd1dbULL}}},
+    {{{0x990e2d1c425e217eULL, 0x39057cc1f25c0201ULL, 0x88a22fec7a203df8ULL, 0x1b2f8b2cd127bb89ULL}},
+     {{0xcc637933e67f1cdcULL, 0xe26d5772f4dffbd7ULL, 0x89bca626e51ebd8eULL, 0x0701597394b9e78cULL}}},
+    {{{0x23814af672d79f52ULL, 0x06dcd7567949fe15ULL, 0xed00c746bd6431abULL, 0x85d9af7d685dbc99ULL}},
+     {{0xdc0ca4beeea6f948ULL, 0xb9e40d0e63f682bbULL, 0xfb3c0abfc50bc20bULL, 0x93ee4ed2e32b8f53ULL}}},
+    {{{0xaa60f35d492a791bULL, 0x6d420b72c85e384aULL, 0xe7d0e99700f97dd0ULL, 0x155d950fb835f5feULL}},
+     {{0xe4a599f52cb889ceULL, 0x3b0d65879af83781ULL, 0x7776ebf2b9d4f4ebULL, 0x807cab50c5219151ULL}}},
+    {{{0x3abe8e6acb110a3eULL, 0x512266b4709b45c9ULL, 0x7dcd3592247500a0ULL, 0xaf05a5dc0d76d90cULL}},
+     {{0xafe85d5c7f4b9518ULL, 0x8ac19017a2bdb92dULL, 0xb61bc21605f65b89ULL, 0xe5363b4062fa07baULL}}},
+    {{{0xa443c4e0161d58cfULL, 0xfa9e7467c8e5fa68ULL, 0x85076bba0f80143dULL, 0x2b6c505c29d259c6ULL}},
+     {{0xd393021b2d8b670cULL, 0xb879d9895855b7d9ULL, 0xd7b58d18586b8f87ULL, 0x29bf1ee4f43fa6b1ULL}}},
+    {{{0x5feb5dda80eb6262ULL, 0xd4bd4d8f50ace807ULL, 0xaf238282b3f20d61ULL, 0x853d2db2c8dfde7bULL}},
+     {{0x23489638a7a9ff79ULL, 0xa81747cc5db955caULL, 0xc68a892fcca54fabULL, 0x678407aeb9ca2cb5ULL}}},
+    {{{0xde3aa72237524525ULL, 0x1aad8940cfa01185ULL, 0xfee66b595ef8b550ULL, 0x81f30ba5f1173856ULL}},
+     {{0x8da55d420651a02dULL, 0x551f08014c911e11ULL, 0x7de38d50429e0711ULL, 0xf31105c241631e7aULL}}},
+    {{{0x59498a16f37460faULL, 0x362f90c412c9ae7aULL, 0xe5718ab9bc3d161bULL, 0x3a0863b17626273dULL}},
+     {{0x0ce940af55840f0cULL, 0x6359d1626b140facULL, 0xd4b340e28a6c2f62ULL, 0x8496f94cb0cb765aULL}}},
+    {{{0xa0e988165352ef93ULL, 0x002f211f6a675369ULL, 0xe442f88d7d52de0fULL, 0x6fc4df1b28dedbccULL}},
+     {{0xd1362301c1fd4adaULL, 0x82b6b260295265d1ULL, 0x6e0ee0f8ed6e9ea1ULL, 0xb1ef44500d78ac1eULL}}},
+    {{{0x62c30ff0ee63adc8ULL, 0x228fedc036d2e1f8ULL, 0x0ab7b9d5b314a019ULL, 0x136abb694ad47c37ULL}},
+     {{0x737baf5e79b03553ULL, 0x6cefb5552aa728f7ULL, 0xe268335218d3ffa4ULL, 0x69bae70ae086aba1ULL}}},
+    {{{0xb936acd56ca55d38ULL, 0xaf39097b8afdbb0fULL, 0xa94040422f65f604ULL, 0x566200312d2bac98ULL}},
+     {{0x0ca12b0da6bb6e66ULL, 0x31e091f67817d04eULL, 0xd7ccc59f0d7e4d71ULL, 0xe20a3fa048d0116bULL}}},
+    {{{0xba77a46531fffb17ULL, 0x78235af9635c85f6ULL, 0x83fe554a2321bc8fULL, 0x447538c5d2210d12ULL}},
+     {{0x88f7888a820aae4eULL, 0x3195262ac03eb6afULL, 0x515954e09e163a5dULL, 0x8c7a003fc57d5c94ULL}}},
+    {{{0xe12636f88fea5fd1ULL, 0xe52c9407aa13d2d0ULL, 0xeedc9a4429038ca3ULL, 0xa5e831bbe819bbdeULL}},
+     {{0x8d90c42f6637ed31ULL, 0x8c0130cf8569a252ULL, 0x418afe470348385aULL, 0xc067337c852433c0ULL}}},
+    {{{0x7689e2061920fe9dULL, 0x52b4639c26c0a06cULL, 0xb6644c410e80808aULL, 0x8a5d8a2612e773a0ULL}},
+     {{0xd2f377edf287ee1bULL, 0xb1fac4187043a7b6ULL, 0x5a5a2654e7d42b95ULL, 0xb0dde2866d27353aULL}}},
+    {{{0xc2d234675ece78edULL, 0xd4c7742c44df4bedULL, 0x9bf6a0e54fd7efd8ULL, 0x5af8c0a2e4cf51a4ULL}},
+     {{0xde101d839f7fd2beULL, 0x9522446ee2d64273ULL, 0x5b5341a4a4ba762aULL, 0xbcc0a114194a3f52ULL}}}
+  },
+  {
+    {{{0xebf03d5a7562815eULL, 0x2697e90b11bbc51cULL, 0xf12717ee816b48faULL, 0x683a9998a8489571ULL}},
+     {{0x993bb995d4dc61c9ULL, 0x847e5b26f0e2845eULL, 0xf0696b63c83e6b0aULL, 0x7f7bb401f45337a5ULL}}},
+    {{{0x37574d77b3b5c579ULL, 0x6f29db73058ef62eULL, 0x294b2417769bad90ULL, 0x957c715e15117383ULL}},
+     {{0x776c9ae0912fc191ULL, 0x327b31d419433883ULL, 0xfb063ef70a912886ULL, 0x88e44ab56cef624dULL}}},
+    {{{0xa8e06174721461fbULL, 0xd3b316fdc65bac4aULL, 0x0ec3e0353243e486ULL, 0x8e0d48fc1f9bd5f4ULL}},
+     {{0x54a63b393a4e0903ULL, 0x9da76728ac33ac49ULL, 0x24598f242d7cd627ULL, 0x0f51f5c70c273989ULL}}},
+    {{{0x7b96a0f59d2e5655ULL, 0xcb7b1ce43e097523ULL, 0x4cdf789b298e0b8bULL, 0xad2bcbd7818afcd6ULL}},
+     {{0xcbdee1141e5adf5dULL, 0x76a484abeaf778c1ULL, 0x9c4b0a27999de7eaULL, 0x8683f4899f6216fbULL}}},
+    {{{0x5cd0b291b479c03dULL, 0x2bd5f08c524ebf4dULL, 0xd043c133877a2f9fULL, 0x3ccc841b983f9379ULL}},
+     {{0x5fe16e8af4f56084ULL, 0x6d2f94682152ace5ULL, 0x27aef2f02129d0baULL, 0xffffb25b49c1f505ULL}}},
+    {{{0x3a119f7293b77291ULL, 0xf3b6cb12c991b154ULL, 0x25e55faf6ec2df6fULL, 0x72991e177093f0acULL}},
+     {{0x502c42de39ba888dULL, 0x426d3eb8b472f24fULL, 0x8da60076e6d7650cULL, 0xf1d661a9de5f1c91ULL}}},
+    {{{0x869d4872b1dbef91ULL, 0x64b2a30548456fdbULL, 0x82e134dcbf9d2b33ULL, 0x5937978de4e82616ULL}},
+     {{0xe360ffa630dfdb2dULL, 0x3acf772214c44de1ULL, 0x62160c29854bc3e9ULL, 0x26fcd8afe3f14e18ULL}}},
+    {{{0x0a9fa5eaa2af0214ULL, 0xbe431205b411b1baULL, 0x3e7e0edb607b9b11ULL, 0xe6c526de6bc7ea72ULL}},
+     {{0xc08a6b70467b75d3ULL, 0x484fd3bdebd97361ULL, 0x245324de46c67961ULL, 0x957a5ab5a001bb43ULL}}},
+    {{{0x5c670d62ea61f9aaULL, 0x0d015baf39d34dd7ULL, 0xc1f6fc3b4bbcd48aULL, 0xe2bc6f379a38f0e8ULL}},
+     {{0x1653422f52c8722bULL, 0xe6659b4ddace1b1dULL, 0xf4cd4c67d056c99dULL, 0x080f94fc95ab8336ULL}}},
+    {{{0x37be9b5742eba9a9ULL, 0x030e2518a6604b58ULL, 0x190edf587c1c0b2aULL, 0x0dee57cce68401f1ULL}},
+     {{0x4f1e858de4d65936ULL, 0x9c0df164d66b7a90ULL, 0xe75c52435ad183d3ULL, 0x54123acb7fb6cbbdULL}}},
+    {{{0x0b6811301ffe077fULL, 0x62449e4e8471a4d2ULL, 0xf958b46ec056a29cULL, 0x9361f1dacfaa4856ULL}},
+     {{0x3429077d3eca5a48ULL, 0x653ce2b07dc5213cULL, 0xc5df57b91396357bULL, 0x9b524ea87033227dULL}}},
+    {{{0xf5f97ced2d70ec67ULL, 0xb5bc0b9fac933156ULL, 0xd40ee8001bf7a42bULL, 0xf18fe4bea6f73c39ULL}},
+     {{0x85192240bd822b76ULL, 0x6fba4dedb9447efaULL, 0xb1ef673fb4bb38f7ULL, 0x4fcc6a5032a717f3ULL}}},
+    {{{0xd14b4aed4dad4dd9ULL, 0x7a27c044c87b4aeaULL, 0x6c19eec91af9ced8ULL, 0x3c589d03843374f2ULL}},
+     {{0xca301a3b183a8282ULL, 0x3326a3653b9a4bbfULL, 0xdfeaf64db020eab0ULL, 0x8bf80eb074d3bb43ULL}}},
+    {{{0x32eec93e7c7a9c16ULL, 0x35fd20d7152b0bc9ULL, 0xe1592c5072fe6790ULL, 0x870578d97815859fULL}},
+     {{0x68508d0af01fdc49ULL, 0x52a3da53a4c87066ULL, 0x130ff143b695e16cULL, 0x9a9259ca016df03fULL}}},
+    {{{0x24abf9c800beab5dULL, 0x309303f6a8272ab6ULL, 0x3489b3e771c1bb3aULL, 0x375065cd9fdd90d0ULL}},
+     {{0xc19855023018fc28ULL, 0x1a5d1024198fae73ULL, 0x7114e6a7b9f27d21ULL, 0x4720ca7b85a339b7ULL}}},
+    {{{0x23ec2aa0c234ad70ULL, 0xc2edfb2b0905240fULL, 0x0488dd03b0a2bbc1ULL, 0x4c9db2c56b088009ULL}},
+     {{0x3179510b93280756ULL, 0x3a755a55fc802816ULL, 0x4fc5299e544d5637ULL, 0x5e0d92703d717041ULL}}}
+  },
+  {
+    {{{0x682e485e796e00c3ULL, 0x4c134a785940c220ULL, 0xca15fb91c0ceaca5ULL, 0x8912bc7b08c6adc6ULL}},
+     {{0x5c99b465cb9c7c17ULL, 0xe1e72a76212a709fULL, 0x3eed4542cf210e7eULL, 0x778a6cf8e589aa0fULL}}},
+    {{{0xf6b6be1d8197151eULL, 0x98c3230c372e3894ULL, 0xb117613c1ef228a0ULL, 0x237aa0b339c636a2ULL}},
+     {{0x97661719f8fa165fULL, 0x5d9ed665eefcd75aULL, 0xda2d699d13f9f709ULL, 0x88c606876ad4b810ULL}}},
+    {{{0xa1f6dbc9bff5cc64ULL, 0x7557451892534e6aULL, 0x8f8c7dc3bd0d6608ULL, 0x8152228627c4e930ULL}},
+     {{0xac1bc7b2cffac892ULL, 0x8177d26ea58e059cULL, 0xe62f82c18e25700cULL, 0xaab882113dcd9472ULL}}},
+    {{{0xa4ec677bac1804e6ULL, 0x88c9a4df191d5fc0ULL, 0x4eced1b1b2e2a36fULL, 0x1675827424d23a22ULL}},
+     {{0xe470a0ae75dfbb14ULL, 0xb74ffb0c0ab7827dULL, 0x9edba978f75f9d91ULL, 0x78120d53d9a219b9ULL}}},
+    {{{0x18e35fc3cac5db38ULL, 0xcb951b9503c65684ULL, 0xc81550b9bc79f347ULL, 0xd990d19d04f54123ULL}},
+     {{0xfe5458ef721b522cULL, 0x764a5802e5ab2974ULL, 0x413ce336cfb1248eULL, 0x07864a036ccbd83eULL}}},
+    {{{0xaa203896b11259cfULL, 0xa38cdc934c91c8bbULL, 0xbd8ddf60f5ae7e8bULL, 0x046167f25ec09bd4ULL}},
+     {{0xc412afb03a090abbULL, 0x0f8af3ccfee3f836ULL, 0x88a1f1edaf8bdad2ULL, 0xc2b3e1f1464e2fe5ULL}}},
+    {{{0xbc9819f7df95bc54ULL, 0x07712b3bd81edb59ULL, 0xe5904ad4e8949566ULL, 0x6a7f108009dd3888ULL}},
+     {{0x51383f2be3bf8c4eULL, 0xdc5fa02b929885a0ULL, 0xa5a9f5b9f4b2720fULL, 0x30c19058f232e669ULL}}},
+    {{{0x2153d7edd3aee648ULL, 0xefcb7c57688fa86dULL, 0x239f194a84d3ec9bULL, 0x83e792b928703d76ULL}},
+     {{0x4f222ff5cccd7883ULL, 0x37196aa778049fb0ULL, 0xe3f581b75a4ee7a4ULL, 0x5dfaf1e9689b42ffULL}}},
+    {{{0xf7b2d7cc5f13b58cULL, 0xaa8a541cf7d78d24ULL, 0xabaf73053e242300ULL, 0x780342fb76c4c8b4ULL}},
+     {{0x19458482e20766eaULL, 0x46d9eccd503af52aULL, 0x7a3395b579554fedULL, 0x3b363025cc72679bULL}}},
+    {{{0x4f9577424e4e64b0ULL, 0xd2ec810b4dd2efe3ULL, 0xbd7b85d2481289abULL, 0xa8e4f3eadefdea1dULL}},
+     {{0xfa27774805745218ULL, 0x864958171c582449ULL, 0x534f2d8306f4e7a6ULL, 0x6dbe6a9190d959d9ULL}}},
+    {{{0x02fb877c1193f698ULL, 0x9660fe91da7f3363ULL, 0x629ad0b60ab8c8c9ULL, 0x6a3915754e5cbb05ULL}},
+     {{0xef3f9ab37d604a37ULL, 0xe7db4d42cbd6aa08ULL, 0xf54cb13a1f065423ULL, 0x62070c75b9843713ULL}}},
+    {{{0x0c5d35bfb203c46cULL, 0xe754ff2d988dd873ULL, 0x6577fec3b55975b6ULL, 0xd5e4d2f22b199315ULL}},
+     {{0xf3adc791ddf9c148ULL, 0x60ba72fdc835a6abULL, 0xd4e5eb3fce61bc0aULL, 0x59aaa83992bccdb1ULL}}},
+    {{{0x349e8b3e79996c0dULL, 0xa06f38aff18723d4ULL, 0x05375bd8baf9348cULL, 0xa686997cbc9b3c9fULL}},
+     {{0x54c4d9f63220e0f2ULL, 0xfdd73d7e26b98f40ULL, 0x17eb4660a3a58219ULL, 0x16fd614e4e5ad697ULL}}},
+    {{{0x9bc7df5aa5e7cc50ULL, 0xa76e2d13fe22a8c8ULL, 0x2b8565fdf0b8a4a6ULL, 0xabe666f57bd0f9acULL}},
+     {{0xa6606e9e59bac9d3ULL, 0x3e8cddd3e91ccd13ULL, 0x880c5cae62235ab7ULL, 0x646248f3c2a44030ULL}}},
+    {{{0x55be68572bde7aefULL, 0xb235b49ef21ff765ULL, 0x080f9580cfaef6c4ULL, 0xcb6a64b19f11bbfeULL}},
+     {{0x7fe8676ced01b413ULL, 0xa549a011215c3801ULL, 0xa7c1b930153fe5c2ULL, 0x2ccf4f44a3e09766ULL}}},
+    {{{0x762e41f050a7e270ULL, 0x5a5c019d18b65755ULL, 0x3133424e19cb1881ULL, 0xdb85afb9cd54329cULL}},
+     {{0x16351d9d114aee8eULL, 0xa4e0a9deb1e10e48ULL, 0x50023faffa8ef8afULL, 0x5320bb7c3d5f451aULL}}}
+  },
+  {
+    {{{0x474736533c3e0fe3ULL, 0x863224daa4334487ULL, 0x9cf56b6c9c30dd0bULL, 0x15cbcb1d3ddee072ULL}},
+     {{0xd47a6cd0c4eacb50ULL, 0x739b4e889c9a47a9ULL, 0x7a40b67ac0cd30daULL, 0x5221d251984eaed2ULL}}},
+    {{{0xdb46cdc01e2ea06bULL, 0x1fa7723723bde189ULL, 0xef80d09e8b79462bULL, 0x81f6744446fb51e2ULL}},
+     {{0xc401a15f31125185ULL, 0xd3299a28632772c6ULL, 0xea8548b20220a656ULL, 0x7ed949a3f9020f12ULL}}},
+    {{{0xd5c30b39488c54b6ULL, 0xbb0adfdbdac23d47ULL, 0x8933e87030949286ULL, 0xda6fc59d4c98948bULL}},
+     {{0x8422edeb025a816dULL, 0x98afd2f7b6acc40cULL, 0x744fba469a17c2d1ULL, 0x9a427b00a9011350ULL}}},
+    {{{0x7e8aa258ea8af1e9ULL, 0x796159f2322f4450ULL, 0x3a74cc82c73d9990ULL, 0xe9e738a010a8ec27ULL}},
+     {{0x0475c44bd366d34bULL, 0x5b6bda583f25f3c4ULL, 0x5245a7c385298328ULL, 0x301f7e62bf9ebd9eULL}}},
+    {{{0xd9207d2a4ba24a37ULL, 0xf92a1087553eeb97ULL, 0xb3c35c62fe31aa2bULL, 0xc19886fb066bf068ULL}},
+     {{0x1ade451b6422ed31ULL, 0x8ef3b97802489083ULL, 0x45a17023e4871f3eULL, 0x7e9a8d45024f0b22ULL}}},
+    {{{0xfaea277937b13dbdULL, 0xbad6fe42c2efd813ULL, 0x9fb9efeec5a57c96ULL, 0x0ca6fa6e9e17664bULL}},
+     {{0xc7de3ea4db27453dULL, 0x9f034d0baae5a6fcULL, 0xa5771332bfa6ce83ULL, 0x2b821bac9d8d277eULL}}},
+    {{{0xfeea3849fbfbc60aULL, 0x1b75d6e24102bc12ULL, 0xab30f5ee191c394cULL, 0x7bdd0cafecd81471ULL}},
+     {{0x94e43a372614b7abULL, 0xdf644752e96c6c5eULL, 0x5b9281a0a65aced9ULL, 0xd2554e4da821305bULL}}},
+    {{{0x981571c471dff5d9ULL, 0x72deeee2f3d2dae3ULL, 0x2a048c3ec0193ad2ULL, 0x80d36e728883ffc5ULL}},
+     {{0xfe0d4e705c7cbba0ULL, 0x25b0906a56bd440cULL, 0x49cd98bd2109e663ULL, 0x4d0e5543f685e284ULL}}},
+    {{{0x8d25947ac53c978aULL, 0xf9972c7969b2df96ULL, 0x2831a8b9bbad8ac3ULL, 0x7346f5a22ef2c448ULL}},
+     {{0x2da5caa5fd1c572eULL, 0x9db49dc7d9ab3ec5ULL, 0xfd680f6d0b79d37fULL, 0xe97c2e0c7d872aacULL}}},
+    {{{0xe1b5f5a2c87bd8a5ULL, 0xb64cd622d76e6af3ULL, 0x6dfbbc1e0d9ea79cULL, 0xf4ec17890056ddd7ULL}},
+     {{0x1ed6644a3293b90fULL, 0xc23c7ec183d42abeULL, 0x2669cb95b49b5ce4ULL, 0x842302a608daa1f8ULL}}},
+    {{{0x48bdc0530d1ab16fULL, 0x08b9706241348323ULL, 0xfc15e0f362a12d68ULL, 0xf44ea09deaa7a261ULL}},
+     {{0xe847ff2040c9db9eULL, 0xfd1c54c11fdc2c80ULL, 0x6d2f8cdb9232cc0bULL, 0x183b5ed443a2b7c8ULL}}},
+    {{{0xda98182d34791b7eULL, 0x5097f2868f2f78ceULL, 0xb72428b7af9a3f06ULL, 0x2b8363884165319bULL}},
+     {{0x5ef248f7f9dcdbc5ULL, 0x12618a5354215f3bULL, 0x8b0c3ce569cc4974ULL, 0xd1c3890267e7d6aaULL}}},
+    {{{0xb63e827a0201ebe3ULL, 0x70ecf59fff10f150ULL, 0x7335c4399e2c8d88ULL, 0x7f55b8770a12a99dULL}},
+     {{0x7befb300679882c0ULL, 0xb0661508ebce7d78ULL, 0x671e3b65a344ce3eULL, 0xf761d0b97c47f8c1ULL}}},
+    {{{0x0b948388827728c2ULL, 0x615bbff1eeeee20bULL, 0x1261ea94b2d4ea7cULL, 0xd5610faa3b9ad325ULL}},
+     {{0xadc164d3241987acULL, 0x15c296f596d85e7cULL, 0x5a76286dce817d09ULL, 0xc4d4818a2c9e3917ULL}}},
+    {{{0x94e32a8a6b8f92beULL, 0xd672bd604f417d18ULL, 0x773d8313154bff86ULL, 0xcb68023d479beac3ULL}},
+     {{0x1a684e95f6ddd6bfULL, 0x1687f279a7d4878dULL, 0x996e800d4f78424bULL, 0xa996dfb67f362f37ULL}}},
+    {{{0xbf99247aed244a0cULL, 0xd33a1bbc65cce076ULL, 0x5304979bb63dd6c6ULL, 0x0bfaf8a32b4a4c85ULL}},
+     {{0x67c1a46a3371c069ULL, 0x741431bb7d38d75dULL, 0x7522e1e5ca0aefccULL, 0x3c3ac94476c93e46ULL}}}
+  },
+  {
+    {{{0x6490aebb660b26aeULL, 0xe1859b606d8f30ffULL, 0x670c8cde09761b9cULL, 0x5fe5a11a07a3bc89ULL}},
+     {{0xd42e9d37c5c50be1ULL, 0xba8b6aeb726f95e8ULL, 0x2784c6139892b943ULL, 0xda97b73f3d47f55bULL}}},
+    {{{0x692678727ba85b51ULL, 0xc6b28bd834bb77d7ULL, 0x849255edd7fff6cbULL, 0xfbfe1f8d00022aa6ULL}},
+     {{0xfe04ab9f7928fa4fULL, 0x71e52352ccda5f91ULL, 0x4a01deb64ac5a885ULL, 0xb56f7930a2272320ULL}}},
+    {{{0x3a8171c7d3e2ce4bULL, 0xe32dec53eee43891ULL, 0x4fdcc9990b6f29d0ULL, 0x1c864330894f3849ULL}},
+     {{0x1dbd4814f28292d8ULL, 0xab7e51ecf61345bbULL, 0x18cf1731061b7222ULL, 0x2f94fe94520b6f3aULL}}},
+    {{{0xe77579b0c86ddb91ULL, 0xc6c0fcb3e61dd3f5ULL, 0x11042288e0c0ed60ULL, 0xc3615dc8ca2fcde2ULL}},
+     {{0x301dcf18e7c0ad6fULL, 0xc02b1b883e7985c0ULL, 0x9759b55744178d18ULL, 0x40cf1f4e288a7110ULL}}},
+    {{{0x095d456cea84d968ULL, 0xcb31a97dcb0a5056ULL, 0xf4ce8fa3f1766c64ULL, 0x900ef69f4b6409e4ULL}},
+     {{0x1bbc1d43c2c5e62dULL, 0xe76527313518aec8ULL, 0xa48551ec033c47e0ULL, 0x64a1f77ff275a012ULL}}},
+    {{{0xb5c70036a56eac9dULL, 0xa6b4fabbe8517300ULL, 0x8738d5d7ba0293b1ULL, 0x1c3c0dbf93af92b6ULL}},
+     {{0xe465c07bb6c36c6cULL, 0xa23c7785409647daULL, 0xe3db40b662a4e5e4ULL, 0x1d87bb202b32f5efULL}}},
+    {{{0x8ad103d69100b76cULL, 0x0eae88858d8c07c5ULL, 0x40559059006ce994ULL, 0x582c4402f38603e7ULL}},
+     {{0x25b6a2b0ac66dc90ULL, 0xb6f028457e8cf3fbULL, 0x5a0d4518576604edULL, 0x4699aa385971a9feULL}}},
+    {{{0xabc4599e210df57aULL, 0x0ed5366a26166cd0ULL, 0x4896b96c2fc72b71ULL, 0xccc03977b08e8839ULL}},
+     {{0x7a4befee9d6c2536ULL, 0x30ffb9642bc5950cULL, 0x5bbe86e9bddedf42ULL, 0x5c6943170d8eb504ULL}}},
+    {{{0x30998671352d79d5ULL, 0xc72d51fa9ee0f2fdULL, 0x49c714fc262e0414ULL, 0xd2597767b8dc76c9ULL}},
+     {{0x43d079deca1b6325ULL, 0x2f2b91ef62025646ULL, 0x890f8f27285e95b3ULL, 0x156e37a1ce1b12ecULL}}},
+    {{{0x1bc09937f048359dULL, 0x7970e16b49f2cb6bULL, 0xcd20ba4267568524ULL, 0x6555043524fbc81aULL}},
+     {{0x5635d0876d25006cULL, 0xd87be732c87ecd1eULL, 0x06e7052d391c93fcULL, 0xa92239dc4ef8cb0bULL}}},
+    {{{0xdd7f466358a82631ULL, 0xb0ab0c7bd23ee145ULL, 0xa04d6df3a4315e09ULL, 0xa8e74e4e6ba4885aULL}},
+     {{0xa570dfe783d9ed47ULL, 0x3e6c1da700481e56ULL, 0x35a1d80355fd57f3ULL, 0x0dd59b5966ef851cULL}}},
+    {{{0x7b4053a2a0174201ULL, 0xa7e5b2c4390dc091ULL, 0xcb3ed279108d39f8ULL, 0x41b1f57436b553ebULL}},
+     {{0xc8258a37295662abULL, 0x32d8dc8757d5f694ULL, 0x938df46704f43c27ULL, 0x96e75416932ee278ULL}}},
+    {{{0x33e4ef09bd778b6fULL, 0xbc818aec231983c6ULL, 0x586e7b0ac0f0b055ULL, 0xd21985cc5d273624ULL}},
+     {{0x5d3e40bba510b13eULL, 0xc816a0b3deec0941ULL, 0x31e0df7927fc77d3ULL, 0x20458bf073084cecULL}}},
+    {{{0x8fb96bae7b4701f2ULL, 0x79b3ea3a6e7f650fULL, 0xc37bccc9c4198fbbULL, 0xe2f3b6f09a0daedeULL}},
+     {{0x9d09b4c439e52f7fULL, 0x8756424f5e722bd7ULL, 0x33e4c0ebf87b2bbeULL, 0x24211cf67aa7fb40ULL}}},
+    {{{0x0033a494fcae96d7ULL, 0x696f4ab9438cfe63ULL, 0x6262cc8a0b1e0698ULL, 0x227ba0c4f06b4b52ULL}},
+     {{0x7948397d1b8a0729ULL, 0xd92b0efcc9438731ULL, 0x8e5f728a822d9c5aULL, 0x07f00ef4b7e4e099ULL}}},
+    {{{0x3ebb6c5d906f14a6ULL, 0x3123c92d35a1e29bULL, 0x0f4977cbdd60c7e2ULL, 0x57bc754b819c2573ULL}},
+     {{0x6630512b3d4d111cULL, 0xb17bf1d9c05149c8ULL, 0x862e866485ca4dc7ULL, 0x4d59b74bceab8c6fULL}}}
+  },
+  {
+    {{{0xf6e50db146e73dedULL, 0xd55bd6b9a6198d66ULL, 0xbe9dc0a849158156ULL, 0x5e8466ac71561548ULL}},
+     {{0x8294ba5ff5aa56cdULL, 0xc17e153ea2b5c9a9ULL, 0x32cbd79a85375848ULL, 0xd7a49d6ae669889eULL}}},
+    {{{0x1a17f781cb2d56f3ULL, 0x584c21d19cf580a5ULL, 0xdf18b901f3c50b17ULL, 0xe308eb86a712b8c3ULL}},
+     {{0xceaa037fd6b9cb09ULL, 0x2f86a30de250cd2eULL, 0x760a6aaa90ba7f30ULL, 0x1d60fde17c727bcaULL}}},
+    {{{0xc1ec2fc08c90fc0eULL, 0x2f6541a9b01cec1cULL, 0xe28a859e44738cfaULL, 0x36ec526684d5bf68ULL}},
+     {{0x4d8aed7d212fd66eULL, 0x799d6fed8b57b599ULL, 0x650ab602103aa8f7ULL, 0xa2e99f7d410ea5f5ULL}}},
+    {{{0x81cf81b31175c603ULL, 0xe9901c6339a4f405ULL, 0xcfb946596f068324ULL, 0x5df32f79b3f7d01aULL}},
+     {{0xb5de914e0c0f4b58ULL, 0x0ff54bd6eaa66f6eULL, 0xe50c071aec08edccULL, 0x2db4164a3095ad29ULL}}},
+    {{{0xfcf0af231b77c7e9ULL, 0x23252e9395fdc4dbULL, 0xb0ce34c1ff670ecaULL, 0xf2b7f563e87ee425ULL}},
+     {{0xb7a0cd83479f74aeULL, 0x0dc20dd373eb41c7ULL, 0x526012104b71c5beULL, 0x9c0c7f1deab84a16ULL}}},
+    {{{0xf9e9d19c774f1044ULL, 0xaf79e4d53900c6f5ULL, 0x224f2460530afc69ULL, 0xa2b5e0457509fce6ULL}},
+     {{0x01c29ba50c859f89ULL, 0x08165e790cbb995bULL, 0x47402ef6ffacf587ULL, 0xafd8ed4dde2ca5e5ULL}}},
+    {{{0x8967644c5a7c175fULL, 0x47b97764027bea59ULL, 0x84e798fe447240caULL, 0xf8502e8fdc545210ULL}},
+     {{0xa41fab6f4e7c7145ULL, 0xccbf8865ef74b06cULL, 0xf8798b52064660d6ULL, 0x630b8cea11f369bfULL}}},
+    {{{0x81b4db9fc6b470acULL, 0x945cfd794da7509cULL, 0x8469a6092ea6b259ULL, 0xbf05c72840eaa244ULL}},
+     {{0x156e9faf2d4eb217ULL, 0x53cf538d778c792eULL, 0xe264a174180783b7ULL, 0xe1466f1c5d6ad3c2ULL}}},
+    {{{0xad3313432ca06cd5ULL, 0xe09b8e600e55947bULL, 0x91908194cdddc3f2ULL, 0x6a1fe16b6ad2f615ULL}},
+     {{0xe33a690a1ce1050aULL, 0x9e8d7776041a248aULL, 0x6e6b8f1a127d95e0ULL, 0x3a21f2c00ace7de8ULL}}},
+    {{{0xab3e163331f0e73aULL, 0xfd94c01df7842728ULL, 0x5d5b5df049009059ULL, 0xf773d1c08bb8488bULL}},
+     {{0x0dd51cce9dcb32d1ULL, 0x0fafe3df7a5ab1c6ULL, 0x41cc14790c962779ULL, 0x4a517ee4cc92423fULL}}},
+    {{{0x472ea0d02d24a941ULL, 0x287c05ca15ed4ed3ULL, 0x69b702da86464339ULL, 0x80e998fb4596b7c7ULL}},
+     {{0x961181619a4b255cULL, 0x4ccc6e683176400aULL, 0x932018e21e476b81ULL, 0x41c7f70a7da2ac5eULL}}},
+    {{{0x15fd4cf23c86e363ULL, 0xfab98ed0ffbeb424ULL, 0xd08d9cd521eff6e5ULL, 0x8ad5a95490384aaaULL}},
+     {{0x45e96f8cdd6242d7ULL, 0x5dc8d4687fc037c0ULL, 0x7faf0510e3c1ea13ULL, 0x421b43c29585a6cfULL}}},
+    {{{0xc14b3914edb88f65ULL, 0xa780a85390c0a605ULL, 0x00114538ee46a24aULL, 0xf9416d068d702f5bULL}},
+     {{0x6ccc5b20f6328fa6ULL, 0x40d120629b045842ULL, 0x4a27c6c7de7d0868ULL, 0xb7f930cfd9ad1decULL}}},
+    {{{0xf2d7338cb09ebb0dULL, 0x15d2a578abdeb3aaULL, 0x57b0b7244d5fe80bULL, 0x8079f6a076e3f2ebULL}},
+     {{0x8edc6b82295b5d3cULL, 0xd540b02b71af010dULL, 0x016e2b5d11d97198ULL, 0x5ac0c57a656b82c1ULL}}},
+    {{{0xbf201cbc0f168c02ULL, 0xe1dd924fb6180289ULL, 0x7956cfd836fa1a76ULL, 0x25d3d14c9bf33b38ULL}},
+     {{0x9452c22d8ebc9d5fULL, 0xc26efc845e75fc69ULL, 0xbb76bf04daae2818ULL, 0x1d38f40adec719f6ULL}}},
+    {{{0xcbdd588f154cc66dULL, 0x9d45945a6f9afdeaULL, 0xf7408b222c0cb3c0ULL, 0x41396fb1a783c919ULL}},
+     {{0x449377ce0e3bc3b4ULL, 0xb76cb56eaccd9381ULL, 0x23913d6f4a772042ULL, 0xed0f7b623179759bULL}}}
+  },
+  {
+    {{{0xef7910fe09c33588ULL, 0xac94af8f7e75bad0ULL, 0x0124dcf4de93a14cULL, 0xb4bd51c5fa288165ULL}},
+     {{0x922eacf472c55d2eULL, 0xcf66dfbccda3ed4fULL, 0x73d921b1ed4fe675ULL, 0x739a0b11e3443970ULL}}},
+    {{{0x39747f35986ebf97ULL, 0xd047b7a83b61adf4ULL, 0x8bd889cfcac64b50ULL, 0x52f5292f8f687457ULL}},
+     {{0xf568e5de90531201ULL, 0x1633fe9c84226570ULL, 0x35116b317b22e8dcULL, 0xab0bc9d5098ee169ULL}}},
+    {{{0x700c318ed007427eULL, 0x23dcc2712ad6368fULL, 0xed9525f2c8316dc1ULL, 0x642ea5ed768a236dULL}},
+     {{0xe053ad7192f274a3ULL, 0x369fed99ec8743e3ULL, 0x2d8a6987e296b64cULL, 0x8f3861a21ee14472ULL}}},
+    {{{0x607fbf208276bc88ULL, 0x88603923b023a2acULL, 0xef0603314976db34ULL, 0x947d901e047b8b24ULL}},
+     {{0x0ddd1d1e6e2cccc9ULL, 0xe233eca45ed2337cULL, 0xa03cb2d89dac2b52ULL, 0xcf5edd69e7de6218ULL}}},
+    {{{0x8c2e5b1edd030fd1ULL, 0xdc109074c6e80991ULL, 0x3c8a5bd78407b040ULL, 0xb490ec6f33ef3ea3ULL}},
+     {{0x4d33e93436ce6e50ULL, 0x6823216878a5583fULL, 0xc17616dd582af1b8ULL, 0x1f458f333de447ceULL}}},
+    {{{0xb2bac9af7177b5f4ULL, 0xa06c2d3bfc1a97f1ULL, 0xad8f3d375a47ec05ULL, 0x02c7c301ae798ec6ULL}},
+     {{0x82a9a72257ec0f6fULL, 0x13340b3ff769026dULL, 0x3209de1ca299f553ULL, 0x8ac0bf52b3305a1dULL}}},
+    {{{0xc7c63d20b947255aULL, 0x7e0311af53c90ba0ULL, 0x7a26386b6f06fa01ULL, 0x87603aba55b15527ULL}},
+     {{0xc4790c6e0bb235c9ULL, 0x5f5952f5710178aaULL, 0x13609428c0dcfbb3ULL, 0xddb495574210a741ULL}}},
+    {{{0x79bea1ee4de2bb3cULL, 0x548b98a909f76b30ULL, 0xbc1fb0892f700918ULL, 0x6c36d7a37abf2632ULL}},
+     {{0x1a997be16862652fULL, 0xc0b5ffe9a0fdd7efULL, 0xe26dcba5e6af0da2ULL, 0x3dc86da6dcf8aa29ULL}}},
+    {{{0xba0d9d6089a46618ULL, 0xf2e06fd240915630ULL, 0x895660af8fa42633ULL, 0x8908cde7dcd4886dULL}},
+     {{0x9d4ba0286edc421dULL, 0x71aef77b04e0f6a9ULL, 0x965cd17b010660efULL, 0x2e6014585d360036ULL}}},
+    {{{0x82c8c35389540282ULL, 0xaa159c0353761561ULL, 0xc8f69fd35e0a8c4fULL, 0x5d6cae499e9f6356ULL}},
+     {{0x87fbeba4b6210394ULL, 0x088bc000c81557aeULL, 0x7c90d2a19249c7e3ULL, 0x0d321615c30f532dULL}}},
+    {{{0xfb63c5cfa4092d8dULL, 0x6ddbd5f440571980ULL, 0x292ff9aa65cda8d7ULL, 0x43361142ecc445b2ULL}},
+     {{0x75c94c194b4e9c91ULL, 0x643dd4b8e8961cc7ULL, 0x0ef3c36cd75f864eULL, 0xa7e7bb0cdfab8ee0ULL}}},
+    {{{0x82c6b5b5a3a02bc8ULL, 0xb2b33064c85662d4ULL, 0xe7dd62f471af75d1ULL, 0x8a88c17cc1def30aULL}},
+     {{0x704114c4585a2f41ULL, 0xda1fa1bee8259370ULL, 0xc7ac30dd9293e64dULL, 0xc9e2aecf940f5789ULL}}},
+    {{{0x80234e58a635b4c9ULL, 0x529038cb60769fe4ULL, 0xbd62eefbf7391c5bULL, 0xd575da62ca3c2cb5ULL}},
+     {{0x5020148ec5198a5aULL, 0x01d8c412f6fade26ULL, 0xced017b79e6bddbcULL, 0x66d8608f6e2cc0c2ULL}}},
+    {{{0xb9ad645989ad961bULL, 0xf032e92a99097b4cULL, 0x13e93bd343ee3297ULL, 0x2ccad6235b81470aULL}},
+     {{0xffb8b7d6cd19e146ULL, 0x89207c7f33871b7dULL, 0x5f74b9b3da87cbc1ULL, 0x841797ab3661b753ULL}}},
+    {{{0x594c28de831dc3a6ULL, 0x488e5860e361c3c3ULL, 0x9cc6a2cb63d514f8ULL, 0xcaed2d300032db62ULL}},
+     {{0x74684147cb89e082ULL, 0xbced474228d4e3c5ULL, 0x8501fc6d269511ccULL, 0x4d255e8514243599ULL}}},
+    {{{0xa8ad84e11d3fab36ULL, 0xebdcd574867eeeffULL, 0x0b16a08bebdf18caULL, 0x9f29c71ac89d41c4ULL}},
+     {{0x617da57a7d4d4a8dULL, 0xcf989211fd8ebf77ULL, 0xe05735898de5ca3dULL, 0x283dd641aab9c72dULL}}}
+  },
+  {
+    {{{0x2d24fbaa7e9061aaULL, 0x5a61b4f4d44163a3ULL, 0x8137a120544aff1dULL, 0x77c2a85fda3715daULL}},
+     {{0x28639edb4d61966aULL, 0x28ac53bd44eda3e5ULL, 0x18df759b4b13926cULL, 0x2a0186d005cf7074ULL}}},
+    {{{0x6319fae2eeff926eULL, 0x40869e1d5d334b7fULL, 0x47a37ee704c7c183ULL, 0x2363ce29777ea5aeULL}},
+     {{0xa1dcf58204e5f933ULL, 0x5004428e476783d9ULL, 0x80401beeabadcbb6ULL, 0xe3a508942fbde03aULL}}},
+    {{{0xb16da0836cb8cf9fULL, 0x077e80dbdc9c46f0ULL, 0x79209ca47ccc9a04ULL, 0x1cb3b33161378d46ULL}},
+     {{0x3cdf887222dd3027ULL, 0x787c043f54161774ULL, 0x57ba230198653618ULL, 0x36a7c516166d4ac9ULL}}},
+    {{{0x266b900570d1c16aULL, 0x32f92580add733a1ULL, 0xb176357c8ff7d182ULL, 0xfce2897b20a92b51ULL}},
+     {{0x4dc4933d2b0de38dULL, 0x53993ae1fd320f1aULL, 0xbb80ec4eabf56006ULL, 0x1144b29dd02c1ee9ULL}}},
+    {{{0x9757c8b3452477c3ULL, 0x156af065d77fb10dULL, 0xfbeed709132e8625ULL, 0x08e71cec1c241934ULL}},
+     {{0x809af00d7e861a06ULL, 0xcef8908362c69a1aULL, 0x10ed40f6ee8e4a72ULL, 0xf8b64e5131b9d2d9ULL}}},
+    {{{0x1d93f34db4833a6bULL, 0x5ddb08f062d7f503ULL, 0xead0872a87af288bULL, 0xa35842fbf9029ab8ULL}},
+     {{0x6c1217b13cf58f55ULL, 0x7897be9ade106505ULL, 0x3ac577bd8add16f7ULL, 0xceb9e32f134a6485ULL}}},
+    {{{0xa54555461f92c471ULL, 0x7077d53481742c94ULL, 0xe80bf5407383aae4ULL, 0x8a4adf6303eef401ULL}},
+     {{0x596dfa7be86b5837ULL, 0x234df7476cf3e6fcULL, 0x7a711e8d5079cfc4ULL, 0x8d8c51893c9f8561ULL}}},
+    {{{0xeb2cedbc701f949eULL, 0xe48065261cdd8d53ULL, 0xb027512e9b740cdcULL, 0xeb60d39ca49fb130ULL}},
+     {{0xbfa82f8fa0221606ULL, 0xcd01219e552bef82ULL, 0x50a4e3e7c41b9549ULL, 0x17687e6926c37004ULL}}},
+    {{{0xc8f8facf7c5a5f94ULL, 0x2f618a1c38a893d6ULL, 0x08774fda1523dc54ULL, 0x89005a470f01713aULL}},
+     {{0xf3578b1fc5833839ULL, 0x039cad0bbf8c1098ULL, 0xc7955064dc3cc89dULL, 0xb0a8abff3c20243fULL}}},
+    {{{0x369962335911415eULL, 0x5e31ad1d26781699ULL, 0x96873e2ddcb43cb1ULL, 0x8b1d82f4d989cdf5ULL}},
+     {{0x13393560bef691f5ULL, 0x48e0118885e733c8ULL, 0xb0c449b0d8bf9edeULL, 0x1964567b4ade8dffULL}}},
+    {{{0x25fe0430db2f170bULL, 0x748a33005ee19c53ULL, 0x6cc4ae9b9579b852ULL, 0x1d042b940d665f54ULL}},
+     {{0xb254d2151e335413ULL, 0x3de79d8884abf47bULL, 0x77dacb5e27b1ed0eULL, 0xb76e3b0a10df1a45ULL}}},
+    {{{0xb4f2e505edfe96f3ULL, 0xe16c29df64b361caULL, 0x8e784c7d749f0a96ULL, 0x174fc6f450c1a99dULL}},
+     {{0x55de5f77994cac82ULL, 0xfa8fbeda1c333fc3ULL, 0x29b91bfd36576eacULL, 0x4389c34a4876c053ULL}}},
+    {{{0x11ee9531a7cfca20ULL, 0x97693d0072e97ab8ULL, 0x36dec05d76a28442ULL, 0xec57ec6839d6d620ULL}},
+     {{0xb08a40e728a47959ULL, 0xfdc72fa8941b090fULL, 0x193172efc0b07bb8ULL, 0xa58920bdc74058e6ULL}}},
+    {{{0xfa13bdf247083212ULL, 0x4529cbd07c4dc97aULL, 0x7d4c39aefa7b4b66ULL, 0x3a4a1e487e27dbeeULL}},
+     {{0x0b3da6a083dcd941ULL, 0x17156f29455a9248ULL, 0xd4295ccfd85ecf5dULL, 0x0fb8556bf73779edULL}}},
+    {{{0x3ffcc63a0ca80feaULL, 0xd37e954b6171fe7fULL, 0x20f6aa90bcd84cc5ULL, 0xa3f452588650a86fULL}},
+     {{0x67258c1c2b1da81fULL, 0xe7c6594bc64f6439ULL, 0x01bf9572030f7236ULL, 0x8dc0294ec6f8782fULL}}},
+    {{{0x9110c1f0a00c2ff8ULL, 0x951f8ca4ac788072ULL, 0x2ca35e340b9deeecULL, 0xfa3cd756e8eff131ULL}},
+     {{0x94db821a85612c05ULL, 0x20db882be29afc5bULL, 0xd7061cb5db106f48ULL, 0x168fed01b86cb423ULL}}}
+  },
+  {
+    {{{0x9337c7487e96c863ULL, 0xa8e2e955690b1631ULL, 0x6472f65abcb962d9ULL, 0xef5dff482adf0b54ULL}},
+     {{0x824cfddce23dd26eULL, 0xc28833e998d418bdULL, 0xa4db4957991817f6ULL, 0xf5fab65566826c7aULL}}},
+    {{{0x3ed6b34e4963feb2ULL, 0xed7792a94aa57310ULL, 0xdb8bc470ed459502ULL, 0xaaedc81a777b4f44ULL}},
+     {{0xcc842ff67faf23adULL, 0x3c758b9c42df21ffULL, 0xf040a49463fc6203ULL, 0x9ccaab8a4ec6e73eULL}}},
+    {{{0x980f356b3144e928ULL, 0x70c7ad0811b28baeULL, 0x61b31db903570a08ULL, 0x8d3a593d2f385fa3ULL}},
+     {{0x96e94d3123d72ef6ULL, 0x5033711698ac4c1aULL, 0x7e4a7dc93794f7b8ULL, 0x49d0bbfa0176c84bULL}}},
+    {{{0xa01cd2d0099c34d6ULL, 0x2770ea7c9d31116aULL, 0x1abf25ba5a9b6665ULL, 0x4d69aa638cfcd9b2ULL}},
+     {{0xc4732f3cd5eba93aULL, 0x20a6e75667b7bd47ULL, 0xefda27d9ad210d73ULL, 0x14de9bbf5331fc5fULL}}},
+    {{{0x13d8e9e46b4181dfULL, 0x9f949ab8d6c53a6dULL, 0x162c720fdb4027e0ULL, 0x858c34bfcbf91619ULL}},
+     {{0xedb57208ec385328ULL, 0x75039a4fe57b34e9ULL, 0x4b67c82f6b943a51ULL, 0x0b9218bf0ada5a18ULL}}},
+    {{{0xada5beb1dcdb0761ULL, 0xcfc9f7ce2749128aULL, 0x7eb086144667631bULL, 0xe5a17180d77c2080ULL}},
+     {{0x3b91291e9f3740e0ULL, 0x7a673b7b6006a860ULL, 0xe3d9b6e688ce0199ULL, 0xd3c4a7bc7b344375ULL}}},
+    {{{0x463c8613b7a62653ULL, 0xff56ec5d6a6cfda2ULL, 0xbbe0fa09d59c662cULL, 0x92ba37ba64849e8aULL}},
+     {{0x7876dd8721be0e4fULL, 0x10af2675ec01552cULL, 0x45da7cd86c58f77dULL, 0x056abf046d63f14aULL}}},
+    {{{0xacb4f74b391392e8ULL, 0x2b8e43c227849e37ULL, 0x26676b5cdecc45c2ULL, 0xf24bf795026d61f1ULL}},
+     {{0x688015508bf6123aULL, 0xc8d2b3c2b6315355ULL, 0xbe723ba5b428ead1ULL, 0xb5c3c967b5200133ULL}}},
+    {{{0x941d6bd0201f8c4eULL, 0xcfc06d157903759fULL, 0xb75f89a793ed371fULL, 0xfc8c8f67c05e3903ULL}},
+     {{0x72ca09eff370718dULL, 0xf43635efd5b3fad0ULL, 0x1981d3ddc37fcb68ULL, 0xed9d8fef4804834dULL}}},
+    {{{0xf25c3cb8f02ec375ULL, 0xc006e978b37f2b46ULL, 0x6fabcc62d0d8ddb9ULL, 0x285cd5ccb31e0b52ULL}},
+     {{0xce5f8d8e3ff28dccULL, 0xd4530573ee36dbd8ULL, 0xaa944ca7e90059c9ULL, 0x25a302f1c06d056cULL}}},
+    {{{0xa140e89d0bffa069ULL, 0xa0c3cc68063e993bULL, 0xc69be42a01a4cdf8ULL, 0xd168df833d922b91ULL}},
+     {{0x20a158ad532907a7ULL, 0x9ea19d3e5b69e009ULL, 0xb19736ce5553609eULL, 0xf142e2b2228ee885ULL}}},
+    {{{0x94fdf544da15e7b7ULL, 0x16db2fb229ac2862ULL, 0x3a8cac006b3e24b6ULL, 0x3b1fed1cac70d172ULL}},
+     {{0x4ae24e6aa9e57185ULL, 0x2fb7598144fd3a31ULL, 0x31bae5913173169aULL, 0xb16b7ff5598266f0ULL}}},
+    {{{0x21a80c0bbdb08cd7ULL, 0x25dbc7fe2b914cbcULL, 0x2ee3337a109dc053ULL, 0x30b1cf1bcf538adcULL}},
+     {{0x1a197221ebca688aULL, 0xbeffa3b415d0e3deULL, 0xa7432b037ab595cdULL, 0x234c6c8c1da2fddaULL}}},
+    {{{0x64af6d15cc3f0c3cULL, 0x8a4f9078df1f6d8eULL, 0x3f7d5e019ff34ba2ULL, 0x316be9c3b19469e4ULL}},
+     {{0x619c9f493a0101d8ULL, 0xa9d315c75bf4241cULL, 0x6121a52689483991ULL, 0x1a9c420b65b5ff4bULL}}},
+    {{{0x60d9809fe295bd8cULL, 0x3751876eb46cb507ULL, 0x0076a4de15405de6ULL, 0x6226cff1fd5d1252ULL}},
+     {{0x179b17419d7c0054ULL, 0x8fa2550a85167db0ULL, 0xb8117b95e621fdd3ULL, 0xe6322c2b98bc9c8bULL}}},
+    {{{0xa9323bac73f6e2f2ULL, 0x117e8cbf34d32852ULL, 0x25cc374bf98ef9f2ULL, 0x4139d4c8a20b4e0bULL}},
+     {{0xe181f86702557625ULL, 0x5e68bcb68b764eb9ULL, 0x055aab4518a71fddULL, 0x14660f0d244241c5ULL}}}
+  },
+  {
+    {{{0xd3c96d1f0b83171fULL, 0x1a66351e942a3f54ULL, 0xa1cea29826d0026dULL, 0x35f7a9ecc5a99d07ULL}},
+     {{0x8015f8ecb25b5f0aULL, 0x00f07256bab94235ULL, 0xe6476e4dad479ed5ULL, 0x9df964170f252940ULL}}},
+    {{{0x6f75d44b535914dbULL, 0x0a1f0cc32c0278a9ULL, 0x62afba996dfb5652ULL, 0x13919b30b423f79fULL}},
+     {{0xcd5a05790a51734eULL, 0x113aa2d715bdd124ULL, 0xa4ce0891b315075fULL, 0x87c422a092f32096ULL}}},
+    {{{0x44add1e7aab3fafcULL, 0xb422666be06e24d2ULL, 0x1451e2565bde8d7eULL, 0x6f345baea9b9897cULL}},
+     {{0xad27d742d2f67742ULL, 0x19d21d703f40902aULL, 0xa1798252dee5d4c8ULL, 0x976f4f045864f52dULL}}},
+    {{{0xce79c445be659d98ULL, 0x75343fc4bab018b4ULL, 0x481e02a0e3d757e4ULL, 0x041dd9bb38301ebbULL}},
+     {{0xc78364c536d6507fULL, 0x2554307fd0414f86ULL, 0x15a2a71dc6a53152ULL, 0x4a9e597701e81d4dULL}}},
+    {{{0x377a99b103dbafc7ULL, 0xb2174d460c00d9c2ULL, 0x6df5123a8ff01ceaULL, 0x7b09b7977932ef1dULL}},
+     {{0x0ab030e9a6d4483aULL, 0x7d7bc67d975335d0ULL, 0x117ef12204753510ULL, 0x75862cf173e31cc3ULL}}},
+    {{{0xb14e07f6e75406a0ULL, 0x9e914029ff47e371ULL, 0xd4bb3283ee0105acULL, 0x6629bb27962e577fULL}},
+     {{0x92dd5a25b0215392ULL, 0xe15b3d4aafd18d36ULL, 0x9c7e666f94894b5fULL, 0x079cdda4970141c7ULL}}},
+    {{{0xb107d6c413d9ec18ULL, 0x5467e650022b1c83ULL, 0xea7427bf0b0494f5ULL, 0xc7fa8aa5278e9963ULL}},
+     {{0x7b39629c851c1be0ULL, 0xeb32fcfa9dbac68cULL, 0x09a5acf2efc4b44aULL, 0xa7d4ec766aed780cULL}}},
+    {{{0x9cc01e118ff08599ULL, 0x42880fb6643126fbULL, 0xe8158cbde7667327ULL, 0x229c9c8a5dd0900aULL}},
+     {{0x3f6c5831b85dbf99ULL, 0x7bfc0cba365f8006ULL, 0x2ba9d2c965f6c521ULL, 0xe0d78a4dd9f83145ULL}}},
+    {{{0x75a97f9a7156380eULL, 0xaf236cb633d8463aULL, 0xe31d93f0fd7ffebfULL, 0xf6676c78c888c95bULL}},
+     {{0x396bfe3374d444deULL, 0x8c3fab5f51bea49aULL, 0x00e53b3f30ce9cf2ULL, 0xa1ad951631fc661aULL}}},
+    {{{0xdf160542fa7756beULL, 0xb71bf7cfc9c87f96ULL, 0x6fa6190854d5fe22ULL, 0x2531c55195b0027aULL}},
+     {{0x261f81572038f31cULL, 0x46571c89e6eb6636ULL, 0x3c9f09aedf7ad74bULL, 0x171fc7c99ca4cdf6ULL}}},
+    {{{0xc3ead3a6d5cce095ULL, 0x5fe64b0407598b75ULL, 0x601fe5c8c5060b79ULL, 0xd85c92f9d7a2ef11ULL}},
+     {{0x3d95c7aae84c316bULL, 0xed2af05c38164bd1ULL, 0xbfe96987a39105aaULL, 0xed0fd5a83b8a0bddULL}}},
+    {{{0x23b469d56f53e1d5ULL, 0x7dd8ebd616a133a3ULL, 0x04c40a1be845f3efULL, 0xb7472d735e489b33ULL}},
+     {{0xf87388ab48ffd3b4ULL, 0x32f73c23d0f09ef3ULL, 0x65dd0d115930876bULL, 0x9d365bc58c846b89ULL}}},
+    {{{0x6170ccd75d051d65ULL, 0xc943d6607527c077ULL, 0x95ae52193c2c0052ULL, 0x7a09d4076632fc08ULL}},
+     {{0x0058289e3d2eebd8ULL, 0xb37cf9c2a9ae961fULL, 0x7950fd304df39ea7ULL, 0x9252caeb8a8766caULL}}},
+    {{{0x1a336d41631b8788ULL, 0x5ff22c8a32f37dcbULL, 0xc322b2423d1711adULL, 0x833ce8a7cfe34d17ULL}},
+     {{0x12de5b0c6f386a67ULL, 0x148872506fc052f4ULL, 0x5b7bbb766fc90804ULL, 0x1bf3f9b0bfd9593fULL}}},
+    {{{0xc0aed6206af1cf44ULL, 0x327a59404e09109dULL, 0x02a1f6f8a8214764ULL, 0x2cfd18c517529d78ULL}},
+     {{0xacfa1210d0065faaULL, 0x0f8b6ea5df94e8b2ULL, 0x87b9ef34af42dd76ULL, 0xdf56b71e083ee4b4ULL}}},
+    {{{0xf8fb959dfdf4641dULL, 0x05a83a9a47c9004fULL, 0x15a4c4354bc18550ULL, 0xb1fc2eb1e66f5d85ULL}},
+     {{0x51be381d37d43e43ULL, 0x39ac51fb4254c3e0ULL, 0x6c5dde84f004236cULL, 0xb2cca26dc1d6ec3fULL}}}
+  },
+  {
+    {{{0x4bdc15728bf7fbeeULL, 0x76f465d836298799ULL, 0xf56f8d8fab177a84ULL, 0xddddb2d491d394c3ULL}},
+     {{0x3bec22883b3f1e84ULL, 0xd7d35e3a6f3e74d3ULL, 0x30d8c76c4b9c14a6ULL, 0x166471a9cf3261b6ULL}}},
+    {{{0x6542b4296bec5a77ULL, 0x8d5dd347548d9faeULL, 0x2f0a975e5722c1efULL, 0x0c1feb843643ecf4ULL}},
+     {{0x5e45b1f097af7059ULL, 0x65b9037a5c82c6b3ULL, 0x82600e26c9fb899fULL, 0xfe2571f93c00f839ULL}}},
+    {{{0x6fa9dd231f46d3c6ULL, 0xe8553f0c62bf0918ULL, 0x67d90a871654b448ULL, 0x5f0c7fca748c9ecfULL}},
+     {{0x920dee031f3d15deULL, 0x446f3c79341df1c6ULL, 0xaa94043d46872f5fULL, 0x8cf2c8770d29b9f0ULL}}},
+    {{{0xba778e005b399a2eULL, 0xf91ad27f19294c30ULL, 0xf32dafe9bf9d8264ULL, 0x8596de9447eacf69ULL}},
+     {{0x11fe4fad2eb8c27bULL, 0x2905c72ab46e5660ULL, 0x11ae68514b227747ULL, 0x3bb73d0726e0dc14ULL}}},
+    {{{0x829da7308c07c0b1ULL, 0x210f37c6a2f5e471ULL, 0x3842b7b9837c5913ULL, 0xc030fb2b711b6f74ULL}},
+     {{0x6f9fde8dec53d492ULL, 0x90fab6a7efe6f654ULL, 0x1a8c3dec9a8f70fdULL, 0xc1a141c8ca133271ULL}}},
+    {{{0x8f210d8d56e65785ULL, 0xb613afecef2f10e9ULL, 0xbd2df1844f519901ULL, 0xb152c86b745b5771ULL}},
+     {{0x658eefdbec8c181fULL, 0x2497a09e0bfc8b06ULL, 0xdef4dd56a96efe95ULL, 0x618dc033abb0e0a8ULL}}},
+    {{{0x1ea537051cf97370ULL, 0x6b533ff24d4d73d2ULL, 0x19f78852d1b39126ULL, 0x0d5b6c383e01e588ULL}},
+     {{0x36c9d2aba7bccdb6ULL, 0x58de682ee8cdc5dbULL, 0x23d3df2df6143ad7ULL, 0xb9ae0c30c1519febULL}}},
+    {{{0xc5d08e8c68fb5c61ULL, 0xb40b70ba275c9410ULL, 0x9dffe8f71a437a8bULL, 0x1b4d4aa8441059b5ULL}},
+     {{0x2502a8bc5091b477ULL, 0x9f3efe7220d40544ULL, 0xe3361105dc7bd276ULL, 0xfb8af24afbf2ceb7ULL}}},
+    {{{0xeb4c72877b48baa6ULL, 0x0f0c898112b1718eULL, 0x873a35ed7bc12537ULL, 0xfdaf7090a11a13e6ULL}},
+     {{0xd654929d2360bb50ULL, 0x7831ffaf6c3b6461ULL, 0x479e597cf006b513ULL, 0x180c29c3a41a00a4ULL}}},
+    {{{0x9a36cebed073faf8ULL, 0xf649aacfef21ed83ULL, 0x40cf08230e9b984dULL, 0x5a5e919e450a4d1bULL}},
+     {{0xb1ae2cd0de5962edULL, 0x06cf55e73b280deaULL, 0x4549adf4cb9495f5ULL, 0x5a0a11c9cb5ceebeULL}}},
+    {{{0xb0d60f4bf760df50ULL, 0x7300976881077562ULL, 0x8999326e6efbe626ULL, 0xbad52e544bda3e65ULL}},
+     {{0x58a170ae954d5916ULL, 0x5f717e2dcd9dc898ULL, 0xdf824b1d1416ad76ULL, 0xd05814cce9b7aee9ULL}}},
+    {{{0x53d02914065aae05ULL, 0x6c088dbc7563d963ULL, 0xcde42018724f8db0ULL, 0xe093539f7e7a046fULL}},
+     {{0xc48ee63dc963667bULL, 0x9877d521145247ebULL, 0x29b58289dc362f74ULL, 0xdf1c02c0dc1169bcULL}}},
+    {{{0xa5084a617bc1e39eULL, 0x6b1f7b09cf85d0e5ULL, 0x1f36bbd54f924118ULL, 0x16fa8f36dd9cdd68ULL}},
+     {{0x06ad182d198b8fb4ULL, 0x1818a1354b62d92cULL, 0x559741a607914eabULL, 0x12b4257a0934eb0fULL}}},
+    {{{0xe87708263a4d5257ULL, 0x347d0c23d65c76c2ULL, 0x05a0c7d68f8591b3ULL, 0x3608df8296ccb76aULL}},
+     {{0xd5f1150ca7e495bbULL, 0x5a041ee6cc4e19b1ULL, 0xb4a94e71ba7d2596ULL, 0xc318f9b7a6f722faULL}}},
+    {{{0xbd5ded9451c017a4ULL, 0xd76da02b5a194145ULL, 0xd8e1a3e554b8aa61ULL, 0xa59a0dd75c4b1f3fULL}},
+     {{0x0544ae41d6b894efULL, 0xc7311fac934bc517ULL, 0x815e04cdd73c14dcULL, 0x881ac0e6c1afdd5fULL}}},
+    {{{0xb1eb960b6ea7c9f7ULL, 0x353a2d3dc053e586ULL, 0x0bf6334a417d117eULL, 0x6007d85e5244ca4cULL}},
+     {{0x1be14669e087e145ULL, 0xf7d7734a92bf9209ULL, 0xca71ce604d78b452ULL, 0xbf171c67df40e4acULL}}}
+  },
+  {
+    {{{0xb3e3a3a81a72cf78ULL, 0x96a619835060ee3aULL, 0x6781676c46f02314ULL, 0xca6f32d9ddb78cdeULL}},
+     {{0x67332de0a467fc3eULL, 0x422fd19468da4b8aULL, 0x6111e65d1fd84253ULL, 0x7f2dfe2c9d7bbeffULL}}},
+    {{{0xb0c8cf33ffffa9beULL, 0x6900fbf911b2b3e7ULL, 0xf0891496e23ee517ULL, 0x5496a12158a234ffULL}},
+     {{0x8ef1aba89ec73c7dULL, 0x6a96d2626b59f8f1ULL, 0x84d12dbfa880cfb5ULL, 0x884638234bbcba77ULL}}},
+    {{{0x96bb4c980c488f6fULL, 0x207f127455ac6a04ULL, 0x9df9c9c6edae82d6ULL, 0x9826d0ded4530a99ULL}},
+     {{0xffa606795921a308ULL, 0x6865f28c878f989bULL, 0xd652b109bfbb28a2ULL, 0x59fe3838f140d411ULL}}},
+    {{{0x28fdb9e18cdd7f2aULL, 0xf09d782a26ba0129ULL, 0xf9a38497d7809994ULL, 0x7faa784c7ffb533eULL}},
+     {{0x0f4fe031fbeab3dfULL, 0xd7cbf122276f1febULL, 0x9c088e7ede15971eULL, 0xc3471807dd29d192ULL}}},
+    {{{0x1c6c46b10e1ad8d7ULL, 0x8ed277af4fb28fe8ULL, 0x22e89bcff22ed345ULL, 0x0d34298f5ece5b14ULL}},
+     {{0xf307cc0a0f3f6886ULL, 0x56a2e201016b79f9ULL, 0xfb538303bfc22749ULL, 0xd80476d870dc5b5cULL}}},
+    {{{0x130f35a76da0cb43ULL, 0x203fd96edaca2b4cULL, 0x9c849ee8bdec27d7ULL, 0x56816c1b70d6b1f3ULL}},
+     {{0xe61bf28e8363fabfULL, 0x6786a679059c5cb8ULL, 0xcf4fda634c3ceb2eULL, 0xa7af58e58cb699c0ULL}}},
+    {{{0xb704e6b2ac9316e5ULL, 0x196d532f050c2297ULL, 0x38edc12a22503433ULL, 0xce37fb295f9e6683ULL}},
+     {{0xa9a883b12df03e05ULL, 0x5fbc1dffc23b8476ULL, 0xe2c9d771ce5de15fULL, 0x4444ba92990ce458ULL}}},
+    {{{0x301668a47db686e4ULL, 0xdbd8fd5593a4f187ULL, 0x2d6f4f78cfefda32ULL, 0x1b02540fa9825d87ULL}},
+     {{0x9e63f55a01e9140eULL, 0x4f7a5731ae87dc5aULL, 0xee2bd5aae297ff96ULL, 0x87b13e2647b50af6ULL}}},
+    {{{0x7e0786edf4d4cb94ULL, 0xebd6315846633698ULL, 0xffbfdff65c8dc060ULL, 0xb2961f1a84c5e23dULL}},
+     {{0xcf5b9f899f63721eULL, 0x5ee234a74a521227ULL, 0x1a42902eca01aa57ULL, 0x635bba677cf298bfULL}}},
+    {{{0x0100e7fe3bd16cc8ULL, 0x7ccb5cdf6d65abaaULL, 0xdadf66c6f3e2461dULL, 0xf156cee2443182aeULL}},
+     {{0x4b883e2d2c3ebbb4ULL, 0xb24717a5a98fe467ULL, 0x494d5fd451e64404ULL, 0x5a6f6612ffa970faULL}}},
+    {{{0xe78fff94a5399627ULL, 0x6470fa1e74fa07cdULL, 0x2f0721d697a8e948ULL, 0xb0baa0db030e21bbULL}},
+     {{0xffb932733e0256cfULL, 0x1cb495b01d564449ULL, 0xead99a67ef5ca13aULL, 0xc72aa3c39d32c62bULL}}},
+    {{{0x3853a742ac533cadULL, 0x709e2199d349db03ULL, 0x74af4aff2221ef87ULL, 0x68310e380a01fd8eULL}},
+     {{0x94c24356a66a352eULL, 0x816089b2fa6657f0ULL, 0x99cd26e7e8923396ULL, 0xfae7d4f5b304840cULL}}},
+    {{{0x7a797a3f39f9f35dULL, 0xff079579076891a3ULL, 0xd2bb57685275ee77ULL, 0x9e4762df4fd58059ULL}},
+     {{0x3ba6ec25fe670c8bULL, 0xeca05432dbaca6f3ULL, 0xf6af148f8a40d7b4ULL, 0x559043b7209f8a82ULL}}},
+    {{{0x5eaf6f9f6a8a116bULL, 0x25fe0b655a2a7427ULL, 0x1fda278bf5951546ULL, 0x30d1c453d8bf04cdULL}},
+     {{0x1c62ab3945e2423bULL, 0x45877933f2df8fb9ULL, 0x2796113398257291ULL, 0x6913625a9d00c348ULL}}},
+    {{{0x83bd5ee2812919ffULL, 0xbee8324247d1e522ULL, 0xc205285ff88bb5b5ULL, 0xa50b82b7f1da39baULL}},
+     {{0xd064dd2d4458bdd5ULL, 0x3a2accd85e09da6bULL, 0x099edd923305de26ULL, 0x2ccef86136a587aeULL}}},
+    {{{0xde945c223bff706aULL, 0xec2614b288c12d0dULL, 0x808e880f15c59b32ULL, 0xc64963a828c9e22fULL}},
+     {{0x2461d0103312f33bULL, 0x455d0fa31fd91aaeULL, 0xb20b0ca4f3aac901ULL, 0x0672f4b9d9ea7e7fULL}}}
+  },
+  {
+    {{{0xe98c7283acb9bf4fULL, 0x444bf597c11b7b57ULL, 0xdd07d6fb1a7983dbULL, 0x5783a712717f37bcULL}},
+     {{0x780f777032de2472ULL, 0xcb66cef5064e6defULL, 0x5d82f6d46e08dc52ULL, 0x325674e83307b6b2ULL}}},
+    {{{0x7b9cb3a57284f8dcULL, 0x2dfcff9b14ef5b53ULL, 0x47419fee8979fb9bULL, 0x9522f0ef196b8270ULL}},
+     {{0x9625fd002a526986ULL, 0x7821fbe593e20752ULL, 0xdbf1f10908f51d0cULL, 0xad46dcfb4503d79cULL}}},
+    {{{0x1203da85f4ab9623ULL, 0xd2590c80615f8e4aULL, 0x041cb6e70a8bdfccULL, 0xbb7013e67a15870aULL}},
+     {{0x44be82d7a4294d3bULL, 0x62d80c21b2635d70ULL, 0xabeb9616ff0a41beULL, 0x5a2c81e3a026ea16ULL}}},
+    {{{0xdeb81f7ad6c91b6fULL, 0xdd72e3a1129636bbULL, 0x94ad23c7563afe5bULL, 0xcefd8896a2601bf5ULL}},
+     {{0xa86cd08bc1276069ULL, 0x659fe4059568b021ULL, 0x6faccae0ecb8a6faULL, 0xe0cbb593e0a40fabULL}}},
+    {{{0xc57c402c65460c26ULL, 0xf7e78446001aacfeULL, 0xfebae046e01c02abULL, 0x969f955378772ab5ULL}},
+     {{0x6ab80d2cf8d9e8d2ULL, 0x4e61db5ec6ce8e22ULL, 0x3446d0c4b70cc937ULL, 0x0395117b9aea807bULL}}},
+    {{{0x247e51aec29f8f10ULL, 0xaa47dbf07cd0f8d6ULL, 0xfd5b6b38473d87eeULL, 0xcc03febce4b3fec4ULL}},
+     {{0x7a459660648668a8ULL, 0x20d67d169a71c194ULL, 0x03605696f5f44f93ULL, 0x9c3d51f0630071f0ULL}}},
+    {{{0xd1cfa0a7411df8aaULL, 0xdd1cc9fe35f3582aULL, 0x09256b2e1b7aa0f6ULL, 0xb4422a3a61686242ULL}},
+     {{0xc1cc91c0c4f37be1ULL, 0xacbf4989cd2e5809ULL, 0x0f387cee97215642ULL, 0x3e4064dba9937f3fULL}}},
+    {{{0xb799dfaf58578397ULL, 0x1e60197769f83befULL, 0x843113ba71441b71ULL, 0x8fb7c7cfc5268a3bULL}},
+     {{0xfbb1245a6dc21d2fULL, 0xe7be765a98ef370dULL, 0xc128f343f74c0132ULL, 0xb4c03677cd2987a4ULL}}},
+    {{{0xef2c5b6e24584ee3ULL, 0x0fce20ba7d408adaULL, 0xc166407eb77da916ULL, 0x2738f570f113eb0cULL}},
+     {{0x51a5494dca8de99bULL, 0xb0c348dd8b92642bULL, 0x3240a938539c6655ULL, 0x1e58be221efc06ecULL}}},
+    {{{0xd06e6c3b1624c70eULL, 0x90bc45414d2015f2ULL, 0x7c49d41df359b7d7ULL, 0x818eb961fead43c7ULL}},
+     {{0x8070c9890ecea635ULL, 0x25ebc8f39c3588eaULL, 0xd28e50ecda336914ULL, 0xbef5415be1bdf8b2ULL}}},
+    {{{0xa34fc4394ca72dadULL, 0xa46e6d9f7336cf3dULL, 0x455d5720b7676e2bULL, 0x2a7ad16c42bf131cULL}},
+     {{0x737b3f859effb122ULL, 0xdc7f57e7ffcb2331ULL, 0x5ac466e71e3c436aULL, 0x69dd707ed72fc3d8ULL}}},
+    {{{0xe39c8ee0db10d9bbULL, 0x7743b186101131aaULL, 0xa51e6783f7024331ULL, 0x9075d42ca4e9c965ULL}},
+     {{0x7f2b9f66265c20f0ULL, 0x991d1a1a60ae032cULL, 0x957a40040383d339ULL, 0xe0d87b34025d3a6fULL}}},
+    {{{0xbc02a0ce815c3c95ULL, 0x9b3e7ffe142b6848ULL, 0x2dd15068f4f8ba92ULL, 0x32cee0eafffa315bULL}},
+     {{0xe4cd11b9556b8ac6ULL, 0x88a35be83a701206ULL, 0x77c568e7d98894e9ULL, 0xbc22a33505893f71ULL}}},
+    {{{0x004a56f0842b48a1ULL, 0x4cff056b6211bff4ULL, 0x172bad43a94f155fULL, 0x645cc8cccf98257dULL}},
+     {{0xbdf51b60ac85afd6ULL, 0x9c7b84fc33618001ULL, 0xf1dfd86f07f4d9f2ULL, 0x166c89d7d138afd3ULL}}},
+    {{{0x3844139cb32036a4ULL, 0xf3388a6fe7ced2c9ULL, 0x594aaf6e977268c9ULL, 0x692ab2355c3100e1ULL}},
+     {{0x1f859467d4a1aa14ULL, 0x80a52bd12b057604ULL, 0x5056a54226e1a6b2ULL, 0x2a614d7763df7f24ULL}}},
+    {{{0xddadb802c628643fULL, 0xa3d6ca5cfa3cb026ULL, 0xe0631df59131cac2ULL, 0xd1cc356672106688ULL}},
+     {{0xcdfedf6bb1cf74a4ULL, 0x8c70f5ec335abae1ULL, 0x50050b1395f4c60dULL, 0xd0899e0e0a1a5b2aULL}}}
+  },
+  {
+    {{{0x40a2711a5469adf5ULL, 0xcacfe005cbf954bdULL, 0x3ecd5596509c36dbULL, 0x1dedae6f1da9a68aULL}},
+     {{0xed52c1029e19b055ULL, 0xef225a242f60563aULL, 0xceab28425544c234ULL, 0x994e250209b99604ULL}}},
+    {{{0x97c03905274b1457ULL, 0xbe3d09c9c2f09689ULL, 0xf335207b94f68b6bULL, 0x9ab1abfcb71d67b3ULL}},
+     {{0x91b920e57cf69e8cULL, 0x1c81af5abf0a1146ULL, 0x928a00466ef3ba7bULL, 0x5bddef3c98148dacULL}}},
+    {{{0xd84f0a9cd1d3507dULL, 0x173702afe93d3b04ULL, 0x460fe90ac6634c1aULL, 0x70a263712dac9830ULL}},
+     {{0xa87f5c724629febeULL, 0x0016176de95581a7ULL, 0xac50a322ee238ea8ULL, 0x9799b21b4636a475ULL}}},
+    {{{0xb67df6775ea7641aULL, 0x1b78277d7eec90b7ULL, 0x6e93bacb9e407b8dULL, 0x28891cf8aacf8fcfULL}},
+     {{0x7c0affab4d1ec23dULL, 0xbf9351f416816b9dULL, 0x70473d84ec6e71f1ULL, 0xa9a55a3d96b41c43ULL}}},
+    {{{0xc582c9ce6a6bd1edULL, 0xe31eced4ed4d9b32ULL, 0x44000dfba5f38150ULL, 0x190eb77572be0703ULL}},
+     {{0xc81fcfa7ea81ed24ULL, 0x46a8940da5988a2fULL, 0xdcd1786134a1e169ULL, 0x165bf6c119deaa96ULL}}},
+    {{{0x3fe1751ba9ce2036ULL, 0x519c61befe80a3b4ULL, 0x5945b7bbc0e259dfULL, 0xf31f40def541848fULL}},
+     {{0xbae47695f6ff3236ULL, 0xeab558b6496d2445ULL, 0xffe3b60f3c4c9a4dULL, 0xe1529b37489bf579ULL}}},
+    {{{0x994342afc535c729ULL, 0x33009c212da3f739ULL, 0x6705337f19fc4e25ULL, 0xbc0a01c69967dc78ULL}},
+     {{0x6b955aa351777e03ULL, 0x01a402b8b50c5be7ULL, 0xb6f83bbfad14dff0ULL, 0x3bbfcd76e45aba86ULL}}},
+    {{{0xb23715d44f0516a2ULL, 0xb042da430d1ebd01ULL, 0xbbcab95a65dd7642ULL, 0x6adb944912a6a311ULL}},
+     {{0xe5240b7aa6f55eecULL, 0x90b415a04525b9b2ULL, 0x11027618f5422034ULL, 0x877968cbe9ea9ee7ULL}}},
+    {{{0xb1c119e63c5514f0ULL, 0x60129dd6e760cfe2ULL, 0xaafda15877ff29c5ULL, 0x95b9e2fba5c7d21aULL}},
+     {{0x29d76ae03d91ff92ULL, 0x1a16db18dccd672aULL, 0x2374c57d59d88451ULL, 0xbc9e7a45a4346334ULL}}},
+    {{{0xd7a2231d9d4b5079ULL, 0xebbfc880fc322963ULL, 0xfff4825aa6088f2cULL, 0x24e17f60a0e58d74ULL}},
+     {{0x88de3bdf1f053067ULL, 0xdae1ced3fec0cde0ULL, 0x3612d35afa267534ULL, 0x41a33b3e0900f2d3ULL}}},
+    {{{0x3a7c32a294db824bULL, 0x4e9b7c8286933c2aULL, 0xe5a27007e8275196ULL, 0x3ac44e813d5fa422ULL}},
+     {{0x012979925cc0bfb7ULL, 0x1fe6609915f37b2fULL, 0x73a0a3b354dcf477ULL, 0xd392ffb22ace1208ULL}}},
+    {{{0x10f415054fbc3d4eULL, 0x12ef0b2126b852e0ULL, 0x51e2f5011e09a186ULL, 0x57aa55fddaf43b56ULL}},
+     {{0x9c0d04c9abd15685ULL, 0xd26067117c028f53ULL, 0x9511c6a65965d93eULL, 0xa5e1556a7abe8dc5ULL}}},
+    {{{0xc9685f8815103f35ULL, 0x70662e5f64ca6d18ULL, 0x7a8f421bd3f3d13bULL, 0x970bd6eb64e0c710ULL}},
+     {{0xc852c521d4a79ef8ULL, 0x03a78501db5eff31ULL, 0x7ad98127ac81881cULL, 0x26ee0b7e496a8815ULL}}},
+    {{{0x5c09bc416a9444a7ULL, 0x98302aee7cf7998eULL, 0x787645f7cb371746ULL, 0x94f78dce101adacaULL}},
+     {{0x930bb0dba69dbd11ULL, 0x1f26056cf7951189ULL, 0xdfa6f625cad39c46ULL, 0xc54901352bdd36e4ULL}}},
+    {{{0xfa1dad2d34cf4289ULL, 0x2785098148657cb1ULL, 0x2438af2424cae1b4ULL, 0x3b7151c9f71f799bULL}},
+     {{0x79f57cc9129fe1f2ULL, 0x67e3b63e62bbab73ULL, 0xa57df26cbff3bb6fULL, 0x199e637fe00689cbULL}}},
+    {{{0x5f3c5348579a7009ULL, 0xc57248c258f430bfULL, 0x00c3f53ae900f1ccULL, 0x757c6a6643b0fae6ULL}},
+     {{0x86ed17a20892651cULL, 0xf1ba7be4406cdf5bULL, 0x555964e13bd31e9dULL, 0xba72da4ce07856a7ULL}}}
+  },
+  {
+    {{{0xbc8aa51671eaa1f8ULL, 0x4f2328ca9c710426ULL, 0x7d0e75d0623f0f43ULL, 0x3ca35b937649a65aULL}},
+     {{0x1bed248a964e20f7ULL, 0xa3d42ade026a9c7aULL, 0x41f76c0898681729ULL, 0x4f72b59d969910f2ULL}}},
+    {{{0x40def0e0dafbb834ULL, 0x933ab871c7d75da8ULL, 0xc2c00f65aea240efULL, 0x0457288cf077e6a3ULL}},
+     {{0xb53d54cd4296dbceULL, 0xe0d572acb1ccded2ULL, 0x925d28992947b1f8ULL, 0x3cd37446c6800a78ULL}}},
+    {{{0xee485425bc1e2883ULL, 0x791f0d77bfeb9f89ULL, 0x6cec9ddfcb042301ULL, 0x1ce555f4721ac03bULL}},
+     {{0xc04e531c6d981d92ULL, 0x076871e511016892ULL, 0x34fe5faef42cc6ccULL, 0x4967ebcd63dfd0bcULL}}},
+    {{{0x4fd6402fabc8a23cULL, 0x907451f2398a8106ULL, 0x5567483624ef25f3ULL, 0x2c275bf85b21c90dULL}},
+     {{0xc528f315ed157c42ULL, 0x6f4534c2804bf0acULL, 0x6858ac2792686758ULL, 0xbbf70e0f5d13a905ULL}}},
+    {{{0x27cfc1a2323058ecULL, 0xf3328954dd1bc0feULL, 0xdaa46b9aaba93a55ULL, 0x819886315e2f1c25ULL}},
+     {{0x6c01fd31324af3d9ULL, 0xb8f6f80dc2e570feULL, 0x026da1516ba9059dULL, 0x072f9454eb1884eaULL}}},
+    {{{0x2d2a5b39993b07bdULL, 0xcf9b09c8cd9d3c34ULL, 0x547ae02c4ebe67feULL, 0x507e82bb3e0453f1ULL}},
+     {{0x4d369a4186d9894cULL, 0x461228794b6dcf6dULL, 0x72696c6e4399c55dULL, 0x254ff7495768a8deULL}}},
+    {{{0x151e38448b993c99ULL, 0x9d6750417633628cULL, 0x6172ad941607635aULL, 0x8153133493fff7beULL}},
+     {{0x0a5089d84399182cULL, 0xc365f477a9656d80ULL, 0x8b0421f363d12106ULL, 0x4e6370be9fbbfa07ULL}}},
+    {{{0xde5372a376e368f9ULL, 0xf4ec483c3ba5f2edULL, 0x0c2eb59c6c51d99cULL, 0xa3b7a02cd99cfefdULL}},
+     {{0x8e8a27186bbdb757ULL, 0x1a11ae7d35beecd1ULL, 0x9d1bab9246fbbd66ULL, 0x7203484401270cebULL}}},
+    {{{0xb19ee8bd484ab424ULL, 0xd6fcab3a0b5e5e32ULL, 0x8e1ccf76e92e85e3ULL, 0xd41b93b5985182f1ULL}},
+     {{0xb68ae3202cb1166dULL, 0xddea0baa5c50f793ULL, 0x027446ef6937d97fULL, 0x97d5e6a5f82bbb52ULL}}},
+    {{{0x03a2f34901e37844ULL, 0xcad98bc3d866a627ULL, 0x1be63a9de12dc8adULL, 0xe3922994772258a1ULL}},
+     {{0x65069f61c011470aULL, 0xa7985d96cf496f11ULL, 0xf2e16ca3c1419ee4ULL, 0x7596526ab01d3f59ULL}}},
+    {{{0x4a011fd36128cd64ULL, 0xeec049ad0f413ae0ULL, 0xf18fb88e1f11d14bULL, 0xf6719e4ca957e00fULL}},
+     {{0xf92487b229adbcb0ULL, 0xa65466c0700bf45eULL, 0x1c1ad36fc1960216ULL, 0x70e356f4e7b1b868ULL}}},
+    {{{0x3d7d491c2ce6201bULL, 0x2af7397e23fee34dULL, 0x11ea7a6902b80a91ULL, 0x29296e5bd5af6aa3ULL}},
+     {{0x99c94229e8f80b90ULL, 0x5ad9d1fa57caf05eULL, 0x6c7878e531e5eafbULL, 0x38b26a5ca4597d09ULL}}},
+    {{{0xc38aa0de8a80b1ebULL, 0x520c903b2fe39caeULL, 0xc65ce8808478f817ULL, 0x3a5ebb420518869bULL}},
+     {{0xda4c758167e64fa7ULL, 0x0a66bc1f6b86afdaULL, 0x4f845b30568baa5fULL, 0x7aff07bee2ec932eULL}}},
+    {{{0x63b82d383ff165f3ULL, 0xbe24780f689cb369ULL, 0x183fcfabc7ac3db3ULL, 0xe74146d0b79c31f5ULL}},
+     {{0x826cf0d5219d8ce9ULL, 0x82d8e1744d4cd3f8ULL, 0xcd5bafc242b067baULL, 0x94bcbade19b6ef88ULL}}},
+    {{{0x7dbdb77e146732abULL, 0x8d83ee5b5d7c2f22ULL, 0x3ea769898bced0e4ULL, 0x6b83f5cdfe3d5b18ULL}},
+     {{0x7c9b208f806e2457ULL, 0x62395ca095ff8cf7ULL, 0x3a5c51109ce2a272ULL, 0x205210dd511aebafULL}}},
+    {{{0x8f88994a6c8d464eULL, 0x4280baab1549913dULL, 0x4e89217be043616fULL, 0xc05e0af4d7f03b07ULL}},
+     {{0xec19bd51abd183d9ULL, 0x92c7c59d9482ea30ULL, 0x5d0c6de7986540dcULL, 0xf8454f2690461d22ULL}}}
+  },
+  {
+    {{{0x5461a0517bbc23cfULL, 0xfa91cb20cd2da980ULL, 0xd0b65dcea6a9e8c5ULL, 0x05c548ac918a77b4ULL}},
+     {{0xd958c8a82bab6914ULL, 0x4fa92e0f0b5071a8ULL, 0xbbe66b6f07b7b0a8ULL, 0x8b95ff0adf148b33ULL}}},
+    {{{0x2ce2f29f638156fdULL, 0xf313d7af0ad08815ULL, 0x3348f0c9fed38414ULL, 0xe1b2de655266d3c0ULL}},
+     {{0x58fb93e3efdbde65ULL, 0xce95903b76462ef2ULL, 0x8bb4d1b587712e3bULL, 0x7e3ba37603512a1bULL}}},
+    {{{0x3916afdaf6bfd559ULL, 0x8c6cda3be4b92402ULL, 0x1492cfb731228243ULL, 0x53656e45fa716606ULL}},
+     {{0x742ff258235f17deULL, 0x7296e8ffda9030bbULL, 0xc1ccfeaff410973dULL, 0x14ea996c48aa89a1ULL}}},
+    {{{0x236367aa44eef5a7ULL, 0xb097b1f3dc6a276eULL, 0x29ce4216b9eaf372ULL, 0x705fc2e5162d8127ULL}},
+     {{0x71f38086039b122cULL, 0x94690fdb82d4165cULL, 0x67e7c7aec7a9de29ULL, 0xd3272b89424785b6ULL}}},
+    {{{0x040547e16bc5c9c5ULL, 0x78fa529e0c3a86ccULL, 0x58b1c079e46ab05aULL, 0x7e1e4b483a9dbf14ULL}},
+     {{0x7ae83325ac7a968fULL, 0x410305854623e6a0ULL, 0x1e60bfa2c9d12394ULL, 0x18728aefe449f4c2ULL}}},
+    {{{0x32b64cfb5e0d471bULL, 0xec19b53772578101ULL, 0x1f1e1e1293721801ULL, 0xdcf075b429f8c4bbULL}},
+     {{0xc05fb1e0fc9a96c8ULL, 0x47c7490e9a2dadffULL, 0x0999113949567ac3ULL, 0x036262770494beb4ULL}}},
+    {{{0x15787033744555d9ULL, 0x329c35ccdeda39e0ULL, 0xecf131be65c8ad2dULL, 0xa1b4863af61c8f02ULL}},
+     {{0x7452949bb685d2bbULL, 0x5fc186e0f3248ffdULL, 0xd35faa1d1a23c2f0ULL, 0xd129c45b78399c32ULL}}},
+    {{{0xaa2d3e55eb55399bULL, 0x34cfd6b0b7cc0745ULL, 0x4da502600e55784fULL, 0x5ab7abe62b57a0eaULL}},
+     {{0x3ef137e6b0984252ULL, 0x641ddbdc46ba67ccULL, 0x7c23953e57307351ULL, 0x07ef860ce305e174ULL}}},
+    {{{0x89ed412abe68815aULL, 0xd4da528ade79816eULL, 0x5d769e8962078211ULL, 0x35e691b31acad2e2ULL}},
+     {{0x7466d7780654e409ULL, 0x233764bce873a64dULL, 0xccbe545ce0b66eb6ULL, 0x70497caabd919557ULL}}},
+    {{{0x7bcec96a2dbfd934ULL, 0xf0d0e67b6bf3ec14ULL, 0x3ec2afe17610a8a4ULL, 0x9198e580b1a3c0ddULL}},
+     {{0xb0053b24bb7fe29bULL, 0x306b5d36b8d18261ULL, 0x88b8fdb34d1175ffULL, 0x277fc350e3e5decbULL}}},
+    {{{0x694e1770f3d78b82ULL, 0x9e4ebf7e33e65325ULL, 0x92a3c13ed4c1db66ULL, 0xcc0cb69ad755586bULL}},
+     {{0xe144c70bdeca760dULL, 0x2400d3d5a892aa86ULL, 0xfa5a607775d047f7ULL, 0xa9a42f12c573770bULL}}},
+    {{{0x23a48c73858f65e7ULL, 0x536753e2bd20f966ULL, 0xb4bc27e771aec932ULL, 0x7bb8dff94be71a3bULL}},
+     {{0x67ef615ef49e43c0ULL, 0x394336c1b8cf317bULL, 0xd69ee612852f5682ULL, 0xada165ad71005882ULL}}},
+    {{{0x38d8823789716472ULL, 0x38eb62cbaecc9714ULL, 0x76b3204833a20dd7ULL, 0x797434614fd264deULL}},
+     {{0xb15cb843ddb9253aULL, 0x795352fd88837109ULL, 0x91cdc20f126e5568ULL, 0x394f1b6992d63c35ULL}}},
+    {{{0x34504ca02db22ba7ULL, 0xb710fc532008b476ULL, 0x7d140876535a604eULL, 0x0b291c43d66d1364ULL}},
+     {{0x10bc6b0ad0cbbddaULL, 0x4c79ac61c00da7b3ULL, 0x2d48c4ad3a7ac452ULL, 0xef6f451ffadfb233ULL}}},
+    {{{0xb5b421d9b1b79da3ULL, 0x916d016b694e7d92ULL, 0xbbe03c58e42e35a1ULL, 0xba739699313d601aULL}},
+     {{0xb8965275ea9b4d65ULL, 0xc30956b1b47c3676ULL, 0xa0fad431f1a5f72fULL, 0x4ed611c39a067ba9ULL}}},
+    {{{0x08af1f0627194787ULL, 0xc2f5374b74db2ddeULL, 0x109d0ab7c3b04f65ULL, 0x37de29a8408711f2ULL}},
+     {{0x5a6a57d573b0556fULL, 0x57eb8337a97f9252ULL, 0x70f6b30ebb68f6f4ULL, 0xd5b4a02302b9d8b9ULL}}}
+  },
+  {
+    {{{0x525e1dfbb28893bfULL, 0x6c2c87765fc743b2ULL, 0x036ae5d8c1590bb1ULL, 0xeb65b634083a0cccULL}},
+     {{0x0dbcd72090b0b813ULL, 0x079e8107b62cbf95ULL, 0xfff31d092b0a2082ULL, 0x4701078f85e49f6bULL}}},
+    {{{0xc9d5d026eeb1f079ULL, 0x8c4c0baa27e8124dULL, 0x3742a048f29099ccULL, 0xfc3e6224a53a40d3ULL}},
+     {{0x61e5d6c2718639d2ULL, 0x3a33fc3111f617e6ULL, 0xb3b6891ca98733d2ULL, 0x8541a475883356e2ULL}}},
+    {{{0x2ef593bc6fd9b0f1ULL, 0x76b2cee1749b865eULL, 0x52ab2c04107556e7ULL, 0xf35ca51738e9a526ULL}},
+     {{0x398a2d9aa6e0a717ULL, 0x67d58d2c5eeea53dULL, 0x679a2b0b907f992eULL, 0xd17a5531455dd144ULL}}},
+    {{{0xd75667b1c8df087aULL, 0x4bced983cc6f37bcULL, 0x07dde696231930f4ULL, 0xbf6859b718b204feULL}},
+     {{0xf33c8f807c78ad3bULL, 0x6883a0a80491d3c6ULL, 0x8ef34c43053820eeULL, 0x43c232ca65f120ffULL}}},
+    {{{0x293f070aa150ec1aULL, 0x26de23292dd82d3fULL, 0x63f42c0b86f9f3b6ULL, 0x4c074e2cfb43a8f0ULL}},
+     {{0x616f6666b3f038beULL, 0xf5108a767fe2cb10ULL, 0xd783d7bedf38b795ULL, 0x0c50a958f7f6ac7dULL}}},
+    {{{0x22ded41c4b00262fULL, 0x1bede9877909f827ULL, 0x29944bff7c6a30d8ULL, 0x40fd630d57c21c4cULL}},
+     {{0xe8d1b82d3f6cb8e0ULL, 0x99a94d3b5943960dULL, 0x10834c536e2af320ULL, 0x9cb6b8bb79537f8bULL}}},
+    {{{0x13502036b46d3e5bULL, 0x12bc793763f50f80ULL, 0x5fd71d6dfa8cbd17ULL, 0x0cca1d8b73bae882ULL}},
+     {{0x413c5983f67f6444ULL, 0x67f6e61872cce52dULL, 0x4e835508a6472425ULL, 0x9394c0a559500568ULL}}},
+    {{{0x4f4f5f5d10e566a9ULL, 0x5bd1e5f600b02bdfULL, 0xd1a60272c2bb7ba9ULL, 0xc77f85e4b6a16c93ULL}},
+     {{0x7ff40c21265ce874ULL, 0x0b50eb8a38597b57ULL, 0x955152167a024d3fULL, 0x297017c0837414c0ULL}}},
+    {{{0xaeeb8dc07b0fa761ULL, 0xa37b8380c26d71e5ULL, 0x360be02a28797bf1ULL, 0x50f8879da1c88e55ULL}},
+     {{0x178793f6d46fa824ULL, 0xe7391a9de3d019a4ULL, 0x850759cf422f1d75ULL, 0x3fad8088e4f386c8ULL}}},
+    {{{0xa68f843754a94b55ULL, 0x3723f970bb0efa2fULL, 0xeeb10f70491f63c1ULL, 0x6d782b9f291a12beULL}},
+     {{0xc9908ed5fa4a7501ULL, 0x519b995214615ba2ULL, 0x9110b570eb623596ULL, 0xa4588b4a70655b8cULL}}},
+    {{{0x171fce82fb50595dULL, 0xd61a9a06fc0a6dc8ULL, 0x0fa934a7fce05856ULL, 0x54218a7e738520b1ULL}},
+     {{0x9d146755de21d4f9ULL, 0x49c46fff432001cdULL, 0xdcc10093235b3d92ULL, 0x8b910056540a4ddeULL}}},
+    {{{0x4a20d5514fab03f3ULL, 0xf972f850c33dfac8ULL, 0x87aeff1798dc32a1ULL, 0x5ac19838de4ac140ULL}},
+     {{0x5097eef5932dddddULL, 0x63f2b38bd2e36cf3ULL, 0x5b48f167abe8d570ULL, 0x4b82c1173aeb03b3ULL}}},
+    {{{0x64c1ea62b9d45467ULL, 0xf67f163f2ad24ebfULL, 0xbf762dc73f80751cULL, 0x0419f4e024b61a24ULL}},
+     {{0x75f1221f79ab9c0cULL, 0x31af973ed51620fdULL, 0xb6b21675d0dee4dfULL, 0x8bb70fe481c8fcbcULL}}},
+    {{{0xa3e021b3898f27ddULL, 0x7ddab8da1e10eb11ULL, 0xdf6f352c414cf629ULL, 0x4d528dc4056701c1ULL}},
+     {{0x9f09da9f9a54e6e4ULL, 0x68c45746dca20259ULL, 0xd1fe0b201f3f1440ULL, 0xf4e81b2229fde914ULL}}},
+    {{{0xb191cb3fd27cb901ULL, 0x5e45bd5151a614eeULL, 0x857f88aa90e2d984ULL, 0xc4e84a1a1c03793dULL}},
+     {{0x8a9f88e6afe989e0ULL, 0x3b7a049cefddb464ULL, 0x14c53246c4b138c2ULL, 0x6c7166f5a6f458f2ULL}}},
+    {{{0x8cf9a664ce5770efULL, 0x8a1140d7ce1b7532ULL, 0xd83094a0cdaef9afULL, 0xbc84c45b0f952741ULL}},
+     {{0xa91c209d3f999ea8ULL, 0x0c0475057f925464ULL, 0x6618928d7b439d9eULL, 0x0245acfd6bf2d14eULL}}}
+  },
+  {
+    {{{0x73d2847b814381aaULL, 0x83918ce546f49b3fULL, 0xaafd6e2f130809b4ULL, 0x3998b02490beb9e9ULL}},
+     {{0xfb1519fd67155708ULL, 0x04696ea7bdf96238ULL, 0x614a45695f324f0cULL, 0xdff99e8f9a386935ULL}}},
+    {{{0xaf1506134c1c09d0ULL, 0x47db4c819a74d428ULL, 0x4ee841911e236711ULL, 0x829cd367cabb5fb3ULL}},
+     {{0x76d60838c3b4d8feULL, 0x916ca2c455153c1dULL, 0x8b90054623122d5fULL, 0x17d07604b7cd90c8ULL}}},
+    {{{0x9c6a9db0e58a62d8ULL, 0x8616d5ecc3f0b481ULL, 0x8d241664bab04e43ULL, 0xbf7084879bb99454ULL}},
+     {{0xf58929f012395234ULL, 0x25637df0c4dd3916ULL, 0x1dc52d5cb2664f08ULL, 0x5079a66b96461892ULL}}},
+    {{{0x0c3cccdfdcd28c08ULL, 0xd31c5da4d7fb3efbULL, 0x15857c9674b85c29ULL, 0x6c0bdbd3c3ad2e00ULL}},
+     {{0x9db4b3b2d7df30e1ULL, 0x5192fe8b6044a524ULL, 0x752c767ec831653dULL, 0xdd9f8f49a415d6dcULL}}},
+    {{{0x63f3a719c20b5a79ULL, 0xa984c054fa5a0821ULL, 0xc5998e8f80acaac7ULL, 0xb4a3962cda54aa8bULL}},
+     {{0x426725abd6f9903eULL, 0x651263d4cc6e16d9ULL, 0xb125f6e39b1f8aafULL, 0x05fd0c841122ae2eULL}}},
+    {{{0x22c30b9bd7731c95ULL, 0xd73cbee1d31eda52ULL, 0x0a541e051c5fde0aULL, 0x1f19395b98d7b3deULL}},
+     {{0x58b9b75c4b2c51e8ULL, 0x0bfed845c2eb6a2dULL, 0x74c0dedeb111072bULL, 0xe502ad4eada4389aULL}}},
+    {{{0x6aa91974166e2199ULL, 0xd4bed8e09558ded6ULL, 0xdd4a3b8ed1a3ad77ULL, 0xa18f2b64d0bb2917ULL}},
+     {{0xa12ff362088be93eULL, 0x3997a90401e4788fULL, 0x898562f41b1ddd17ULL, 0xea694f71013f3227ULL}}},
+    {{{0x7545ac1cdf7ae2faULL, 0xbc99fcfc36f36cd6ULL, 0x2a29cba4f8f0f4eaULL, 0x6e4ed405230976eaULL}},
+     {{0x4975db94cced66ecULL, 0xeedbf4e400f9dfd3ULL, 0x9a8ff43eb567b65aULL, 0x6556052bc3cb3d72ULL}}},
+    {{{0xa66eb5949af79ef5ULL, 0x20473693755777adULL, 0xb1938059be1b84f9ULL, 0x69d29aaefa7c7d1aULL}},
+     {{0x51ebee3526499a8dULL, 0x81c204b9b582bbe2ULL, 0xde3ca8cd2450661eULL, 0x6bb262c55b4e8bbaULL}}},
+    {{{0x91996da3bbe86077ULL, 0x36c556c6dd0a81cdULL, 0x9c980ee1c4525415ULL, 0xbbf1d53fa3e706c3ULL}},
+     {{0x37446751f6cfc367ULL, 0x387c2d6bdd07bf8cULL, 0x50ae97bdfa938618ULL, 0x635a8d833d510eaaULL}}},
+    {{{0xe4bc4c3b3488b469ULL, 0xfb44b4dbb5b20056ULL, 0x0bd26810ef3fe8c7ULL, 0x9beecb18c2d06f59ULL}},
+     {{0x0339d8d00c814d0fULL, 0xbb2608fd0c990dbbULL, 0xf6f4cbffaaf5f1e5ULL, 0xdd99f5ab37507e54ULL}}},
+    {{{0xb8edc0bd9249107aULL, 0xc5207952d65e657aULL, 0xff9adc193b3fbeb5ULL, 0x282da5c8da6bbcdbULL}},
+     {{0x289552978051e09fULL, 0x5011738f8370a027ULL, 0xe9c93ef17fb9e5adULL, 0x38b3b0fa2c37bfa7ULL}}},
+    {{{0xfbf672db2c7e65e3ULL, 0x4eeaf465baaa470cULL, 0xb38b27478fc9682cULL, 0x04bf1590523171e4ULL}},
+     {{0x3e4f0b33607969d9ULL, 0x43b9d76fde01bf63ULL, 0x7fbd42924b3142f2ULL, 0x63c41842f7ed16eaULL}}},
+    {{{0xdb8978622ef2ef4aULL, 0x90e299bbbef58aa5ULL, 0x7bf6c8ce1a7741afULL, 0xd5f55ced962f99bdULL}},
+     {{0x98c3293ad47d8b1eULL, 0xff58d6b9219b0575ULL, 0xa41eefe9d42c5288ULL, 0x03bddb3499d35ed8ULL}}},
+    {{{0x636c8e869d6d7ebcULL, 0x0fc0c29957f35ea3ULL, 0x8ad50b0d6aa53f0cULL, 0xadac4f85e03bf89bULL}},
+     {{0x8986f64f945ca2f7ULL, 0x7d45885c8779ba7dULL, 0xae474e10531d4272ULL, 0xa6fcbbbbe5710a79ULL}}},
+    {{{0x780d54a07a0d89c5ULL, 0xce6c524054d62709ULL, 0x7c9053b6866cf818ULL, 0x4af7dd1e673cb28aULL}},
+     {{0x39473609e5eddd07ULL, 0x99ebef5bdbe6c33fULL, 0x93f5b061a613146dULL, 0x469e4d18faf7345aULL}}}
+  },
+  {
+    {{{0x0fa7810582d39ad0ULL, 0xbebfb8460aab0b58ULL, 0xcdf9e016ed9c790cULL, 0xf00da88e3d66968eULL}},
+     {{0x1bb99b8682d52aaaULL, 0x500601019070dd09ULL, 0x319961e6dc65c56cULL, 0x333d5933e3753478ULL}}},
+    {{{0xc9686dd106e241aeULL, 0xabc318dbd1989ad3ULL, 0xa9e8bf2d6aa20493ULL, 0xf7c841d0af97de9dULL}},
+     {{0x05f65d66833847a5ULL, 0x6f961ed53f4611e9ULL, 0x350b9ee5740ab399ULL, 0x0da09897f6ce3fffULL}}},
+    {{{0x4ff1a2fada22a3deULL, 0x8cba0902e64936e9ULL, 0x4efc9d37440731aaULL, 0x05923f16d0b966f5ULL}},
+     {{0xa790ebe4e98b4f87ULL, 0x9f87a789e4f9283cULL, 0x5669230b218a08a1ULL, 0x217fe064c3f80622ULL}}},
+    {{{0xab57eb411272c728ULL, 0xb0f5a32443178da4ULL, 0x189a2a43af3cd6ddULL, 0xe1b2792ce9c026e3ULL}},
+     {{0x1d6e300b756377f7ULL, 0xaa3058fad6ed6e36ULL, 0x8a068526fd29e503ULL, 0x3591290f7aba3564ULL}}},
+    {{{0x4226c2aa9399ded1ULL, 0xf83ea8394552633aULL, 0x53187e12da0af11dULL, 0x65089a2de66a0bceULL}},
+     {{0x34125696ab090550ULL, 0x0e4e32645f6a8730ULL, 0x24aa81ff272f557eULL, 0x503da8daacbcca7fULL}}},
+    {{{0x69449d45d787a491ULL, 0xbd04f5517a65fa94ULL, 0x7a4dbee44f41ae92ULL, 0x2300c968e16d9906ULL}},
+     {{0xd1c835555922d732ULL, 0xe8c485d43b0e2a3dULL, 0x036af6691c257875ULL, 0xdd3e3ea8463e9622ULL}}},
+    {{{0x3de75167e9c8ecccULL, 0x2243517c60a2cd56ULL, 0xcb1df5c17a1c38fdULL, 0x71c5ad9e9ebac40cULL}},
+     {{0x67a1ccc9a49f2b61ULL, 0x182753e3f97d9cb1ULL, 0x7ab54ddd31fd80d2ULL, 0x16c41636a576d9c6ULL}}},
+    {{{0xb3c960ec827edcdaULL, 0xdf8304dff598a3c4ULL, 0xffead6a9452ebdd3ULL, 0x6d2e91bc539da09dULL}},
+     {{0x8cc0df9ca7585a2eULL, 0x7d313396f18bc8b4ULL, 0x386f32893dc5458aULL, 0x01299ecdc2c8eee5ULL}}},
+    {{{0xbfb1fb7879756064ULL, 0x94efa73a92c80991ULL, 0x7f954b48b01d4826ULL, 0xec8b001b953270d0ULL}},
+     {{0x581fcec64e70a817ULL, 0x80d8ac467184a421ULL, 0x8d397f996c753521ULL, 0x44c9412f0a68d1e1ULL}}},
+    {{{0xb7b2275756797f7aULL, 0x1a05c90d9a050c42ULL, 0xe18ae4a05757090dULL, 0x667f4f69fcc60929ULL}},
+     {{0x49e806f2e9fb7b6aULL, 0xf193872dc082a547ULL, 0x0de17c841d27a569ULL, 0xd75681f4ca916827ULL}}},
+    {{{0xe896eb663c33316dULL, 0xc729f0dc9d71490eULL, 0xd24e2e0f01d00abcULL, 0xcbc237674387cce6ULL}},
+     {{0xa9ccaa6a1a615f2dULL, 0xd32c92185ff04ffcULL, 0x976a27f035194a9fULL, 0x18648ecaac85b9c4ULL}}},
+    {{{0xba4bd8ffae92a138ULL, 0xea2e62b2df6901e6ULL, 0x06c4688adb1c03e3ULL, 0x1ba54794fdd9046aULL}},
+     {{0xe3e720234c86221aULL, 0x372852b30e2c21f8ULL, 0xe013c1b9386be74eULL, 0xcd8e49190da6722dULL}}},
+    {{{0x00f9660ca2113b1dULL, 0x467e4518c1469b5fULL, 0xbbd7ce38a3dc2ef2ULL, 0x34883122cd575f25ULL}},
+     {{0x0ba61ca9a6746241ULL, 0x44d64173f5d4721dULL, 0x063d170119c7dcdaULL, 0x7c6f5337b03e6a75ULL}}},
+    {{{0x2935cb28cb7bcf57ULL, 0xad4da65f26751455ULL, 0xfe332d89ba22fef5ULL, 0x528096351ebf2c39ULL}},
+     {{0x88d7512ecda726c1ULL, 0x74cdbf9c7859b583ULL, 0x9e910ba332089672ULL, 0xbedf1e771e49ce4dULL}}},
+    {{{0x32a355250ac96387ULL, 0x026f9698202c5842ULL, 0x028e00bc5cf00943ULL, 0x4998745859bad164ULL}},
+     {{0x28cc07183aec3d3bULL, 0x133aec12dde8b18cULL, 0xd3c1a487cdee442aULL, 0xd8da554e4405a1f7ULL}}},
+    {{{0x0255e90d9b921fb8ULL, 0xb22bc738d2086fd6ULL, 0x362d22c5e963751aULL, 0xd7d2b016559c6150ULL}},
+     {{0xfeed6baab7a4044dULL, 0x21d4711440a3df7eULL, 0x8356fc9619342663ULL, 0x1bab7c54eba1f1c5ULL}}}
+  },
+  {
+    {{{0x0a1d5a771e8556cfULL, 0x76ca91b9d20c46e4ULL, 0xf418181a5d2464d6ULL, 0xe948a47550b6a91fULL}},
+     {{0xb194e69cea6e807cULL, 0x8a5b9aad5645c6dfULL, 0x2188d668a792ed81ULL, 0xf57b5a60fd3845cdULL}}},
+    {{{0xe54317db198eb59eULL, 0x66e701dabaa0df64ULL, 0xaaf81bfac73533c0ULL, 0xde3b3eb1fb57c65cULL}},
+     {{0x9f1e6807af4f834aULL, 0xbd19641e83aeba99ULL, 0x52f8e09ead1de438ULL, 0x8ea4842da04085cdULL}}},
+    {{{0x71d323917d14ebdfULL, 0x8d0fbc0a15e0f21dULL, 0x4f6e542239047befULL, 0x81cb0db5ca2fc4d5ULL}},
+     {{0xb96a85d9713ea669ULL, 0x99ef640eaed4365aULL, 0x5993d9ad1f1a3355ULL, 0xa8874456b24b7171ULL}}},
+    {{{0xdbf8a98109f0b7b3ULL, 0x344cf50977a65a49ULL, 0xf8d7256d73091e28ULL, 0x55ba063698e1997aULL}},
+     {{0x9675d38c83aaf7c9ULL, 0xdec5825a10c4f633ULL, 0xd9c1992723c64cdbULL, 0x456aefcac84bee04ULL}}},
+    {{{0x2c9ab446916baf96ULL, 0x316ed49e6066c6f8ULL, 0xe3f8396986ca2656ULL, 0x5aa063293e9d1edcULL}},
+     {{0xc6a0e58deea342b7ULL, 0xfc84db55e32d59a0ULL, 0x22abda892df34e4cULL, 0x3eac90cc238793d2ULL}}},
+    {{{0xe21e422722098c3fULL, 0x5019bdc1bb6e099bULL, 0x878762aafdd1cb09ULL, 0x900c317d958b5734ULL}},
+     {{0x3f53bb91ed0c0d4fULL, 0xc2f29c0578c1cd02ULL, 0x72ba989e0dadb889ULL, 0x42d7cd9bd1d97e7dULL}}},
+    {{{0xd371372c68a21394ULL, 0xbb29adde9063e300ULL, 0xefba50193a43d63fULL, 0xf7e7f927f1ec892aULL}},
+     {{0x487724208ac0eb44ULL, 0x508cb083ad629ad0ULL, 0x7c64710628fc6d95ULL, 0xcffce60386ca9d18ULL}}},
+    {{{0x272a78279ab41260ULL, 0xef3dfc63c0d27fe6ULL, 0x43ec5e9073012f03ULL, 0x9d01e82f696163fbULL}},
+     {{0x9ee6785e7172e734ULL, 0x746a3e1746599eb7ULL, 0x98016d665f54fd25ULL, 0x7d30ebdc4cd65483ULL}}},
+    {{{0x42307b73b2410548ULL, 0x6460dbaeff32a614ULL, 0x58f52b961213a0d4ULL, 0xff1d8cf03b67194dULL}},
+     {{0xea49ae7cedc5147eULL, 0x55153e876d66062dULL, 0x725bb0ee5c347cb5ULL, 0xd415cf24770bfd4eULL}}},
+    {{{0xa0f7b53c39132d1dULL, 0x3d66bfd7f82d935fULL, 0xf57779232f25239dULL, 0x8a7959f3bcce9f27ULL}},
+     {{0xc02cbfcd9b530bcbULL, 0xe52b9ef01b90f947ULL, 0xd2cfe024b54033cbULL, 0xca947953bd1f32e9ULL}}},
+    {{{0x611b2bfc9cbd7184ULL, 0x3d65c237768eb7d3ULL, 0x1e8223383ea93060ULL, 0x2325a67a277dbe7bULL}},
+     {{0x2fa0f0c91467c37bULL, 0x1fd8d0ba2694756eULL, 0x99ed240f78b95614ULL, 0x7213bbf30ae4c3c5ULL}}},
+    {{{0x8692bf87e1d53dd5ULL, 0x4b0299017d7de883ULL, 0x176305d7977a2e63ULL, 0x8ebb70ed548aa9d8ULL}},
+     {{0xc845857a1922c7a9ULL, 0x859fceb62b28f74bULL, 0x1b68d296c010b722ULL, 0x1586200293cf4d7eULL}}},
+    {{{0x717df67a0a092724ULL, 0x02382c11dcb81355ULL, 0x786a48ec120de9b6ULL, 0x2994ffd2cf63f31dULL}},
+     {{0x6047c8fb0fd5c192ULL, 0x296d1a80d3d31a49ULL, 0x0a6492d9396c4a83ULL, 0x8cc18cd3048541a0ULL}}},
+    {{{0xf03b455b9d91eaadULL, 0x274056c0317fbb78ULL, 0x189b1677301e42eaULL, 0x5cc348e7c13f178fULL}},
+     {{0xaa076c5abfd80e82ULL, 0x04ca2ce1daa345d5ULL, 0x00633c0be553546eULL, 0x34b96fac739eae62ULL}}},
+    {{{0xa3b6445a5b544888ULL, 0xdcb017736c594c20ULL, 0x673d200f2eb7a84eULL, 0xa880c2a8d6f02218ULL}},
+     {{0xb50f56a15c4c0992ULL, 0xb2b491dc80507064ULL, 0x7e4ab60b5439b29dULL, 0x8528218d61943ff7ULL}}},
+    {{{0x36a94707442ce0c9ULL, 0xaf736efdf77b61c1ULL, 0x581686bfc4b04fbeULL, 0xa9f788e3c19d67daULL}},
+     {{0x650cf648c8fac656ULL, 0x150a8ee8fad2c24dULL, 0x7a91eff25a3b11c2ULL, 0x42963e1234f9f5f2ULL}}}
+  },
+  {
+    {{{0x37820701efbbed06ULL, 0xedc28c044217d9ccULL, 0xfcd4d12cece4325eULL, 0xae33286e1c6118b1ULL}},
+     {{0x6a6de95918cb4f0eULL, 0x0a2a8a691af0bad7ULL, 0x9a6164ef2239c4e9ULL, 0x07204f441779862aULL}}},
+    {{{0x92de91541d259d51ULL, 0xe46d6861d89bad0dULL, 0x0e2139099a9fe810ULL, 0x8d8efaa130979947ULL}},
+     {{0xe2515daa7f71fa78ULL, 0xffbab900d71b9899ULL, 0xa6ccab59be800a24ULL, 0x4e396ede49ba6adfULL}}},
+    {{{0x2e5d9abcd00d59c8ULL, 0x5a6e78eb1521a63bULL, 0x5d3aa77588f6c447ULL, 0xff9670af4e126dcaULL}},
+     {{0x8436fcbdd4ae9dafULL, 0x7c641c6efcbbc999ULL, 0x5dbf8cc6efa083beULL, 0xcb0ba5ba6e23ef3fULL}}},
+    {{{0xef33a334465add37ULL, 0x69e4347d9d42dc7dULL, 0xe2b586c6ec21f532ULL, 0x2eb0568dc94fc8abULL}},
+     {{0xf43b7647aae69721ULL, 0x4139df9f2a6e9a60ULL, 0xb456f19c885090b3ULL, 0xadb591fbe4a7699fULL}}},
+    {{{0xb775076fb21b7147ULL, 0x458bb474c37d7364ULL, 0xd72915793aa9f5b3ULL, 0xb0876102cc569399ULL}},
+     {{0xcbd888b7eebf1178ULL, 0x57e53ad1f31ce191ULL, 0xefd5010d8e1b306cULL, 0xa7c94dfb59f1cdf6ULL}}},
+    {{{0x74a1203116cf3c31ULL, 0x15a6d86b537ea009ULL, 0xee9ad187fdf265f0ULL, 0xc669d6a7c89b0520ULL}},
+     {{0x60e0439edde66d22ULL, 0xa551868faa4cdc5bULL, 0x05a151ee333f0882ULL, 0xc7defeef67c6a40eULL}}},
+    {{{0xd085ffe79b1562b5ULL, 0xefa3c27631f88c44ULL, 0xd8f7f4a5880a4e8fULL, 0x8ff916989dfdc2e8ULL}},
+     {{0x440878eabe930e2cULL, 0x2ec8b826a33193f6ULL, 0x179e1c28ab7bd961ULL, 0x5e2f72ff19d94ac0ULL}}},
+    {{{0xe11122124318fbadULL, 0x3818588468e97db6ULL, 0x8800830a06d3793bULL, 0x0ab94c4b566384cfULL}},
+     {{0x2feae09069054075ULL, 0xd23f0612ef42beb2ULL, 0xa71a108c3dea90afULL, 0xc15d3fe23e267aabULL}}},
+    {{{0x72aaf30eb1625821ULL, 0x7ee93cb1f825485dULL, 0x82407fd715da64aeULL, 0x3bd08bae1bb72302ULL}},
+     {{0x47fc52ebed21c1e1ULL, 0x1ef9af1074dd6a38ULL, 0xef43c8badf3d8ca2ULL, 0xec9a52506de8cc3fULL}}},
+    {{{0xa9d5bf1cedebc699ULL, 0x12ab0b7c9dcd6a08ULL, 0x8aca61b054590e82ULL, 0x0d0f5f5238b6f8d9ULL}},
+     {{0x8556a68f485061f1ULL, 0x3c91b0e4c79e4d39ULL, 0x0942026d6d0af19bULL, 0xe76f63eb328dce57ULL}}},
+    {{{0xc69c260045c981c0ULL, 0x8c3d248c74a89fdeULL, 0xb51bb36c3ae6d90aULL, 0xea667e66c984db6cULL}},
+     {{0xecd8e43f3d23533dULL, 0x55fee51a431f0d58ULL, 0xf0e79caa19f48e21ULL, 0x5c91516132c81d00ULL}}},
+    {{{0x195566763fda9d1cULL, 0x5f416511ac86213aULL, 0xbe799f2d5b56543bULL, 0x4a2d33d47f527b8fULL}},
+     {{0x9b261a4a8c757795ULL, 0x3754a423d389d737ULL, 0x7aaa73fa3325c3e4ULL, 0x86485c2068b1d63dULL}}},
+    {{{0xaadb99630572d932ULL, 0xd4ca15c0eb513354ULL, 0x265eefab4c8b1806ULL, 0x354c26dbbd3eada3ULL}},
+     {{0x140fb192a543e9c0ULL, 0x44a0d6f8a091f2b0ULL, 0x9be52092a9cd2317ULL, 0xaa68e022e3fc2ee0ULL}}},
+    {{{0x9b69d453301c8de9ULL, 0xf158eae445bd969bULL, 0xe1a26d6782dcd654ULL, 0x51b9ed8c2c156c36ULL}},
+     {{0x3dfac26cfc1d5a0aULL, 0xa9491d992d43e582ULL, 0xdd397bf495f0a789ULL, 0x6c8cd913875ef1c7ULL}}},
+    {{{0x853d11ea76b77d69ULL, 0x9df309d70573307cULL, 0x172f7f81f45de625ULL, 0x1f3900909480cddcULL}},
+     {{0x1ed278c6fab0988bULL, 0xd6c002ead965ee86ULL, 0xda53fc14917c439fULL, 0xc374717502c685e8ULL}}},
+    {{{0x3abdc8bec118494bULL, 0xf9d61b1c790bd9dcULL, 0xd030aa4bbebed7e9ULL, 0x0d4ea2f72ab244bbULL}},
+     {{0xbdbf61b8d18183e7ULL, 0x61963a7c0af9ffedULL, 0xab4c0efa3916c801ULL, 0x472c2b429dde2dd9ULL}}}
+  },
+  {
+    {{{0xed1090264245d60fULL, 0x796429cb72a1e231ULL, 0x01fd381ac9fac052ULL, 0x9084278d2ef534baULL}},
+     {{0x2c180da6cbf7b28aULL, 0xbfba7998c2004819ULL, 0x33f8ca566f702c4dULL, 0x2c58422272656c5aULL}}},
+    {{{0x607dfeca9a76981cULL, 0x1acd2f1024b14c71ULL, 0x21631434108bebe1ULL, 0xe51ee682b20c89f4ULL}},
+     {{0x6604c82864fc5645ULL, 0x7bfdab3a7dff425bULL, 0x6c1a3ba195123ca8ULL, 0x8b845737ef2c20efULL}}},
+    {{{0x19bb063214609176ULL, 0x88496399bd0f5479ULL, 0xd870a0b27387eb4bULL, 0xc9fa13748ae9b641ULL}},
+     {{0x14051e87a1cec80dULL, 0xe92cf9848d5f435dULL, 0x8012b40e1e5735d8ULL, 0x8a10adc699899817ULL}}},
+    {{{0x05a55907ac953daeULL, 0xaa7747ff1ae24295ULL, 0x34e71c7c7efd1a6bULL, 0x8ce2fc17f8b5e176ULL}},
+     {{0x19994ff7c162b3c8ULL, 0x4d1dc9436071bea1ULL, 0x2be3ccc9eeeef981ULL, 0x0a7866e700bd645fULL}}},
+    {{{0xf519d0d9cdac7220ULL, 0xce3294eb41c4a28bULL, 0xd15d93d42eff5afdULL, 0x3c524f4f5a3695c1ULL}},
+     {{0x7ae9d53b60bc35c4ULL, 0xf0035e74e112dfabULL, 0x5adeb1de40a2336cULL, 0x66769d7712cc4222ULL}}},
+    {{{0x246611df2b72236bULL, 0x621eb3c6cc9be674ULL, 0xf41b766247ef1ab3ULL, 0x30334e2a81769510ULL}},
+     {{0x6c413e68a17b791fULL, 0x89f2badd66fd8a9aULL, 0xe7fe2f370812e4ecULL, 0x5bdc004332bfff5eULL}}},
+    {{{0x716ffb65cfac06e6ULL, 0x1199e1c48daf19c3ULL, 0xefca139921e8504fULL, 0xd6d56aa27f4e32faULL}},
+     {{0x41a44952099027d9ULL, 0xba78cc27a2a747e2ULL, 0x0f4f0e872ce9c337ULL, 0x98203d2180aab50fULL}}},
+    {{{0x84fcbefd2e3be739ULL, 0x80e8eaad2c888b09ULL, 0x19b7ba18e2516d93ULL, 0x69a10091fbca78cfULL}},
+     {{0xef37c305509b65d6ULL, 0x852da96ebeef4df0ULL, 0xfe4bf996998f719eULL, 0x72bef01263dbe4a9ULL}}},
+    {{{0xbd93ba63a1943718ULL, 0x3ddaefa061aedfddULL, 0x01a35204b8761547ULL, 0x880f7a681a6e2e12ULL}},
+     {{0xcb3573bb736a8c26ULL, 0xad907acddc0ab5dcULL, 0x629afea05df5ec69ULL, 0x35b74211a31577b5ULL}}},
+    {{{0x38d0027f423f3378ULL, 0x6f9beaeb207d5459ULL, 0x0545bc9ced87fd77ULL, 0x729d8498af5842b3ULL}},
+     {{0x9a37bc5b36eec1d4ULL, 0x6107f572612e8195ULL, 0x6a2a55e51fdb102eULL, 0xa1b4f644399b015aULL}}},
+    {{{0x6e9a9f135e210671ULL, 0xfd82e47b1c44b81bULL, 0x50dc12df98980ad1ULL, 0x1b29f032610e64b3ULL}},
+     {{0x69e63f86d255318fULL, 0x238d195f6e8fefeaULL, 0x94908827b5c38ef7ULL, 0x530eb39d29dccd57ULL}}},
+    {{{0xc1f9a7604fd610b0ULL, 0x6529070fa8f9499cULL, 0xb5a12982392e3300ULL, 0x30ea6b69dfcd9813ULL}},
+     {{0x8f136f94267a2847ULL, 0xa89c2449ff1a365bULL, 0xb0b806e5ce44059bULL, 0xa05ce1fce874b3aeULL}}},
+    {{{0x1d94d4296c51bae5ULL, 0xf760cf6c34167f99ULL, 0xdad4eeda27b9849bULL, 0xca17e504a0cbc9a6ULL}},
+     {{0xee8e4f2e7d46683bULL, 0x31d62d3b2e2bdac3ULL, 0x60de16779e5f5058ULL, 0x6156f1813e13d46cULL}}},
+    {{{0x69e38ec68bfcb1acULL, 0xcb59fe8135ca6ee8ULL, 0x1ab17955317034cbULL, 0x0b496e1db5c40c45ULL}},
+     {{0xf14a898f2858c95eULL, 0x082580f168c7be4aULL, 0xc0fa44c72603ba3aULL, 0xcdb38c29cfe89be4ULL}}},
+    {{{0xf439d3c0b1c03a4aULL, 0xbdcd9bcb06521a99ULL, 0x73f1d8fba45c22d5ULL, 0xeb7217506836adc9ULL}},
+     {{0xc345259840649718ULL, 0x1d1554403a0a9b47ULL, 0x7e3a4df003d0b2c4ULL, 0x56904523af799d94ULL}}},
+    {{{0x347b16a7265ea47bULL, 0xd33c61669818a3deULL, 0x03ebc4097768a4c7ULL, 0x673af58835d2943aULL}},
+     {{0x65d4e688d1a01487ULL, 0x79db79af3d8eff63ULL, 0xccd834b6d075f81cULL, 0xf48aa4da280718f5ULL}}}
+  },
+  {
+    {{{0x0b70b36432006749ULL, 0x0931ded99012f086ULL, 0x401d2e2e3636a027ULL, 0x5822537ffc8707f3ULL}},
+     {{0x9336debb327e7ec7ULL, 0x247caecbedf9fba7ULL, 0xeff50a087196b5f2ULL, 0x343461fc5efa42d7ULL}}},
+    {{{0x4894e5adbe5e5be4ULL, 0x6cf8c01ab617d282ULL, 0x6a5c2b2d22e15e19ULL, 0xd048d0395dab9970ULL}},
+     {{0x678dd9f382e83da5ULL, 0x0eaa0fe5f6a1bfa9ULL, 0xbde4030a2fd6a4f0ULL, 0x3d8c4cb106cea286ULL}}},
+    {{{0x42f7dccc23b2e948ULL, 0xd571348d5d353181ULL, 0x605252dea28f6b7dULL, 0xd7e57dcd3ba1f3bfULL}},
+     {{0xe597fabe207169feULL, 0xe5966c13acb08633ULL, 0xc3fe06c9535eb691ULL, 0x5e3d66eb04e443aaULL}}},
+    {{{0x93496a027c20c041ULL, 0xc8667bcd84aaa1b3ULL, 0x648d4ee4c10c4964ULL, 0x084f997c6734ca69ULL}},
+     {{0x91c95d8446f52722ULL, 0x179e77120bf5be29ULL, 0x1cbc13da43474d0bULL, 0x4bd83dcb95faa6beULL}}},
+    {{{0x9fc13e1993bf8900ULL, 0xc39836accaf99959ULL, 0xcef69f1c6c6c5e70ULL, 0x64353bd2c40773c6ULL}},
+     {{0xe52229c685906ad6ULL, 0xe5f54cae2da07d78ULL, 0xa27cab853ffd4f66ULL, 0xefdc9f5edc75f9b6ULL}}},
+    {{{0x972f7196b34374a4ULL, 0x52cb1cfb3550fde3ULL, 0x7688cfbd1a773952ULL, 0xb22320727a4418acULL}},
+     {{0x2243984310723389ULL, 0xdebb3937068c337aULL, 0xd61eb7dac3a54debULL, 0x441bcae42eb849a0ULL}}},
+    {{{0x98914b76ce5d34f1ULL, 0xb336f56b48163dedULL, 0x6d39584d8c883d73ULL, 0x3b2b96441e6ec214ULL}},
+     {{0x07ea29889e3229ddULL, 0xf2ed39a52cb88dc1ULL, 0xbbc7c4643d11a51fULL, 0x33a5b9fe9597bbe0ULL}}},
+    {{{0x5e10949288d83ad4ULL, 0xdd021b0d7f4b3717ULL, 0x9fbbc371ec2d7cdeULL, 0x077ebc8c94b1f7f5ULL}},
+     {{0x8c5d7798982a0ee7ULL, 0xb2914051a98eb9f4ULL, 0xd6f9520853ffeda4ULL, 0xfdf12fcd907154c7ULL}}},
+    {{{0x45d62a2013b76220ULL, 0xfde2e64bfe5fff91ULL, 0x8494a09a33242735ULL, 0xa8648a36a771a2faULL}},
+     {{0x98cb62b3aade4204ULL, 0x92c41e96af530992ULL, 0x1f11023f1789e770ULL, 0x33d8da90f1ee3e4aULL}}},
+    {{{0x19f0d43defd8fb8eULL, 0xde43cc3f3c3c0bddULL, 0x41dda99a9890b2ceULL, 0x6f3a03ca7cdf704aULL}},
+     {{0x0c8167215fbfc2d8ULL, 0x0bc0a6adce08591bULL, 0x751506e3f5dd6c32ULL, 0x5348d02224d3baf4ULL}}},
+    {{{0x39db32d8a4fec304ULL, 0x1b9a1052f74e587bULL, 0xcb82f98bb15411b9ULL, 0xbf535ea16372811aULL}},
+     {{0xb0eb9eb8b7fd3224ULL, 0x129440deb173ce62ULL, 0x6fc983b3edc16f46ULL, 0x2959b95f39493855ULL}}},
+    {{{0x46f7687588a77fccULL, 0x47a097e30ab49f91ULL, 0x3e2c51a7710a17afULL, 0xfd409213386896b5ULL}},
+     {{0xa54dad04f72d2acfULL, 0xad872cd4ea1dd625ULL, 0x5dd5b8edb65eb458ULL, 0x9ecf8aad43be3fa2ULL}}},
+    {{{0x56c0b8925af33d9eULL, 0xb19d8bcf44943ffeULL, 0xc1678639a7559d0eULL, 0x7367a7853f9042c7ULL}},
+     {{0xd63351f9906f2b8aULL, 0x73b6a87712f52a25ULL, 0x2adfc825ce2acd3dULL, 0x0aaab893bd263b93ULL}}},
+    {{{0xf808418bc98018e6ULL, 0x1c1ebef6b18dd9e3ULL, 0x0720b6c49478a5c3ULL, 0x8807dd1e89044f14ULL}},
+     {{0x7587ae66ff5bae3fULL, 0x8a28a253c4720b4aULL, 0x6f0a12038e62ca26ULL, 0x7ce2340b1ca41c09ULL}}},
+    {{{0x7e57921d981cd94dULL, 0xbd85565202587cdfULL, 0x0172fdea6bb064b7ULL, 0xe794bc89b13ca1d1ULL}},
+     {{0x5beda7202e41f9c9ULL, 0xbb49fb3e125bca12ULL, 0x3b6abe9e23c8ff31ULL, 0x8364de25f35cab80ULL}}},
+    {{{0xe0ffe92db0ad7935ULL, 0xe55dabf9620f9518ULL, 0x8ce73fcca978343cULL, 0xe18e7069a4def81fULL}},
+     {{0x283295036dc2e457ULL, 0x83f3331245f66e46ULL, 0xe24abca9e5296f90ULL, 0x3e2134545551285cULL}}}
+  },
+  {
+    {{{0x5439cf973c993a94ULL, 0xe5acb6046037ab21ULL, 0xaeae3e95182c10deULL, 0xa309979c7bed9ebdULL}},
+     {{0xd877073be5e39690ULL, 0xbc253a494210a14eULL, 0x8828732a15bdb9d7ULL, 0x8692f2125d725dbbULL}}},
+    {{{0x98f1197d8bc0dc3eULL, 0x9c3a94b72c3a21d6ULL, 0x95e5a65b7b64762cULL, 0x016f97a5bb72b6b7ULL}},
+     {{0xd67e911dcd2e36d7ULL, 0x0b9fa53d8a3a9973ULL, 0x16453e35e8698f5cULL, 0x46e6fd5e54605184ULL}}},
+    {{{0x3b6daae86770ab86ULL, 0x7822b8443ad46941ULL, 0x09b68f90456c70c2ULL, 0xda4f269f4de8b65cULL}},
+     {{0x2cbe67f9c4489abbULL, 0x11a3409d6d6fae09ULL, 0x176f5ad664b76fa8ULL, 0x1dfae53ce14926bcULL}}},
+    {{{0x226bc6d0400392ceULL, 0xb2a691e99db05534ULL, 0xa6d85815b0718c35ULL, 0xf5071ca41bd116baULL}},
+     {{0x8b7992860784699cULL, 0xe72a2145489010e2ULL, 0x6f2e1c6b9c084f97ULL, 0x37787cbd4a5c6bc9ULL}}},
+    {{{0xf45e40807ce94706ULL, 0x1d02dbd2cc96b529ULL, 0xd07c0b35f60d3b51ULL, 0x8bf5c89a56a9e3abULL}},
+     {{0xb8535f6b7499abf3ULL, 0x2dcfd50b7c8eac08ULL, 0x8c72ca9dfb6fafb7ULL, 0x5dcec3b037990e9eULL}}},
+    {{{0xd8674a3ab152182dULL, 0x0a2739d270544831ULL, 0x6d60cc138e0f932bULL, 0xb72bbdbde59a9579ULL}},
+     {{0xb5b412070943aa72ULL, 0x08829871424d3042ULL, 0x23b82c60f07bdcebULL, 0x39826280dd8b1236ULL}}},
+    {{{0xf647da77615ed291ULL, 0xc425d13c1c4971b1ULL, 0xf03b0ed94e6dd48fULL, 0x47326f720c999aafULL}},
+     {{0x3dfcec5327d81988ULL, 0x99a6d880d2a45df7ULL, 0xe3aee14f7c3f5223ULL, 0xd1cd6c6b62388e3bULL}}},
+    {{{0x22d5135860b601f2ULL, 0xf036dd1b3d3e076bULL, 0xcc56889e51dc7c88ULL, 0xc0e87d13aa8aca07ULL}},
+     {{0x7342c926971002aeULL, 0x710d32101f954d1fULL, 0x48ae528affd200caULL, 0xe242be6e16e5b086ULL}}},
+    {{{0x788366c25aa947e1ULL, 0x80df3872e6bfbabbULL, 0xf16e5b54d62deddeULL, 0xc5a68637880ea54aULL}},
+     {{0x480b76999112739aULL, 0xc66f02eb7c30dc86ULL, 0x264729ce09e39845ULL, 0x13e08e83d563f4cbULL}}},
+    {{{0x654aefb8200e8e57ULL, 0xd9c3d8a871420d8cULL, 0x90ab9bd63069f8deULL, 0xd0b3e99e0d517101ULL}},
+     {{0x108ef097d83c4e33ULL, 0xfc2f8255296b8fc6ULL, 0x559e6535ab4dc3bfULL, 0xece84a7a63f52f6bULL}}},
+    {{{0x6288fd059888fe70ULL, 0xf90f6fabdbae19c4ULL, 0xc6e5fc9056945969ULL, 0x0d94cb68944ed4c0ULL}},
+     {{0x787ff2a7080a0246ULL, 0x602ad2bfc7a825c4ULL, 0xe6060558d64ee178ULL, 0x5c71c93a0352fa35ULL}}},
+    {{{0x2e9875546ed5621cULL, 0xd205b6748adce96fULL, 0x39ce18a5bd963726ULL, 0xfe1609c4a34e284fULL}},
+     {{0x3f1577095089ca32ULL, 0xa1680fa4116ded04ULL, 0x709e37ed67513959ULL, 0xc17e67096ddef7d3ULL}}},
+    {{{0x823daf7069c259eaULL, 0xebfb153263a95a4cULL, 0xa362330cef0f1ca4ULL, 0x65899c7e0ec09f5cULL}},
+     {{0x035ea9438c3a88beULL, 0x61ac018e1b0ba051ULL, 0x5787f93205925da2ULL, 0x3f52b10fdc9af4e8ULL}}},
+    {{{0x95bd96ee061f041cULL, 0x25c87bef70a36e3aULL, 0x0cd3a19f9f135d27ULL, 0x51fef8fd89e98b9cULL}},
+     {{0x786acf13ffaba96eULL, 0xd21bd517835eaa17ULL, 0x052e524659c1c03bULL, 0x89a583c8c10acfd8ULL}}},
+    {{{0xf8c1f57dd067154eULL, 0x397b4117afd01919ULL, 0xeb1e87b671a3d79dULL, 0x8a4c0e7ddd061521ULL}},
+     {{0xe611f4e9da603acaULL, 0x6cd34cde2885c6eeULL, 0x48e1499d61dcb948ULL, 0x5df921ff9bb3839cULL}}},
+    {{{0xdff84c07ed5418daULL, 0xe4f0e116577dceebULL, 0xcb67514e5470f074ULL, 0x6bbea59dbb904d40ULL}},
+     {{0x0af18ae41fbd37d8ULL, 0x6edf0da9d8817caeULL, 0x98c7740ad0b2069dULL, 0x3a0b93ef5e98894bULL}}}
+  },
+  {
+    {{{0xcf545feafdc83322ULL, 0x6ca8e22656908f7fULL, 0x9fb7f9a2c70e033dULL, 0xe5e4a7f5c437f493ULL}},
+     {{0x991440795beacd60ULL, 0xc893c9aedcc37253ULL, 0x63acb1a73966f189ULL, 0x990805ede6cfc8f9ULL}}},
+    {{{0x4381d40e12938fb5ULL, 0x55a9040620b4bc3fULL, 0x0a8c0ed38342db36ULL, 0x9d8832bc8e56cccaULL}},
+     {{0x85d92640184c6184ULL, 0x8c3374345daeb85eULL, 0x214021bda0a9e3f5ULL, 0xf578a73c4f117987ULL}}},
+    {{{0xc83cedbf727cf113ULL, 0xf2bbfa7536bd24baULL, 0xb1ca559c22039d48ULL, 0x466a885527e9366bULL}},
+     {{0x25c4cf4b40a65531ULL, 0xae6b7105edd883f1ULL, 0x9e9f98e7424a5cd3ULL, 0x82d647fb4c97930aULL}}},
+    {{{0x2e459cc60a85dbe2ULL, 0xdaf7e93f6f46f770ULL, 0x30a7a0b75c9da71fULL, 0xe36f271a30ee5dacULL}},
+     {{0x291f0ceaaec539b1ULL, 0xb3d988e668c1a13cULL, 0x29d00858c4dc13e4ULL, 0x4f72ff58fafc44ffULL}}},
+    {{{0xb1bfff5e1f0b7398ULL, 0xbe288901e6559c75ULL, 0x2a994b1faf1c5ecfULL, 0x860159c800f9a162ULL}},
+     {{0xae615324fa93063dULL, 0x6f86f945fb35cd99ULL, 0x9e794cfcbea6d22fULL, 0xf937decc89384a8dULL}}},
+    {{{0x3c19594bb1077d97ULL, 0x9e8be33169ce9658ULL, 0x414425a9a0ed38b7ULL, 0x44b86fccb5ea9821ULL}},
+     {{0xf9353b71d490efa1ULL, 0x440414c514760a2dULL, 0x797d42fcaeb5a3bdULL, 0x848d56eb850e28aaULL}}},
+    {{{0xa2c2f44a362acc4cULL, 0xa73bd68164ec1d0aULL, 0x2d87e895ffa94cbeULL, 0x13652603f3631ea3ULL}},
+     {{0x6fb613e367e61441ULL, 0x8eb41c5ac6d87bccULL, 0x8026b241596fbbdbULL, 0xb86a5eac5b4435deULL}}},
+    {{{0xd0405ea038ee1c30ULL, 0x735bea152edbd74eULL, 0x863f295b89bee64aULL, 0x311414a2e91a713cULL}},
+     {{0xce1c136631d74022ULL, 0x0f909628d5cddf1aULL, 0x1b5ee9f582f28c41ULL, 0xf548232e6440e689ULL}}},
+    {{{0x63165a9d44d4fb14ULL, 0xd9565c4dc4c8d8aaULL, 0x93ce2d8315939dbcULL, 0x8c2a8b88de753313ULL}},
+     {{0xb3e1f13a5d18b9cfULL, 0x99ed705e4ec3e48dULL, 0x84ce94aa0be3405bULL, 0x168b07a9dafdcb25ULL}}},
+    {{{0xc4b13ad44beced29ULL, 0x1319425b0641d5e5ULL, 0xa87f0a22881043c1ULL, 0xf62addffdf13fe9dULL}},
+     {{0x34c8e943af3bf409ULL, 0xba63bf6982b5e7e4ULL, 0xf4bce900c33dedb3ULL, 0xa3453c6e73b5d50eULL}}},
+    {{{0x57b09452d955a533ULL, 0x2f264bb3b7b44942ULL, 0x2e492d3cf534d7f6ULL, 0xf1699cfbf4cf051bULL}},
+     {{0xac325c43a4b9b1efULL, 0xb2ac89144e5b145eULL, 0xe7618ebbca9d7509ULL, 0xa4587626ba7b3e21ULL}}},
+    {{{0x82a9b345a976babfULL, 0x81f91be6cdcba820ULL, 0x5135a1c757f01217ULL, 0xb1b11d315dcba0f9ULL}},
+     {{0xcf50e093d5a886e2ULL, 0x64cb242585e862beULL, 0x83a1f54361414eabULL, 0x94abd501de89c664ULL}}},
+    {{{0x71aa2202069ae5ddULL, 0xf30aa7d4496d1ebdULL, 0x94b18871eeb18bfeULL, 0xd89f735a3a3552b5ULL}},
+     {{0xde0d1d523f181e9cULL, 0xebcc55a5c2f09a5aULL, 0xeec97cf9e840d657ULL, 0xe85ad3920e93bb8aULL}}},
+    {{{0x05fdc572e84bcbb5ULL, 0x9fe6ef31ac9e2da5ULL, 0xcc54c250216029e0ULL, 0xafeedf90007be7a3ULL}},
+     {{0x67cb287ab17e7acfULL, 0x7b679b30a8400d6eULL, 0xd733fec250c15211ULL, 0xeae8b10cba3639cbULL}}},
+    {{{0x952b4dcf13af3a4bULL, 0xfc77fe43a889c849ULL, 0xd5352e005ee8a2c1ULL, 0x31fd7ae56f2b07fbULL}},
+     {{0xb35d56c0510bf9a6ULL, 0x0cddbcb29450ffdcULL, 0xdc157a4bae1cc957ULL, 0x4bb996844086702dULL}}},
+    {{{0x3fce2673077868afULL, 0x3c8b33027c07da94ULL, 0xdf35da48b2ea86caULL, 0x6cfc62bfe1049c48ULL}},
+     {{0x9b97bce4334ab353ULL, 0xbee574bc7284efe0ULL, 0x957bd68948f445b8ULL, 0x7180a55f35352707ULL}}}
+  },
+  {
+    {{{0x55dd371bc205b1f9ULL, 0x010555ef13dce163ULL, 0x8327a67743e91a93ULL, 0xa0f7a615398a4e8bULL}},
+     {{0xac9dd24dfecff6e7ULL, 0x78722ce256e8740cULL, 0xb8ed2d28d49c2fa8ULL, 0x2b200e45644d2450ULL}}},
+    {{{0xd309de1f5bb1ff17ULL, 0x56b3b40f7642b559ULL, 0x63ef04ad709fabfeULL, 0xde5172bf71af2ce4ULL}},
+     {{0x23eac44dda9ffb2dULL, 0x055ceb7519b020d6ULL, 0x6a19b60fab9ecb61ULL, 0x39d12a4431793959ULL}}},
+    {{{0xb6f0ca49141bdf42ULL, 0x407f4809d0d866ceULL, 0x5b01a5f4f9ac9b1eULL, 0xc33126c3ccdb8526ULL}},
+     {{0x0bc4e111b75ba8a7ULL, 0x3e2e11aeec9fd678ULL, 0x38d41e45b5088873ULL, 0xc75b4b4a963d5bbfULL}}},
+    {{{0xcca46b14bcb3a824ULL, 0x27e2f69163c14a4fULL, 0x34c8713d0794ab6aULL, 0xaf7dd6db0c855c02ULL}},
+     {{0x66ca608bce829633ULL, 0x51a7d45ed30a4769ULL, 0x2cc97ecf30defcafULL, 0xcf0da5188e83bb38ULL}}},
+    {{{0xc6a3deeabe74b296ULL, 0xc70878bc07ccf329ULL, 0xa36efb101ea799f6ULL, 0xd577ce05806b87f7ULL}},
+     {{0xe0fda3213bc30edaULL, 0x905eba2388fadac6ULL, 0xf3a39a3a56f8681cULL, 0x7cf3b45da6f5340fULL}}},
+    {{{0x376cbef0725e501fULL, 0x2598cde88ff554a0ULL, 0x4ba934d9b5d18e2cULL, 0xa78ec392ced699c2ULL}},
+     {{0x356b8d885a1ea1c7ULL, 0x4751baea9f12d40dULL, 0x5609b19d5aa8daf4ULL, 0xf6695cacd5c4832aULL}}},
+    {{{0x5dc8b86bfbf38dbbULL, 0xb8a629fa96baddf5ULL, 0xdedcdd2e286d398fULL, 0x25281ec4b75f2c8dULL}},
+     {{0x347f9b025a7e4b5cULL, 0x343249bbd0fae8d3ULL, 0x6ccbe62029420afaULL, 0xa0cb44d48501dfa1ULL}}},
+    {{{0xc7a4a1159415e553ULL, 0xc97bf463c72161f7ULL, 0x89f2f871fa321babULL, 0xa9835dc64ce4fb26ULL}},
+     {{0x393a7aee747e3843ULL, 0xdaffee3c57ced84eULL, 0xd840dfcb78ae23b2ULL, 0x19659d04cddf9319ULL}}},
+    {{{0x26c7bea7648c5da8ULL, 0x69c941877fa9c60bULL, 0xf9c133d3a205a123ULL, 0xce65056d5528201dULL}},
+     {{0x886bbedb13e50012ULL, 0x24bdbcd4ac7fd23cULL, 0x61d851ccaf572056ULL, 0xfc81f5a2f0c9863dULL}}},
+    {{{0xfbd188394d805b80ULL, 0x9920ac3864ad72f2ULL, 0x313b417b7b6e509eULL, 0xeb1206234075c163ULL}},
+     {{0xd68e50846ed4ad77ULL, 0x2db6efb7180a741aULL, 0xebf76f4962926f31ULL, 0xc08d55d2bf325af6ULL}}},
+    {{{0xfc0313f9372b5c80ULL, 0xceb71b25ba779badULL, 0x8d06984e601046f6ULL, 0x7bd12aef8889ca5dULL}},
+     {{0x01ce9d95a88c61e3ULL, 0x5a35a8fed69d32ffULL, 0xcab6c06735d3744dULL, 0x1c37b3d5a36dce3aULL}}},
+    {{{0x9e3eb59e0460f7a3ULL, 0x9ef3486e66b8e1e2ULL, 0x63fabd46475906f1ULL, 0x976a72dbe72afc44ULL}},
+     {{0x4f2821bcc2a47b45ULL, 0x7e9d98f3b1695205ULL, 0x4d6c5176fa4f4170ULL, 0x65a50c99934ac2a2ULL}}},
+    {{{0xef3f151eb1ba16aaULL, 0x96c5f16aaf542e33ULL, 0x180979c5413035e1ULL, 0xad8a3614bd44ea68ULL}},
+     {{0x613496238a9a1926ULL, 0x69abe8798e421e2cULL, 0x1219ee27294e1441ULL, 0x8c3b41720a21dff8ULL}}},
+    {{{0x02b06ad3ea489832ULL, 0xbd8c892b1dc31b15ULL, 0x9dbd164ac3bf0083ULL, 0x784118ee01510778ULL}},
+     {{0x10a1f6bf4cd83466ULL, 0xd35b62a8650e5b9eULL, 0x0d9de6caed33abe2ULL, 0xd50253e31bf17ef1ULL}}},
+    {{{0x68a1195a94dcd9e0ULL, 0xd65580cd77cf91e6ULL, 0x8e15b43947d45d15ULL, 0x235e36df7b0daadfULL}},
+     {{0x9b05393f6d7a79bbULL, 0x95e5c8e7d89ed3f8ULL, 0x6fe068c2d9355b40ULL, 0x3cd70c784629de0cULL}}},
+    {{{0xa66a8cf4e15ffa86ULL, 0x7bc66d8f16a06e46ULL, 0xaea6c50589770037ULL, 0xc7d4e5b8e48d0f5cULL}},
+     {{0x35589b30ab26fcdbULL, 0x2021182544917e27ULL, 0x20c30c30bc1409eaULL, 0x90edc0d4e3f7b007ULL}}}
+  },
+  {
+    {{{0xdede51a4a5517f8dULL, 0x91871102f62b0556ULL, 0xe8c4c4606e4a3997ULL, 0xb6645428a3abdedfULL}},
+     {{0x1a63eb5bf4ec8f67ULL, 0x29d0f4fb675f4cacULL, 0xfe4f3ef1165d2ebfULL, 0xcc3ca80b08bff372ULL}}},
+    {{{0xa198fc178f68aed7ULL, 0x8eb938be725fb8a1ULL, 0xb76f20192d97dc40ULL, 0x73dfb53365061ae8ULL}},
+     {{0x42f2248dc4f97297ULL, 0x9a3491ff89f07e1aULL, 0x1451ac85ffd297b3ULL, 0xc05ad166259d0c68ULL}}},
+    {{{0x54435aee80529bd2ULL, 0xa1474bf1a19360ddULL, 0x580c735d6d9763ddULL, 0x239f826053504813ULL}},
+     {{0x9f741db62ac7eed8ULL, 0xbbdcb92fa36f5dbaULL, 0x95ae59c473aacfb3ULL, 0xb76f117bc8d90cc7ULL}}},
+    {{{0x968e4d6ef45ae6e1ULL, 0xeed3ea5f2f15d3b4ULL, 0x88d2bcfbd63bb2d8ULL, 0x5442660ca422e3ddULL}},
+     {{0x70a94ae01f1f27a1ULL, 0x7043e14a52bdf459ULL, 0xf1f427341ed78379ULL, 0x5f6a986227ee8063ULL}}},
+    {{{0x55c6f8025df08bdeULL, 0x9c9a4b6cd5c72c4eULL, 0x07d477ac74a238c2ULL, 0xf222a22dc55aee39ULL}},
+     {{0xbe84faaa27c24492ULL, 0x02d2faedf9e81ffdULL, 0x459c1049debca0f9ULL, 0xf02dee9d6a71cfaeULL}}},
+    {{{0xaa7cad8f146f79adULL, 0xedddaae69e2bf0beULL, 0x00957832a334aeb7ULL, 0x8365fe1b925f3b35ULL}},
+     {{0xa28c4d034c733639ULL, 0x8c72c2c92f835722ULL, 0x4eee37de326728d4ULL, 0xff03eb2e5e38d102ULL}}},
+    {{{0x2b4cf2722a17142bULL, 0xacc2b72e93259221ULL, 0x2d14162dce621243ULL, 0x918583a926a90ed1ULL}},
+     {{0xe86d66dd6061040dULL, 0x97023c536edac7a3ULL, 0xf3104bc1332ed8c3ULL, 0x345e8a51e9659ad2ULL}}},
+    {{{0xac785b30884c99e7ULL, 0xcfac3cbbb235e888ULL, 0x366e7df462bd5036ULL, 0x35b2eedc569fe79eULL}},
+     {{0x7da6fcbd85c74c16ULL, 0x30014222e9083a88ULL, 0xc833272800310f8dULL, 0xe266b8b230653866ULL}}},
+    {{{0x7da3d0fa1af32dcfULL, 0x1b40e414e9e32dc7ULL, 0x369d4308b266d7fbULL, 0xab948bda6ac08cc2ULL}},
+     {{0x9eb4f06f97679d0fULL, 0x01dd1d17eefbd07dULL, 0x7a884a08e8c0e580ULL, 0x3b8fc2b6a6173df8ULL}}},
+    {{{0x73353356b09272ffULL, 0xed0c39d6fa3fe37dULL, 0x88395c2a5675b17dULL, 0x3e1c61af847322fcULL}},
+     {{0xf68000590432c46bULL, 0xfd54a4c9a899fea8ULL, 0xf2e3a04d84602538ULL, 0xdd727429124fa667ULL}}},
+    {{{0x5442d23bc38ae2a9ULL, 0xfe426839dafa08afULL, 0x01ed0176bc463cd8ULL, 0x6d2315c212204ebeULL}},
+     {{0x931eb473611949efULL, 0xb2cdd5c66bdf18e4ULL, 0xfa1409a084960cceULL, 0xdfb14275f495ff9bULL}}},
+    {{{0xe706589e07da9e21ULL, 0x14bfafb7a9f2a00dULL, 0xd255cd233beb02aaULL, 0x522fca26e7731cc8ULL}},
+     {{0x84d3bf2abb2406bbULL, 0x465bf5bb517ae788ULL, 0xef016fbf6af6afaaULL, 0x00379640864cd578ULL}}},
+    {{{0xa0ad9998656e106fULL, 0xc779c18968fcd568ULL, 0x201f2b7b5fe9cfffULL, 0x91ce39d564d980bbULL}},
+     {{0x37a61360d510e298ULL, 0x7fa61d14cde42030ULL, 0x6c821a66c3314371ULL, 0xcf2344e4c26373bfULL}}},
+    {{{0x052ddf574989b9b4ULL, 0x4b93025ca1bef8a3ULL, 0x8251fe31870fc1acULL, 0xedf6b54ee0de6a32ULL}},
+     {{0xbce26dd875c4bf8aULL, 0x0eb91bf36c9a3274ULL, 0xe434bc425a223400ULL, 0x1cc94aa6648369e8ULL}}},
+    {{{0x6fde34fd4813c29fULL, 0xac8c056a4ac1b2aaULL, 0x899fbf35b3761edaULL, 0x6549e149aa6a393aULL}},
+     {{0xd40bb4687af5388cULL, 0x99a3e9f02314d051ULL, 0x99ee63280d241c7fULL, 0x4b43f5a83547eb15ULL}}},
+    {{{0xe6a6af764d7d0952ULL, 0x48afe6bb6c224df5ULL, 0xb92e7e9e98f12b5bULL, 0x5947200bc774d5fdULL}},
+     {{0x7342a38596405953ULL, 0x067491d2f2187bf0ULL, 0x6140194689252d31ULL, 0x4c34ce4cf8026c79ULL}}}
+  },
+  {
+    {{{0x82d8bace71741a33ULL, 0x517f52c264eefca3ULL, 0x981c1728590ebf70ULL, 0xf20634984322e592ULL}},
+     {{0x0859a844e50e9cadULL, 0x85c06a5580d9400aULL, 0x30e70e1c793a113fULL, 0x893fb6535f37dbe5ULL}}},
+    {{{0xa5d0670385d5c7c4ULL, 0x0f5a6fa006c282bcULL, 0xae0aadb01496775dULL, 0xba2e8ce2a72b005bULL}},
+     {{0x9ae18c66441e180bULL, 0x69b59975de9e9ce2ULL, 0x2d1bdcd79c77d6a2ULL, 0xd9bab3abbb5133e5ULL}}},
+    {{{0x091cc8ef794310d6ULL, 0xef195f32f5dfd2daULL, 0xbc7fbaeda532b4dcULL, 0xbc98c13a169561e1ULL}},
+     {{0xa9e59caa5d45f1d4ULL, 0x3eeb8ee798700960ULL, 0x515f468169722587ULL, 0x73319170aac0a84cULL}}},
+    {{{0xa88bcf7aca19cfadULL, 0xe3a0c289e1789039ULL, 0x3f0b43c75f2ff3f9ULL, 0x345f805cd79b6e80ULL}},
+     {{0x3358e2399a585852ULL, 0xc793cd1bc4e34cb5ULL, 0x8ed246c78320488dULL, 0x659d317eb363232eULL}}},
+    {{{0xcfc6519ca733a396ULL, 0xd7b79b67742be31dULL, 0x0848df7e90cf2cf0ULL, 0x91441e212e889131ULL}},
+     {{0xa811ebdc9327d930ULL, 0xbb9f51e6ae5edb28ULL, 0x9fe8d37d37e5e4afULL, 0x0306b395afba8205ULL}}},
+    {{{0xf0c2f3eb7872ededULL, 0x19a489a7189ba655ULL, 0x13af64037b64b582ULL, 0xeeaaa42c4085bf57ULL}},
+     {{0x4bc5ef690f2fdc28ULL, 0x0da2632f2174809eULL, 0x3def38eefad61022ULL, 0x0938d0e40fda1480ULL}}},
+    {{{0xc296cae044df1935ULL, 0xc5e33dd6b6b83fdaULL, 0xa6c1696fcfd1ec60ULL, 0xd68d2c79f8a47639ULL}},
+     {{0x33352004905b2bdfULL, 0xeaa1cdfde2e1ccfaULL, 0x002139156f6d3e61ULL, 0x40a370b952837cb2ULL}}},
+    {{{0x54a40c3c59386e6aULL, 0xaa9f40fad52fbd2eULL, 0xb957e7bb23a7078eULL, 0x577fd531f1b475c8ULL}},
+     {{0x02511d578f0c38edULL, 0x6d40d879d6bcf677ULL, 0x1aec465e37914cb8ULL, 0x6fbeb5413ba983d3ULL}}},
+    {{{0x26d34aa86bf92649ULL, 0x75e34d5d2180f09cULL, 0x63a69af2fd7d8ee8ULL, 0x55d1c1689ea1583cULL}},
+     {{0x419d596d0ab2ea77ULL, 0x8694074cc3c9ab32ULL, 0x838458a76a009c9cULL, 0x804f8fcd2141b9b7ULL}}},
+    {{{0xcfdb34c13f129e24ULL, 0xf27c51c9eed5b6b7ULL, 0x12a83bb914b6be98ULL, 0x1e8efdff0839a68bULL}},
+     {{0x4139819369345f65ULL, 0x2d9d0d181d6adcb5ULL, 0x05c5f10bfe46d877ULL, 0xec91e8b08104939cULL}}},
+    {{{0xebb3da0d2d7995ffULL, 0x7b68cf15e8289c73ULL, 0xbd57d5798fc82438ULL, 0x689785d6c692dd80ULL}},
+     {{0xbb8559b443de1cbaULL, 0x20460aced103dc63ULL, 0xffc2271b598ed2ddULL, 0x2e279952a9c79c0eULL}}},
+    {{{0xbd8c27ba34456e0fULL, 0x22687b095d675387ULL, 0x16de5a6bcee00395ULL, 0xa447cffd9abf0ce9ULL}},
+     {{0xccbded23e7eb6b07ULL, 0xf46741cf871138fcULL, 0x598370d49fd3d35dULL, 0x5047a335e6a70187ULL}}},
+    {{{0x1f9894fad9d8d849ULL, 0x25c032dc767b73b4ULL, 0x4a8a2f46ae7c6228ULL, 0x6b1ac7c6633607f6ULL}},
+     {{0xb4b89c35cf178eb3ULL, 0x201354dbd91d3305ULL, 0x4f1841e3fe22cf28ULL, 0x3b5a0dea2d4b7530ULL}}},
+    {{{0xd05beb58e9d18882ULL, 0x6d039768c88d1a28ULL, 0x897fd70d465da1dfULL, 0xa72cfeb2f7a05638ULL}},
+     {{0x2d77d566a95eed43ULL, 0xcad55814efb3a198ULL, 0x1e4465757ab8af0bULL, 0x2b0646b1bce1a7f6ULL}}},
+    {{{0x928784058f40f928ULL, 0x31a09ad2fd9dfce0ULL, 0x866235e2d190f826ULL, 0xfe4731480fe1f16eULL}},
+     {{0x718b4da270658e39ULL, 0xb85fdedc1afaad0bULL, 0x3e90cfe30866464dULL, 0x557dab65548648aeULL}}},
+    {{{0x1f6ba2920b8b23ddULL, 0xd7110679ce3e221dULL, 0xa0f35d4899640830ULL, 0x1d1968ce8f9abb17ULL}},
+     {{0x90ed55f76bb44ef2ULL, 0xb022fabfca303ad3ULL, 0xb19f8426b388d469ULL, 0x844750e579d35334ULL}}}
+  },
+  {
+    {{{0x2a8ed88ced0c72b1ULL, 0x400044776f6abab7ULL, 0x6493455191de6389ULL, 0x995c39f82e503dafULL}},
+     {{0x0554aeb5328ed4a5ULL, 0xb012493288409c82ULL, 0x066d1a18ca5f3005ULL, 0x5e0b46e4c749b1cbULL}}},
+    {{{0xe1625a5e76887e71ULL, 0xa7e516b716f5345cULL, 0x0e36cd26d41f0cc4ULL, 0x952f493fbcd64814ULL}},
+     {{0xf7689c80e26b0adfULL, 0x05030bb72a7c15ceULL, 0x8a39a64a01de98ebULL, 0x84f1aecb3a1c7132ULL}}},
+    {{{0x1055ea9c58e0926fULL, 0xb20c695c7fdc5dfdULL, 0x96eaeaba7b8b59ceULL, 0x79ff1212cf8de635ULL}},
+     {{0xe8278e0a243306cbULL, 0xbca4a28992c98efeULL, 0xcdf29e37fd3b7fafULL, 0x33ce56c1a32bd863ULL}}},
+    {{{0x4dc0ea7521e2ddeeULL, 0x284978d4710a3f21ULL, 0xa7ce8b6bba2868aeULL, 0x06e7256dff793e07ULL}},
+     {{0x13bd9dfff16b9a78ULL, 0xaf4d7741911b1089ULL, 0x209d211920d8aeb5ULL, 0x7955a5a1cba141f2ULL}}},
+    {{{0x6660c142111af3b9ULL, 0xc340d7c7b6842a4cULL, 0xf83df83501a0f567ULL, 0x003c05d881422a35ULL}},
+     {{0x4983924f17e62ab4ULL, 0x74efeb79b3e022abULL, 0xcc7b8e0070f49f17ULL, 0x8cbed2030d31aeceULL}}},
+    {{{0xe199a05186f3ecc9ULL, 0xcef91a138f8fdc19ULL, 0x7b7ef33c791d4a02ULL, 0x59ba7b3cd24c386bULL}},
+     {{0x920f7f09a544fcf9ULL, 0x483f455a743c5a6cULL, 0xcf9e80bc9f0c70dbULL, 0x6dda30a3ed87e3d8ULL}}},
+    {{{0x73f81097f29fe595ULL, 0xf16244c1688aceb6ULL, 0xc5e2eb6156ee9398ULL, 0x077e9ff4caf5d9cdULL}},
+     {{0xcd42383b7ad9d947ULL, 0x63134d726cd3bf65ULL, 0x303dc40e7f6f74e0ULL, 0x38246f212589edf0ULL}}},
+    {{{0x1830bd013fd6bbc2ULL, 0xfeb68bb3c376be5dULL, 0xdf48039070afaed4ULL, 0xcd73a9001e69fa0dULL}},
+     {{0xc8b8996638faab9dULL, 0xf147063d03ccb12cULL, 0x075c69f0150d10e1ULL, 0xb766fadaae68b9cdULL}}},
+    {{{0xcd1d44361bfb34a8ULL, 0x3d66a7d654381859ULL, 0xc02c8d75dd9bc676ULL, 0xe0f57ed73a5da2cdULL}},
+     {{0xda3c1d3cc36c176eULL, 0x47b3f9ee9f40da85ULL, 0x3c7c950344c277acULL, 0x4c2f7f98cc765c61ULL}}},
+    {{{0xfe4313c492e7536aULL, 0xf011b71f305eb787ULL, 0x6c0a0f91c3936695ULL, 0x966483b6fcd34d68ULL}},
+     {{0x116bba18a078533cULL, 0x12193f00abe67934ULL, 0x7cefbc09b1c4e40aULL, 0xc88fd82f9642a38dULL}}},
+    {{{0x0880a2ba0f0f0b05ULL, 0xf28266614389ff96ULL, 0x4182ba0291d7d04fULL, 0x30af3a182cf5b341ULL}},
+     {{0xf43c3dec4a02a663ULL, 0x45788a5af17dce0eULL, 0x7a6f0df165d1e7a9ULL, 0x3b345dae87c93a8aULL}}},
+    {{{0xdcd592c06d604725ULL, 0xb0d9ac42c7304e92ULL, 0xc3849e6093419e10ULL, 0x360bfd21ed6965b8ULL}},
+     {{0xbb61303b02325cf9ULL, 0xc548f302b33cd5baULL, 0xc847be6b7fa58d61ULL, 0xd2fbda6bba9a3ca4ULL}}},
+    {{{0xf6106857a02af53eULL, 0xc5b8e46740e533abULL, 0x8d5a90ad2ae87a40ULL, 0xa42e14710fc42eacULL}},
+     {{0xeb98f35027ad3634ULL, 0x6f4c86ca0b8bb574ULL, 0x91cb945fbc7ca0cbULL, 0x8c6636bc3c49807eULL}}},
+    {{{0x450cef9e220aaaa9ULL, 0x836a8e8a5e0caa3cULL, 0x9d63021ca19d1bbcULL, 0xd2d242392239b6cbULL}},
+     {{0x30b7aca1646e229aULL, 0x356c6e02be096d8bULL, 0x0dca6cdcbd60a0e1ULL, 0xa0f6b9f87a7f6e53ULL}}},
+    {{{0x7aedd72a9a00e685ULL, 0x05d016fe5032c23aULL, 0x2298e80c3456f889ULL, 0xce554f3214efbf7cULL}},
+     {{0x9437bfaf635ba67dULL, 0xcb1d768f72f83198ULL, 0x2f718cb19ab2c02cULL, 0x5f1d0a423536aa2eULL}}},
+    {{{0x8e12206055676f08ULL, 0xaec2904907c7fe5fULL, 0xd1914c77e94fc377ULL, 0x67313c558c168506ULL}},
+     {{0xb3e292ac4cd9bd14ULL, 0xa56663c05d1726ecULL, 0x59501fbffd135379ULL, 0x85f28d03727d181eULL}}}
+  },
+  {
+    {{{0x28d304cab1962960ULL, 0x912dcb764cae4e34ULL, 0x6780cf131a5e62b9ULL, 0xd0059ea1a09237e3ULL}},
+     {{0x8f8c0451bf423b4bULL, 0x87ccf3b5b7a22e55ULL, 0xbcdf3bb51ccc3c53ULL, 0xc2161d3767b6c819ULL}}},
+    {{{0xd792ce8063707acdULL, 0x0835d79cb2f17c04ULL, 0xecb092515258ac22ULL, 0xf093a77d00cf9263ULL}},
+     {{0x7554256c0b83e315ULL, 0x11f84f3fe76236cfULL, 0x9a5415f304db17b8ULL, 0xf9f6645b02dec2adULL}}},
+    {{{0xe068f09d4a1ef81fULL, 0x7f98b9cd4802597eULL, 0x04a3cea6eafb9ec8ULL, 0xbe5604d178107634ULL}},
+     {{0x5c95730a4cefe36bULL, 0x891e309b848c03aeULL, 0xe6a8427b1d068dc6ULL, 0x207df9e0c2aa61d7ULL}}},
+    {{{0xa32b8de3d96b1766ULL, 0xd8389d55503bb7a3ULL, 0x6cde6db86e5eb037ULL, 0x366965759d533550ULL}},
+     {{0xd5f419edac457fe3ULL, 0xda2ce94bce360bccULL, 0x2603267a027ec01bULL, 0x2e730a2417885d1bULL}}},
+    {{{0x44a2bf7ef5958a2fULL, 0xa33a6fb0b413df18ULL, 0x30c0de78f4bc731eULL, 0xefb28c5a9400a165ULL}},
+     {{0xe57d163eab90b6deULL, 0xc6c1067d7204bf8fULL, 0x35d11f2932d76058ULL, 0xc1bb79df754afc90ULL}}},
+    {{{0x40338a49e44e63b9ULL, 0xa3f0963ad582171cULL, 0x9a99526dc3e48b2fULL, 0x06668050bf547860ULL}},
+     {{0x6306fd9acc55f677ULL, 0x0b05379b631c543fULL, 0x1f6a83740432fdfbULL, 0x0fb266f67f82835eULL}}},
+    {{{0xae19f41a29f7e685ULL, 0xd9fe8b4c07d96754ULL, 0xe4703ecf8a2ea9d3ULL, 0xfe8bc191c84a86bcULL}},
+     {{0xf096d0235555b180ULL, 0x37f6211ecc3e7d5dULL, 0x39ef76e9b096caabULL, 0x8fb95ca1db0ff62eULL}}},
+    {{{0xb671417361ff180aULL, 0xc0c2e28de5847a75ULL, 0x9ae05e6ec53f4ff7ULL, 0x44f59f9841c52f23ULL}},
+     {{0xcdad4e9b8d65061fULL, 0xeb2c6931329e49f9ULL, 0x5df836107787e6dcULL, 0xbac1dbc091849c8eULL}}},
+    {{{0x0b85103651304232ULL, 0x754d4b05bffa25c0ULL, 0x347dcc89a7f2341aULL, 0xd12f9e4e5fbf5499ULL}},
+     {{0x103bf9281a515c95ULL, 0x82374d9cbaaf9071ULL, 0x1a5dbd923186abb8ULL, 0x3d3f0bb5d2a5be6cULL}}},
+    {{{0x3005b57df8ced775ULL, 0x7a634626ce23c97dULL, 0x81eac6de6a11be8dULL, 0xb29c9744987422d6ULL}},
+     {{0x06cbab5d55e6cfbaULL, 0xa3c2775614b9f955ULL, 0xe112958753ea3bb9ULL, 0x26e678c0cf17a9e0ULL}}},
+    {{{0xe2d23ea087a69ea7ULL, 0xfafa795ed31485baULL, 0xf8023c344d98e699ULL, 0xf85c7499ce386c2bULL}},
+     {{0x175fef49a15cb7b9ULL, 0x777989b1a7efdf81ULL, 0xe56af36fad57ea4cULL, 0xec7527bb628f20b8ULL}}},
+    {{{0xeea84940d3d4dbdaULL, 0xccad3d2e26bef75aULL, 0x7ac3120444dcb4eaULL, 0xd41994bb1b4542bcULL}},
+     {{0x9cbb862cc1d563aeULL, 0x11049bec52d8aa1fULL, 0x2a0fc6d6b6487336ULL, 0xe8b9cdb56503bf69ULL}}},
+    {{{0x88cffa6fdd1b1d6dULL, 0xcfa2adbf6c222196ULL, 0xb630251d39004528ULL, 0x94d22271e1119906ULL}},
+     {{0x532a279c517162c6ULL, 0xcc2283528f8f8e1cULL, 0x83959bc6df34d4e6ULL, 0x9c73433f02007083ULL}}},
+    {{{0xb52deeaf100554b4ULL, 0x571f3fbf658dc19bULL, 0xdd9547ae74e6f8d6ULL, 0x668e37534e876091ULL}},
+     {{0xf68239c66cdbb745ULL, 0xe03effe9b4904a1eULL, 0x1bf28cafd0cab9b9ULL, 0x9ae7137e5553809cULL}}},
+    {{{0x2aeed440f098fb8bULL, 0xd205096cd5d315caULL, 0x302a6167aa87c1cdULL, 0x32e205adc704d39eULL}},
+     {{0x8907f4ce389907b3ULL, 0xcd3212014354e830ULL, 0x59f41fd5155d3024ULL, 0xc8d09f4e4f9a13f1ULL}}},
+    {{{0x4dd7e721bc51923eULL, 0x8dcc82612ee300ffULL, 0xd73953eab8e5e2c3ULL, 0x44ac782fd8fd735eULL}},
+     {{0xcd383038f04b0392ULL, 0x1ce4e9e50870923dULL, 0xe00758f2f0d02d77ULL, 0xb7b293705b625a3fULL}}}
+  },
+  {
+    {{{0xaa7bf1b8541c8545ULL, 0x686873ae1b3d8269ULL, 0xf7977f96479a12deULL, 0xb572c8cebe73aa44ULL}},
+     {{0xcc8eb0c9b2e1b720ULL, 0x527bafea1f504f7cULL, 0x6898eeaebd51c86aULL, 0x277611509d2cf9dbULL}}},
+    {{{0xd7e84970ecb058b6ULL, 0x5d18343363f88855ULL, 0x7c34591d8b8dc7d1ULL, 0xa3c303b377f4aad0ULL}},
+     {{0xe8696de3b78a0d53ULL, 0xdfe1e67821ae9726ULL, 0xb02280c52fb18f5fULL, 0x5ae5b592024cd3d6ULL}}},
+    {{{0x91e6fe327806b29aULL, 0xf9fe3a6da2e60e70ULL, 0xa130db8736cf6ee0ULL, 0xa6c90ffd83470016ULL}},
+     {{0xc6c2509b781d91c5ULL, 0x5db2a47c79d1a068ULL, 0xcce5f020b696b7a6ULL, 0x8d986d240a9168aeULL}}},
+    {{{0x83c702bcc525fd3bULL, 0x2e832a8dcb2fe31eULL, 0xf683f467fb885b70ULL, 0xa7899da5b94b13d9ULL}},
+     {{0x55834a5e350cf1ddULL, 0x7671973109ef81b0ULL, 0x1d2cdc8b8e2e7a75ULL, 0xd364525de40b8397ULL}}},
+    {{{0x9fef853730dabddcULL, 0x500b063339e35843ULL, 0x635de9589bd0cf61ULL, 0x0b5c36680762c8bbULL}},
+     {{0x5b768f5761ec3f74ULL, 0x354326877968dd4cULL, 0xd120258398b63fcbULL, 0xd731ddf82f29a245ULL}}},
+    {{{0x35c98b864d5d4635ULL, 0x7a3233c0ea1feb70ULL, 0xbb57347d85a4545eULL, 0x83ec8f5cbfa44196ULL}},
+     {{0xf503576f859b7daaULL, 0x9d1046a5b22542f7ULL, 0x9b49cb1e3e937c7cULL, 0x8af3768f3623d56dULL}}},
+    {{{0x04972327fe3f688dULL, 0x8adf81d6071c7e18ULL, 0xeda47644d0624b02ULL, 0xe672847dae33f912ULL}},
+     {{0x5408b885ce763cd2ULL, 0xe03aedbdfa8d3769ULL, 0x65e92d6d400bbaa9ULL, 0xbc8e3da5fa7d63ddULL}}},
+    {{{0x32c88646cb2b9f7dULL, 0xc2c9543b68bad4beULL, 0x54d32a4e5284fefdULL, 0x508b0957edbfdbc0ULL}},
+     {{0x2a4dfde36e0575c7ULL, 0xd98a73f2d9787103ULL, 0x18f646370edc9cdfULL, 0xae7df68396bc53c8ULL}}},
+    {{{0x3ad9120fd37f8cfdULL, 0x6e3cce2d20b7c2e7ULL, 0xad91f6a5d4ce95e5ULL, 0x247d4a37aa408cd0ULL}},
+     {{0xf4e5f8722a9e784aULL, 0xfd1a3bbc4192308bULL, 0x17d78cdb7a81a058ULL, 0xf4c547b0aeb984acULL}}},
+    {{{0x51c481191748b6f6ULL, 0x1c8b4a5b1365991bULL, 0x0fb9c56292f10f02ULL, 0xb9344b4304ce6b15ULL}},
+     {{0x26065559f543556eULL, 0xcad6e2307826f47cULL, 0xfe20f46ebd11d506ULL, 0x0511dd6185e0edd9ULL}}},
+    {{{0x13729addf7f4692aULL, 0xda1d4b62ff2b5034ULL, 0x1e38f14ccdd55fa5ULL, 0x9c50db36dc383b3aULL}},
+     {{0x08311af89d5f8dd5ULL, 0xffe29f8191e5c6f6ULL, 0xf4c3508f8cb39594ULL, 0x221918270b58ab9eULL}}},
+    {{{0x27fb5b1b84b439aeULL, 0xfa20f9c00f8bc2c1ULL, 0xd31899346c04a96fULL, 0x02eb07fee5b23abaULL}},
+     {{0x8a7878c639e53c8eULL, 0x33eb9cfdefe28933ULL, 0x4fbf9d5f8b48e559ULL, 0xef076e6369b7870cULL}}},
+    {{{0x0530e26fa8bbc802ULL, 0xa55641fdc8dfb40cULL, 0xab20997672966eceULL, 0x97609a326567c273ULL}},
+     {{0x93ad4a36d577016bULL, 0xda519ee6845cd6fdULL, 0x6e7d4115a9a3615eULL, 0x588f14cd5d17bff0ULL}}},
+    {{{0xd01bef6a8e3c6b81ULL, 0x55f0f7f1d30ade8cULL, 0x079afa402e0cb65fULL, 0x6493bf7e141d5e93ULL}},
+     {{0x39ef0ccf44e619a9ULL, 0xc8d17a4cb191a24dULL, 0xc9560bee1807df98ULL, 0x533ddc8e7298c29bULL}}},
+    {{{0x52a27ae36e28cecfULL, 0x366399bb745ad658ULL, 0x3c91bd47241bcf36ULL, 0xa6ededbf4e8c5fc5ULL}},
+     {{0x5aff12866f8b3d26ULL, 0xae7b6e588f2a0879ULL, 0x780b0a4daed08bdaULL, 0xf51569feb899aca6ULL}}},
+    {{{0x05ee2660837f6918ULL, 0x17ed647793413c48ULL, 0xc9516239ec8f012eULL, 0x0781b859a7f79fedULL}},
+     {{0xd320fc54f0da148bULL, 0xb73a2fde44caee8bULL, 0x78866b27c47ff7faULL, 0xa5b6e60ef3b16117ULL}}}
+  },
+  {
+    {{{0xadafb863d9c8f8c0ULL, 0x1464b271f66e2883ULL, 0x1692188edbda5afeULL, 0x0b0e9dfabe732516ULL}},
+     {{0x1156cdddcb5fbca6ULL, 0xe5852304c6abbf51ULL, 0x934f643effe6dc17ULL, 0xdaab8a54b6ca3cabULL}}},
+    {{{0xb13cb4dd720d456fULL, 0x9c0e48e9d310aedeULL, 0x5af07140e7d3d0d8ULL, 0xc2b18c7ade15e249ULL}},
+     {{0x226eebb1491e043aULL, 0x7ac8dad1bee3116bULL, 0xe663c5f862a45112ULL, 0xc88d7fa3355a0004ULL}}},
+    {{{0xed11339ecb556a53ULL, 0x2b8b191ecd11adb7ULL, 0x375b6a0274cf7d1dULL, 0x2979d496136caa0eULL}},
+     {{0xef2a3027e8b5db3dULL, 0x5387081db018a3d0ULL, 0xb66bd9e7b6d16d40ULL, 0x78c131e97d22561cULL}}},
+    {{{0x863c5ff13ee8cad1ULL, 0xfa1f43dda9fb3484ULL, 0xdcdaae3fd40b2eafULL, 0xea769e17487c362fULL}},
+     {{0xee46580281c9dca3ULL, 0xa76fa100f4ee03feULL, 0x548d9971fb39061aULL, 0x39e54e0f54ae3b65ULL}}},
+    {{{0xd422bd31c586f0e8ULL, 0xf1887dd0b8057ce9ULL, 0x2bf93fdf02294d63ULL, 0x459b5ee60504b596ULL}},
+     {{0xbe24b6f31b9c7067ULL, 0xce7c4994f4acca58ULL, 0x8111d63b8207e3ecULL, 0xdcba28d241b660d2ULL}}},
+    {{{0x46c48bca7c45cbe6ULL, 0x651724f2ea93ec79ULL, 0x56417686bef3ac43ULL, 0xc59d1057f7769422ULL}},
+     {{0x1c3fbb95371ef8f6ULL, 0x9cdfe48b302ee106ULL, 0xe33f23b15b342435ULL, 0xf86402b07726c359ULL}}},
+    {{{0x99a1a487d3487a4cULL, 0x62c24987189cf869ULL, 0x4442a05057a48b85ULL, 0x0706dad571e56e10ULL}},
+     {{0x3fd78d830d62e93aULL, 0x1e6acd33b1221ab6ULL, 0xd70a8ca07bb462e7ULL, 0x91d45f3bf95817bdULL}}},
+    {{{0x6ba4a7c0664b218dULL, 0x50f39f5398cf3d9eULL, 0xb8d1f9ea89ae30ffULL, 0x785a3c14c14b0af2ULL}},
+     {{0x5dd135583a7ad511ULL, 0x31d7baac34132aebULL, 0x9e498fd5ee09af29ULL, 0x7d3c03bce91aa280ULL}}},
+    {{{0x1c99876bad9b54bfULL, 0xbd89ec62e478192eULL, 0x85b11293b2aaeb31ULL, 0x508079867a524b56ULL}},
+     {{0xf267a9d16d0c856fULL, 0xa3e70dee68cca5adULL, 0x41a283837c0375a1ULL, 0xebbf97c3c4d6aa39ULL}}},
+    {{{0x00c7b233b3d2dcd4ULL, 0x62e74b47020daaaaULL, 0x2afda301250ce4b8ULL, 0x015c409c76733583ULL}},
+     {{0x3211abece844032dULL, 0xd6b17700714d08aeULL, 0xf29b2fd64f16e8deULL, 0x5da8c7b0b8b4c259ULL}}},
+    {{{0xcb1fbdf07b9fcad5ULL, 0x596d96b8d3948e9fULL, 0x47c2d2db1f4fdef1ULL, 0x581a022535130f2bULL}},
+     {{0xb884d9c395ce1243ULL, 0x0c5fae45768c5a66ULL, 0x2d7b2d369cc8ee66ULL, 0x2c880ee31864c58bULL}}},
+    {{{0x3d4058676cd98f66ULL, 0xac7404166ab686f9ULL, 0x16eb0e6d424a8064ULL, 0xcdc461b3a7378129ULL}},
+     {{0xf015d5265947946fULL, 0x525a090730cda2e7ULL, 0x7e5ce6939a8a0905ULL, 0xe7303a29f07c2e42ULL}}},
+    {{{0xbdd0fa3c9c46553bULL, 0x2da23511b3a8b750ULL, 0x66efcbaf4864848bULL, 0x4ff2e605503efa72ULL}},
+     {{0x4b99a7ceb39986cdULL, 0x03ba480280481edfULL, 0xde20d28ef7676271ULL, 0xc5bce964df62f4a0ULL}}},
+    {{{0x2d9573e1d1c6abefULL, 0x4c2236b72e791f45ULL, 0xdcb619b4eada434aULL, 0x377d125079937224ULL}},
+     {{0x746504842145ecb6ULL, 0x90911b66bfb9cc8fULL, 0x989a1f318b59f3a9ULL, 0x12ddb8fd6fdfec90ULL}}},
+    {{{0x6e7d683a4812536eULL, 0xa4a02423652dee46ULL, 0x5dba1e02453003aeULL, 0x2c629e60493597eeULL}},
+     {{0xfad6a4f0f468c79fULL, 0xe46eb78fc0e2bcceULL, 0xc17086050c307b2eULL, 0x9cf6f9be31bd8970ULL}}},
+    {{{0xc579537a05b1b649ULL, 0xa11a670c1ef1df7bULL, 0x690722ddd670e5c1ULL, 0x2e19cbabf4f12d31ULL}},
+     {{0xfea33608329d642aULL, 0xe3224c769cb01b5eULL, 0x2615fb1b258564f1ULL, 0x92e161b3de380e42ULL}}}
+  },
+  {
+    {{{0x43a8f573ba6d9e52ULL, 0x193b4f5fecd436f0ULL, 0x6e3906698080df13ULL, 0x4364beef28a5513fULL}},
+     {{0x389072b3472d87baULL, 0x0b19c4ce257e3c26ULL, 0xce07d8d6fcfe62b8ULL, 0xde022ad4bb4dcf14ULL}}},
+    {{{0x98473483714f5a35ULL, 0x79859b876083788cULL, 0x02ffee0c96d94030ULL, 0xc289e6f9cadf8be8ULL}},
+     {{0xd6a96418adce5125ULL, 0xd03858caaf75133dULL, 0xbf38678ad0b3b8efULL, 0xc98032d746e34793ULL}}},
+    {{{0x7b235bd493e9b086ULL, 0x2d34c2a4f0df27eaULL, 0x70425b01107b4b73ULL, 0x803c43cdc4f03fb7ULL}},
+     {{0x9e18506859b8c265ULL, 0x0d24f25556c58a2eULL, 0x3ad825e3c8c19c7bULL, 0x9c0bfdaa3e7a3ee3ULL}}},
+    {{{0x628f786cbf425194ULL, 0xb59e7fbbb3f9cae1ULL, 0x17f77b687d20434fULL, 0xa3413e31b1b255e9ULL}},
+     {{0x2d252a7dc338c7deULL, 0xf7b10dafd1782923ULL, 0x1edb9316497acda5ULL, 0x8815bb251cc647cbULL}}},
+    {{{0x203520c248148944ULL, 0xed188b3abf95bb43ULL, 0x16ec26611ce6dbaaULL, 0xa056446e732e6c26ULL}},
+     {{0x805db709039a1354ULL, 0xb95850ebe3e1f4c4ULL, 0x757986c583e1396fULL, 0x22949f959757eaa8ULL}}},
+    {{{0xfb7a5a929feb3fdfULL, 0xac0a0f47d8d3af06ULL, 0x2cbc909d53ca2e71ULL, 0xb1b69b9efe23335aULL}},
+     {{0x5a464182f581dc33ULL, 0x1edaea9a9db6426dULL, 0xee3c59225f0f859dULL, 0x2a11a580f75ffd07ULL}}},
+    {{{0x236a390df1d7b04dULL, 0x9f62a4d9e79fc608ULL, 0x0f7f0c0f0e80e98dULL, 0xc9d49aac7aed57c6ULL}},
+     {{0x58978f695038874aULL, 0xcd04dfc55db5ae9aULL, 0x97a0a4e8dfedafbcULL, 0xebc10582bc4283e7ULL}}},
+    {{{0x6269d36daff802adULL, 0x002d3ce299836ba1ULL, 0x625c60f4d83d44a2ULL, 0xf2d00ff6a5631a58ULL}},
+     {{0x6324dc5d7218dbfaULL, 0xce1bf9b079010677ULL, 0x5a358e90f94e035cULL, 0x993bc1180bb3cc91ULL}}},
+    {{{0x3e5618d4e27a98e6ULL, 0xea5dbdcee0b1d377ULL, 0xb5a43248ced90d77ULL, 0x962bb34c285f1b13ULL}},
+     {{0xf63073e90dd31b19ULL, 0x4ae10b5805684853ULL, 0x836eee9a03e7fb3cULL, 0xb85b5684068ce00fULL}}},
+    {{{0xe1378bfd7ecf64a6ULL, 0xb0f20ae206af2e1dULL, 0x12ab3b6bac06b965ULL, 0x5ff9c3ba4844abd1ULL}},
+     {{0x93acab58f18d193fULL, 0x106c15f654191285ULL, 0xdd85a96290bdf7bdULL, 0x85c8ded0e582a857ULL}}},
+    {{{0xc3ddee065cdc95e5ULL, 0xe3a9c92f470334cfULL, 0x276dc05446efd742ULL, 0xd1438bd08e5ddfcdULL}},
+     {{0xbf8d7932afd3d390ULL, 0xd03304ba4c893e93ULL, 0xaa4443841d9b3ecdULL, 0x66001f7a5401de66ULL}}},
+    {{{0x20f7c6d65c3294ddULL, 0x6fb6ba6aedfd465fULL, 0xb5727d991a4bbb24ULL, 0xce2dd575bd2fcf6fULL}},
+     {{0xc3a5814014124749ULL, 0xb55cffc9123d823dULL, 0x1978138f971744cdULL, 0x18fc0862903b1d9fULL}}},
+    {{{0xf6f616d8a62d7e03ULL, 0x2ac439b4248a7287ULL, 0x27eefc3f74faa623ULL, 0xbe0f307800bd8eaeULL}},
+     {{0xc1d6d696bcf7d0a5ULL, 0xfd72a81552c21682ULL, 0xd881bd87c9b6e764ULL, 0xde73aac83f1c5f1aULL}}},
+    {{{0x14ec455e8f71744eULL, 0x890de257b782d59cULL, 0x93a390f832ea7626ULL, 0x9660a0d53ca4653bULL}},
+     {{0x01bbc527af8d0dc0ULL, 0x6d4cc2683a9deec6ULL, 0xb41947977ac01c9fULL, 0xd10a1887a17d8839ULL}}},
+    {{{0x37d8cce6376b124bULL, 0x34a33ccb454811c0ULL, 0x807da82504583f02ULL, 0x2b1bde5a2c011f7dULL}},
+     {{0xa28cd47af78b5411ULL, 0xc2d791102c85ad97ULL, 0x53cc8d6dd42d92c1ULL, 0x5748e4c89a161b71ULL}}},
+    {{{0x38ad3b6298d23203ULL, 0x4d83a98f2a7594e7ULL, 0xd7354eb17c427ceaULL, 0xf8a87edaa4951b8eULL}},
+     {{0x8d14f27847153537ULL, 0xeeff9e9d38c47747ULL, 0xde3be72da53a41c4ULL, 0x1a251fdd6e159aedULL}}}
+  },
+  {
+    {{{0xa24b6bfea6e1284eULL, 0x2a3bd973a8278390ULL, 0xde683788ff66072cULL, 0xc3a8e4dcb5ede186ULL}},
+     {{0xa278bbc9126c5a73ULL, 0x1a7c2fcdf10e641aULL, 0xe27e20ea94cad735ULL, 0xe102103f396dc84eULL}}},
+    {{{0x517ef57fe25210d9ULL, 0xf2e16347e2e3b791ULL, 0xc3a004f975d04fe4ULL, 0x7e6fcf5ac05f8696ULL}},
+     {{0xcea3cb1e80b2c40bULL, 0xf1266995a5495f1dULL, 0xdc9373430dc2698bULL, 0x8c03997fe3a07643ULL}}},
+    {{{0x544fc781cb93dca5ULL, 0x449f28cbdb5a43bcULL, 0x51bcc2d9d6005cdcULL, 0x15e9f9cf302d14d2ULL}},
+     {{0x2a6d534315b7095fULL, 0xd42a3c634f7ee77bULL, 0x47368b5409a50915ULL, 0x85e1c8007ac2d655ULL}}},
+    {{{0x23fbf0cee42b5eb6ULL, 0x6b87bf9b97717feaULL, 0xd19f040b132a4691ULL, 0x77b8337761cca928ULL}},
+     {{0x85579d9cf4c0c5c1ULL, 0xd9c502fe9a58787bULL, 0xf8aba7c13c40ec69ULL, 0x63912dc48d1aa3eaULL}}},
+    {{{0xd71904af3a73b441ULL, 0xaab6caf4e57f7acbULL, 0xc432f2dca0a28815ULL, 0xcd90d5dd315030cbULL}},
+     {{0xf116d1e7a00881a8ULL, 0x0d32bf1bc289aef4ULL, 0x80906660b95fa6f2ULL, 0xcb2f237a89dc50e1ULL}}},
+    {{{0x2b31e80420f19bfbULL, 0x820ed68434bc35faULL, 0x6860b8f5fac89513ULL, 0x02e5efa7b9e54684ULL}},
+     {{0xd7edcb99400f035eULL, 0x29b542cba6630d3fULL, 0xf0017b5b42f4f636ULL, 0x20accdc6ace77ab0ULL}}},
+    {{{0x42b8a1a7f2675b22ULL, 0x5908f8a675c8344fULL, 0x06b8d23f6dfd495eULL, 0xccc05ee134fdb7faULL}},
+     {{0x5a9f782624b23ebeULL, 0x22df647f266a5bbeULL, 0xdbf39bf3705ff268ULL, 0xfdfca0863f57d392ULL}}},
+    {{{0xf1c52cd3ef58666dULL, 0xf611964156e07590ULL, 0x0a3a97c8c9c901e5ULL, 0xbdb4adabe5c2f06aULL}},
+     {{0x06d158b8446ce84cULL, 0x9fe29386c04af2c5ULL, 0xfdc66a8af5183530ULL, 0x578d6d58952c1edfULL}}},
+    {{{0x66b3891fcc827878ULL, 0x6ef9e7e3d96f2dc8ULL, 0xc69fd235c47fa39fULL, 0xd9d17fe7fd7b78c1ULL}},
+     {{0x3a2c6ab7090e8e01ULL, 0x7941dda819d37011ULL, 0xd3b474a1c5728fdfULL, 0x9ae5c1b38be47665ULL}}},
+    {{{0x4b8cb42e77da6433ULL, 0x0eaefd4d759bedbcULL, 0x97c47ac17d917054ULL, 0xf9d5be6817cb15acULL}},
+     {{0x2f94cb10fd386198ULL, 0xbb53b4b36b5491ccULL, 0x4f1b7dc4d2473c8bULL, 0xb0146c26c7797567ULL}}},
+    {{{0x8683c404b5afd317ULL, 0x7629fe45d10a3f02ULL, 0xbbaf88990733454eULL, 0x02be8fe7d8930c1dULL}},
+     {{0xb68c425f58151bdfULL, 0x69e001e9c094d877ULL, 0x244ce53a0308f065ULL, 0x0082a79e4d6e5983ULL}}},
+    {{{0x4f8efc889cde8c0fULL, 0xa92182c9f6848ae9ULL, 0xfc7828305b665ed6ULL, 0x347564c72af3241cULL}},
+     {{0xe652290d3faa5f18ULL, 0xea64a484f68093e3ULL, 0x6ec98932d46244f5ULL, 0x29067ae5d0c98140ULL}}},
+    {{{0xe0f47b1443453f35ULL, 0xb4689d26d91d8c75ULL, 0xd6f1690b258e47c7ULL, 0x1f0efe9434556856ULL}},
+     {{0x698f7582ea890f6dULL, 0xc2081a8943243ac1ULL, 0xe74e7f14bb65379fULL, 0x590bdde1d758acfeULL}}},
+    {{{0x50e0e7a203360cefULL, 0xdf643797f40c150bULL, 0x7e8a9886bc4db0afULL, 0x230ec5e0c1592e7eULL}},
+     {{0x6030a2670a0dc698ULL, 0x9b758f2102c8c631ULL, 0xd25ba585cc4591baULL, 0x0034f50806541b8bULL}}},
+    {{{0x4f2c3ce9a5988dcdULL, 0xd189c7f58f309beaULL, 0xf6854ae9d34de665ULL, 0x28474963933943feULL}},
+     {{0x30d41f81d31b329eULL, 0x92e23e410d23bd90ULL, 0x18dd96304df97173ULL, 0x3d824611f2197376ULL}}},
+    {{{0x6630a40b67a1e220ULL, 0x016feb52e3cab9a8ULL, 0x7f0fe3c944bc271cULL, 0x04bd4e9108f1c621ULL}},
+     {{0x92c898eb73dac5e1ULL, 0x4eec8ed65255e3beULL, 0x94f35c47f5415be1ULL, 0x573a3ea90b94e9d2ULL}}}
+  },
+  {
+    {{{0xdcbdc734373e017eULL, 0xfdf2413e780768bbULL, 0x6866ca0c0e105f05ULL, 0x26b894c0e38f414aULL}},
+     {{0x150e604f81539994ULL, 0x852ebeb00db9cdf6ULL, 0x37048182aef11ad4ULL, 0xf7199f73a8f573c1ULL}}},
+    {{{0x6f0ee156984ca99aULL, 0x5300277f9bcfc389ULL, 0xf2208f271c1a8a4cULL, 0x4129d940e5ed5bb6ULL}},
+     {{0xe1812ee3fd50729dULL, 0xf1fb5fcf830cf696ULL, 0xf158a88c7a0a8323ULL, 0x73d2f863645f9aa1ULL}}},
+    {{{0x828cab81d221739cULL, 0xf4e70824fea7ce6dULL, 0xa56359373e95e88aULL, 0xeb813da8b9937445ULL}},
+     {{0xf953a435d103cdddULL, 0x035827b34be51117ULL, 0xff7ec7b8dcbceb70ULL, 0x86351b8b8fa08b13ULL}}},
+    {{{0xc9cd66779e412519ULL, 0x0264955a94978658ULL, 0x39d1fd5dd6983c0fULL, 0x6a14925db87c69fcULL}},
+     {{0x73cbda081238bdc6ULL, 0xc2f3743958759326ULL, 0xbcdc19d39116431dULL, 0x786018ac49487b58ULL}}},
+    {{{0x24cccfc75f04099dULL, 0x290158d1afdaf0b6ULL, 0x451bd4064f21b322ULL, 0x7a85ff4214a77f4cULL}},
+     {{0xaff7a333cf0d89b9ULL, 0x2483ec004fd6e504ULL, 0xd94d2756faab97ddULL, 0xddd1af6fa2ba3ea9ULL}}},
+    {{{0x5670168e9a01e29eULL, 0xbc6678caf2ab1962ULL, 0x2faff98d9a04732aULL, 0xd8b1ee0187e9b4b0ULL}},
+     {{0x23f20c94d86c10bfULL, 0x4fe65a4be027357dULL, 0x0f2ad9e24961d94aULL, 0x123089bd23a43b9dULL}}},
+    {{{0xec5f8daffe3d141fULL, 0x5ce63154a36195afULL, 0x06e4c1dc2e99e30eULL, 0xc96892c6b34c97d6ULL}},
+     {{0xf8058bcbf98f0521ULL, 0xfc6f5a88c8a4b767ULL, 0x03da61209059caa5ULL, 0x79f5a280bd82442cULL}}},
+    {{{0x536a127a7a40c14dULL, 0x950ccc42158ca528ULL, 0xec8779da04a25cecULL, 0x78682ef7a8e08db1ULL}},
+     {{0xf9bcc68b00d54defULL, 0x58a1e87621d969cfULL, 0xbc0936497bac94f9ULL, 0xe52f540decf27d76ULL}}},
+    {{{0x4ad0e03d827be364ULL, 0x2cb844936c4c2afaULL, 0xfddbc81c8a8ab792ULL, 0xacaf12b9c4e5ecc4ULL}},
+     {{0x04b885137197d9b6ULL, 0xe9a40c8609136dd6ULL, 0x51797cb945f9a44cULL, 0x7dbbbb2e44b6cd1cULL}}},
+    {{{0xad797e9c0c77cd94ULL, 0x22de0c08271e4a2aULL, 0x63153a37d792838fULL, 0xf697cfde665aefa5ULL}},
+     {{0xfa8d65d2df781101ULL, 0xc770fbbd4517b311ULL, 0xdb11845e5e864e91ULL, 0x20fa5f03788950e3ULL}}},
+    {{{0x56886e68aa49a40bULL, 0x11aa3a936d39b612ULL, 0xdac47606e749cdaeULL, 0xe4203afc300079bbULL}},
+     {{0xed7cfed9b9fd6361ULL, 0x45b6c6cc6fa7d19eULL, 0x77122b1f8ddb1197ULL, 0x9474ccc0affef4dcULL}}},
+    {{{0x421eab472f55d944ULL, 0xb584f368fd5324f7ULL, 0xb175e01ddb400663ULL, 0xbe8cc758ed958cc6ULL}},
+     {{0xc377319b6e342ec5ULL, 0x89a777fe377ca02eULL, 0xfd506ea3e4640c53ULL, 0x0636b757123efcb1ULL}}},
+    {{{0xd3008a9df0acb558ULL, 0x549722cf89db16abULL, 0x159dd137235fe101ULL, 0xd16c3818ce4a4ac4ULL}},
+     {{0xb9fc47e0c9adb5e4ULL, 0x3dc27ec773833ffcULL, 0x0d144192595276f3ULL, 0x11d54b58bccbe603ULL}}},
+    {{{0xe51cd287d8fce1ceULL, 0x13f51d3c2f377327ULL, 0xb910ef3f7cb10d91ULL, 0x737425d6afcd0ad9ULL}},
+     {{0x103a6a48b67f01b9ULL, 0x150ae332d8907464ULL, 0x52d08f507920b8b7ULL, 0x39786eb0c6602218ULL}}},
+    {{{0xe7e9b9a1399c7785ULL, 0x3fc4000e9554cce9ULL, 0xce9ecc1db129ecd4ULL, 0xa08dd0981c97809fULL}},
+     {{0xf2637810a9391526ULL, 0xbb67c08fe4010965ULL, 0xac0397a3cda8dd38ULL, 0xb6aaa0d0a3621965ULL}}},
+    {{{0x3248d950b3b0ef92ULL, 0xf8fdc135af12d5a5ULL, 0xe9bfe45c21331315ULL, 0xb63aa8f3fbc45b70ULL}},
+     {{0x9752e7b9c8f869c4ULL, 0x8c9ca54181ee9b15ULL, 0x7ffe0a061895a328ULL, 0xafda249b0e3bc81eULL}}}
+  },
+  {
+    {{{0x9cb41e4b4b3f6a02ULL, 0xae0a2a8bfc315d4fULL, 0x4bdf139ab9a71a5dULL, 0x79c2edfd34111d91ULL}},
+     {{0x24342684297958fdULL, 0xc1478681ad68bd46ULL, 0xe281a1bf0a6b4a48ULL, 0xc35e69990cf93670ULL}}},
+    {{{0xfc41e4486d03e0ebULL, 0x4b6e4260a7ceac4eULL, 0xef86f61374da5d85ULL, 0x09cd8b44a325fd8dULL}},
+     {{0x93d4226bf44c4bbaULL, 0x294e716dc108518fULL, 0x8b1ff16fd1b2cf92ULL, 0x2f9307a592afc5afULL}}},
+    {{{0x44760c396da40f6dULL, 0xba877dc5e977e2e2ULL, 0xa3a2eaad397bf6a9ULL, 0xdec92f086080cea1ULL}},
+     {{0x7c3ddf0adc304c27ULL, 0xd040732925a3e0c5ULL, 0x17a8ac0987f5c972ULL, 0xb63db1c1b9b49e90ULL}}},
+    {{{0x700a0c5b1f10d0daULL, 0x020517f4d5329d3dULL, 0x4a6215301e5947c3ULL, 0xa1a56223ea39cb15ULL}},
+     {{0x062f4e11d1a9d321ULL, 0x8670b09af91b8e9dULL, 0x77a3c0c3fd5c4805ULL, 0xe7094a8ab0077e60ULL}}},
+    {{{0x1e0bda51c8b0900aULL, 0xd66ddcae8ed5ca7fULL, 0xc3e3c21b7aa9c38fULL, 0x757e80d8b7f91447ULL}},
+     {{0x98a27e3df6d161f9ULL, 0x3a9a2042a7fb480eULL, 0xd1f41f694611191eULL, 0xf0324bf18cc99bd4ULL}}},
+    {{{0x3efd5c438ce8c2feULL, 0x7c50d7a3fe0b4ca0ULL, 0x039487efbfc54467ULL, 0x41b3e274cb13bc11ULL}},
+     {{0x3e3f52fb696f62f3ULL, 0x4ee7061065f329f2ULL, 0xdea03d262e111aadULL, 0xb96c08eca345c4dbULL}}},
+    {{{0xa0358ff753c90d43ULL, 0xce519dbfe258a2fcULL, 0x0eef3ea3f3549230ULL, 0x1b0a04c11d4a8af9ULL}},
+     {{0xc414944f69a879b9ULL, 0xbd4279c0ea682cceULL, 0x24108f01570af79cULL, 0xd015602fecf85d1dULL}}},
+    {{{0x87044daa6c085dbdULL, 0x2e6af611170f9725ULL, 0xa371643044ddb738ULL, 0x92b045a989a579c3ULL}},
+     {{0xfe6754dfb5e5712dULL, 0xb7626ac089a4ddc4ULL, 0x58429b253e353c8fULL, 0xd6d85d98764d606fULL}}},
+    {{{0xd56746533771026fULL, 0x511d4caf62ef7474ULL, 0xb617a6547f7c0773ULL, 0xd711d8aa5711bf2eULL}},
+     {{0x4ad6e73cd1c499a6ULL, 0x7f75d47f1e683f53ULL, 0x37033ba71a1cb69bULL, 0x65d93ba3c1ee9d42ULL}}},
+    {{{0xc7a9efbae1fe5ce8ULL, 0xc201ab8a49bf76ffULL, 0xa4f8cece67f2da13ULL, 0xd8b000ed7e762ce4ULL}},
+     {{0xd77e12f58cfe8516ULL, 0xd3619faa051c7073ULL, 0xa75c8701f58d107dULL, 0x7354dd11569d1853ULL}}},
+    {{{0x499f4406ece88a60ULL, 0x240eea6248d487c9ULL, 0x416a0cbb9df35804ULL, 0x1f171856050de95eULL}},
+     {{0xf002c49965a39758ULL, 0xbccc18ec1d8c6e29ULL, 0x24afca5684392a6dULL, 0x1ad2aa37e29e2221ULL}}},
+    {{{0x157b96e978e5b759ULL, 0xcfbfeab78a170441ULL, 0x83f1ea747fbe6d18ULL, 0x37f76b1db243ef72ULL}},
+     {{0x028c0fedee58aa21ULL, 0xf3ae26e41a2e6c71ULL, 0x2c9044b89f4b8ccdULL, 0xef336fb8ff466233ULL}}},
+    {{{0x7b4f1f63a01e30a7ULL, 0x445cb2a2d8eae336ULL, 0x76a1074853b664bbULL, 0x803e927d30eb4581ULL}},
+     {{0x8e47a880999754e0ULL, 0x9f2668d7c72e52cbULL, 0x02bad4c19d4d969cULL, 0xc27a4e73cbd31679ULL}}},
+    {{{0x65423854f028a03fULL, 0x8dc73ca1b0aaf076ULL, 0x401746ffb61ee4d7ULL, 0xa97204f749cdf012ULL}},
+     {{0x4b393d449893bd66ULL, 0x1fb6a4dfa55559efULL, 0xc3dbb91a81408bfcULL, 0x106e0b7567eba6eeULL}}},
+    {{{0xe6f269c3a9e75843ULL, 0x8d5297a1af96e120ULL, 0xa9c92bc1580fe12aULL, 0x62fe3379adb90df0ULL}},
+     {{0x930c68d067cda08dULL, 0x79ad52a25cbc8a8dULL, 0x1a2753f519c9d2a4ULL, 0xa35863d068579834ULL}}},
+    {{{0x38aeea6c187e9925ULL, 0x63381fd1c85ea696ULL, 0x27b24fe85c9c146cULL, 0x9fea677b401c9bd9ULL}},
+     {{0xc8cbc5f7f408d253ULL, 0x8e7ae019333fe93aULL, 0x69d18b81f04bab06ULL, 0x84257c1a65ad8137ULL}}}
+  },
+  {
+    {{{0x6e853edb7ee29dc3ULL, 0x3c966771b44c89e0ULL, 0x6d19ace8489f1a07ULL, 0xd31bf92cdaf77db7ULL}},
+     {{0x153b6bbd49ee5212ULL, 0x1491e764b5001f17ULL, 0x049d979d767e0b0dULL, 0xfed22f99b7ed2441ULL}}},
+    {{{0x61c88e41fd5f3de0ULL, 0x591931182a251721ULL, 0xf6604a8148b0a1b9ULL, 0x4023bbbef8adb963ULL}},
+     {{0xffcc858011bed75cULL, 0x41ec6224e154e64fULL, 0x91d24d20b178a07fULL, 0x1492e186e7829681ULL}}},
+    {{{0xcba4aea759d1899cULL, 0xc0aee2d17cfa6c55ULL, 0xa7d6d5f409968a1eULL, 0xfe0263b418237966ULL}},
+     {{0x7dd3ada86a41952bULL, 0x7caea437d0e4ee4cULL, 0x12862b03d675664fULL, 0xdff4b78e25abaac2ULL}}},
+    {{{0xb02aa28343b6f2ccULL, 0xc8129351225f41b8ULL, 0xa41903aba0dd0a0fULL, 0x73841170430ba114ULL}},
+     {{0x97c3143ceec7104bULL, 0x6a7449de899dc2baULL, 0x96740a0547b04234ULL, 0x7247cf7907daee1dULL}}},
+    {{{0x89e786dac27b0565ULL, 0x9cd57f5990c6971bULL, 0x85f5193e36523893ULL, 0x6ff80855eb4815dbULL}},
+     {{0x6235317d5017840cULL, 0x94d39288ee0963e7ULL, 0xa9bb482abda50735ULL, 0x585c1e8c3253718aULL}}},
+    {{{0x78d0ee9a393ff82aULL, 0x8cf0c276bc2d8842ULL, 0x1620fcf43e7597e6ULL, 0x93301a8b3e0536a3ULL}},
+     {{0x2e3aa7adea1b1405ULL, 0xa8f92c2ed01bbe08ULL, 0xf0848a97d8988166ULL, 0x88255864e646f8e5ULL}}},
+    {{{0xe9360e85033f8a46ULL, 0x04245aec42e7f2f2ULL, 0xd4ccf49516411e8dULL, 0xf2d7a6de52980b47ULL}},
+     {{0x35946621ee848196ULL, 0x8fdb4af1cdaa5d3bULL, 0xaaae48404ad36d9fULL, 0x381892dc518a1245ULL}}},
+    {{{0xbdbb4ee96944eeb5ULL, 0xb48da2d32782adefULL, 0x4ea73e058e16ff39ULL, 0x2173ada1b723b969ULL}},
+     {{0xfde1e16807cc25f3ULL, 0x18469796fcdcc6e5ULL, 0xdda4c1f4692ff2ffULL, 0xa591f650cc7ee021ULL}}},
+    {{{0xfb0244da52079d96ULL, 0x94129ccc1599588bULL, 0xa1d3beac2b5fbf55ULL, 0x106a8ccac1730f7aULL}},
+     {{0xbb46aa1c1ff58000ULL, 0x3944c3ac549dd660ULL, 0xa941f00acc68ca71ULL, 0xea0592105c796586ULL}}},
+    {{{0xc9cb4c8a5723c808ULL, 0x614164dda013f07eULL, 0x272a75a2f030ba9aULL, 0x9de567ce8a494923ULL}},
+     {{0x310ab484884c014eULL, 0x65e176767480dc22ULL, 0x3887b21b0f5224f2ULL, 0x51b369b0a739c045ULL}}},
+    {{{0xf3b2485b6b0ba63dULL, 0xd1460bbf2ca02767ULL, 0xdd3a0fe415f1f298ULL, 0xed74b748929c72bcULL}},
+     {{0xd643a5c2b7853e8aULL, 0x91494c476d5e8affULL, 0x7b3b9fa20598d365ULL, 0x88d814cea9099225ULL}}},
+    {{{0xc074441571870b00ULL, 0x05e5146224cbc874ULL, 0x081953e64cfc1175ULL, 0x43624bf605b401d8ULL}},
+     {{0xfe39962497af1137ULL, 0xc08e9936a32ecc37ULL, 0x082c80237fe3d0d7ULL, 0x1a622da9388c5d1eULL}}},
+    {{{0x1d5db75dafec8feaULL, 0x241b9ffa683da771ULL, 0x7531a9313522b125ULL, 0xf41cafe1c035798bULL}},
+     {{0x920ab4e117bdd5c5ULL, 0x6bb798d370a092a7ULL, 0x04394c0f97dda781ULL, 0xdc2e7ea293ea6d41ULL}}},
+    {{{0xd3f478e7b60b6e67ULL, 0x6b35df415adc5ac0ULL, 0x645b1cacfe8b7c57ULL, 0xc59ba3e1f877c81fULL}},
+     {{0x41693d4255e0ef94ULL, 0xc17d543578554713ULL, 0x82ef0e3406447f8cULL, 0xa1362a16a8dfa768ULL}}},
+    {{{0x71185876f1a8e6d4ULL, 0x584729f15dfdee5bULL, 0x0d0e1842b4e21f8dULL, 0x979e031d2ec48b56ULL}},
+     {{0x7096cf9dfde4ade3ULL, 0xe92d67d2c2464fa9ULL, 0xb9ec6af95c74cbbcULL, 0x25871d7e83d2d6b2ULL}}},
+    {{{0xfdd2bf18cb8d3268ULL, 0x95e5bbf7e79a93aeULL, 0xf023d956b7796e61ULL, 0xbf28e6067145da9dULL}},
+     {{0xa06a37091f1cddfeULL, 0x1ee8989350abb5d4ULL, 0x1ae0fdaf09b0d9f5ULL, 0x1271a7a8e648b57cULL}}}
+  },
+  {
+    {{{0x436f495f920d01f3ULL, 0xfb51d6cf9be522b1ULL, 0x285edbbcf617ac02ULL, 0x320e5ed7cfd82cceULL}},
+     {{0x817b598a3ee3105bULL, 0x14502032bb9fcfdfULL, 0x16793a7ccf0ec84cULL, 0x5ce81c695fdc0e3dULL}}},
+    {{{0xdf2424411545a5feULL, 0x0c65be365d335174ULL, 0x25d6f59e0f6025c7ULL, 0xd7d2be810fe89158ULL}},
+     {{0x2e48ef383b2491c7ULL, 0x84e23e5151aa805cULL, 0x7657a1efdc577c87ULL, 0x763d9bdea2f374b1ULL}}},
+    {{{0x08d1ac521e96b5d5ULL, 0x975f35ab4d8a711bULL, 0x3beb0cbcac4b266eULL, 0xefd752ed95107816ULL}},
+     {{0xacd2ea8acfd4bc56ULL, 0x7c35e79a7f570295ULL, 0xf37fc2141f216c67ULL, 0xee4875e103cfb773ULL}}},
+    {{{0xa8e1233c85d0a766ULL, 0x49bd8e76b11b36c4ULL, 0x77ab201509ecf630ULL, 0x2e0c29d9635f1e10ULL}},
+     {{0x09da3b5092372140ULL, 0x72cc933a98753b0aULL, 0x9e191a60454b6d32ULL, 0xe053fcdea15e3358ULL}}},
+    {{{0xd50344ec98e1adfbULL, 0x60b16bcf42e79a9aULL, 0xde4d217b2dc6350dULL, 0xc83c6ff511df2ef1ULL}},
+     {{0x2854665d3c69728dULL, 0x784e0fc18195b26dULL, 0x14eec0f90256b4abULL, 0x969f7a1e70c08130ULL}}},
+    {{{0xb78fca589af2cc2dULL, 0xdd1e738018aceb63ULL, 0x4c2c9e1e4d2638a7ULL, 0x13cb87f3bb2ffe0cULL}},
+     {{0x8988bf999e82829eULL, 0xbe552e4be815b980ULL, 0xd7f6d732e088ab3fULL, 0xd6a17fc8e300ef52ULL}}},
+    {{{0xd7e362f757468702ULL, 0xd18106d223f9a52fULL, 0xf9308f0383713467ULL, 0x9202427eeec2b445ULL}},
+     {{0xb46237e234a90158ULL, 0x693c0553ab8b45caULL, 0xb4d98a6c835f06aeULL, 0x29c3bfe48c3c1f76ULL}}},
+    {{{0xae7b2855b9354fbdULL, 0x3b8dff54561347bfULL, 0x1519922a78ef0590ULL, 0x475bb47a51e327acULL}},
+     {{0x06091bdf5f8cbf01ULL, 0x3dde8a500ef1af63ULL, 0x54a02c5db9f520a9ULL, 0x8e78e1685bb093c3ULL}}},
+    {{{0x2903747d41eb4730ULL, 0x1741ad04449a4afcULL, 0xa8bc47ea0bcb7770ULL, 0xf0d8b473d7ff75b6ULL}},
+     {{0x57fdf5bf50903e45ULL, 0xfdbfd45a9282f6ebULL, 0x421bbb3a4d982537ULL, 0x3f84f703674385eeULL}}},
+    {{{0xf8287d8eb7e49943ULL, 0x4152a56186431683ULL, 0x02048e6fe28a8b20ULL, 0x8cb43b2c7d2e1fc0ULL}},
+     {{0xd8a5bc0fddc7f514ULL, 0xc95063a78c7c6138ULL, 0x5f9186ac3bb3d048ULL, 0x883065ab508a8786ULL}}},
+    {{{0x4066c7e58610fc51ULL, 0xebde2e424d560b7dULL, 0xfc645096f7337ec9ULL, 0x081fae94effbb5e8ULL}},
+     {{0xfaefa7a0525b1b41ULL, 0x36a4e860a29335e1ULL, 0xde7a00114bdbf594ULL, 0x51e9c5181131904fULL}}},
+    {{{0x7e85ac43562a0a45ULL, 0xa2ef07c3d23276abULL, 0x8c31ec9f8e3d3b6aULL, 0x89e5debb3986abafULL}},
+     {{0x87bc584dec61d3f9ULL, 0x787b6fb7dee4fcf3ULL, 0x76554b9658f0cb19ULL, 0x4e24f5f05d043749ULL}}},
+    {{{0x15fc300521b8fe21ULL, 0x72ddb33fc300a94fULL, 0x50886fe208de314dULL, 0xa026aef7f5775185ULL}},
+     {{0xd2d374ae131de2e6ULL, 0x303d3629fba2f71eULL, 0x47a425240c4ede57ULL, 0x68e28bad0e4fad94ULL}}},
+    {{{0x8ee43ef8c5ca6394ULL, 0x6fea56670e8fa783ULL, 0x5d3d7332ec040fb9ULL, 0x594e8fd646698745ULL}},
+     {{0x316223aafa1f9149ULL, 0xa8ca6f42b2613584ULL, 0x9c42fe586611232eULL, 0xfa4250538b755e81ULL}}},
+    {{{0x788f7f505821de4eULL, 0xef437fc512e56357ULL, 0x16b4fa59a7c3c07bULL, 0x67249e50fc72382cULL}},
+     {{0xedbd602e514a23a4ULL, 0xb5b0f8be950c31bcULL, 0x4612abccb96a1ae5ULL, 0x6cd6ba0f2375540aULL}}},
+    {{{0xc05ea388be7865faULL, 0x81e5d05579593023ULL, 0xb39cd5e0f455e3bcULL, 0x35546ac9b7a049cfULL}},
+     {{0x847ae80e1ad83d67ULL, 0x241e09fa704369c0ULL, 0x377b8601e230d9aeULL, 0x6edec1540f4289e1ULL}}}
+  },
+  {
+    {{{0x80e456c8d61f0a23ULL, 0x94c8d84ac097d710ULL, 0x609b16f8e64ef360ULL, 0x692a2395dddd1d1aULL}},
+     {{0x429700091202c376ULL, 0xe61e405f6ca56528ULL, 0x279dc64a47fe54f1ULL, 0x0e3422e24d7f2c9bULL}}},
+    {{{0x2dfc5f7eafdc6a2cULL, 0xb7d6265fef404a3aULL, 0xc6ad8cfdcabd0dacULL, 0xda810da134cfe0caULL}},
+     {{0x4b32478d4a976deeULL, 0x194ee61596198c2fULL, 0xc5352630a0466120ULL, 0xf19dd53dd9f9af54ULL}}},
+    {{{0xbcb685844907b401ULL, 0x2c5e7b847a2bece5ULL, 0xb7c51b51651be361ULL, 0xa0c4e261f22a0b6fULL}},
+     {{0x2e948dc34864e930ULL, 0x563d5afbcd2a7574ULL, 0x2a616565d889dbabULL, 0x768828fda9d4ddc7ULL}}},
+    {{{0x6c8acb0f66fc0fecULL, 0xc75627a5efba7dfbULL, 0xd3d51f63ef17593cULL, 0x9c5b4af5455731ebULL}},
+     {{0x6d94c0465f542e01ULL, 0xf57ab71b4ad5a27fULL, 0xafdc4a4c4fd4a6cdULL, 0x14b8536a9821ff02ULL}}},
+    {{{0x71e3b9edc476788fULL, 0x70f740e669b1dec4ULL, 0x6bdc474004359313ULL, 0x7bbe2793e54dc3bfULL}},
+     {{0x62bb6665ba6ff3eeULL, 0xc249a4f5fb6b30cbULL, 0xdf88c961338bcdf6ULL, 0xa3e423a4f94885aaULL}}},
+    {{{0x0162e9c7a7c2f472ULL, 0xb1ce41be86301618ULL, 0x5dc125610e897308ULL, 0x61fe4803e9d4e662ULL}},
+     {{0x9771686912f026b2ULL, 0x08ac01c099528ea4ULL, 0x725e3070e69f657cULL, 0x59c14f841400e727ULL}}},
+    {{{0x9e4fc6c433121f14ULL, 0x6db288d3a3a3e7c5ULL, 0xcbdcd22ed6d6e272ULL, 0x73094da4a07dc7b8ULL}},
+     {{0x0a11f5058a741c51ULL, 0x164a5895429dc0fbULL, 0x7ea87f1f127790ceULL, 0x0e0af6c22ffbcc7dULL}}},
+    {{{0xf8deba71f5c194d3ULL, 0x8536ea022be9d950ULL, 0xfaa33cabd89da456ULL, 0xb6b9c515bcca06f3ULL}},
+     {{0x7d87fe70a7bd9192ULL, 0xe38937cc825e2e16ULL, 0x04dfcfbe01abf038ULL, 0x9ca3def97674a93bULL}}},
+    {{{0x4431d1cfb55fb4b0ULL, 0x94697b4098fbecc8ULL, 0x404bc1d6e8dd4a65ULL, 0xd8b5998164915b7cULL}},
+     {{0xefbc92c558127310ULL, 0x7eb3ac1ef7b16e55ULL, 0xa777abe84eb765f5ULL, 0x62b2d2d5387fe452ULL}}},
+    {{{0xf0dcf2a1cc0bb952ULL, 0x64ca9cc665c65949ULL, 0x6ac00a623e1ea475ULL, 0x2dbacbd897533411ULL}},
+     {{0xa923df3acbec871fULL, 0x3edd4a47eed9e427ULL, 0x249d32cd461b359eULL, 0x933c00b78b11a1c3ULL}}},
+    {{{0xcc6d85be4c1034caULL, 0xa333482242cfa724ULL, 0x5b9066faf116123aULL, 0xb1879915cbfc38e4ULL}},
+     {{0x94cf977731246c42ULL, 0xc0a953cabdcf8c73ULL, 0x655b8db77778f85cULL, 0x171444441b206e75ULL}}},
+    {{{0x68c5c4d090280193ULL, 0x4913df2c2fd307cdULL, 0x676d23440ba77bfeULL, 0xe2709e8e307e18faULL}},
+     {{0x78e464ffe305fc36ULL, 0x6104abe8be1cd8faULL, 0xf7073b911973554aULL, 0xf68138d649f72ac5ULL}}},
+    {{{0xd6a81170014a31e1ULL, 0xf9a94fc0e54d1f74ULL, 0x8576c9b213753666ULL, 0x718b5579d0aabb14ULL}},
+     {{0xc52f8eff8d997425ULL, 0x734e20a197ffb8f3ULL, 0xb1fe4693989b6efbULL, 0x913ed5923591863bULL}}},
+    {{{0xf26044bdcf1451a5ULL, 0x4add6630757385a3ULL, 0xde9bb930e6d9e6fcULL, 0xf9fa728e552144b3ULL}},
+     {{0x3ef2c4ced81eb4efULL, 0x66238863341fe71dULL, 0x9205e105c6860aeaULL, 0x09b77ea3aeaa9f8aULL}}},
+    {{{0xefe837595b80d74bULL, 0x65c860ed0abdafdbULL, 0x07a6cd7c84083a51ULL, 0x5ae32f2ab41305e2ULL}},
+     {{0x3e476c0e900f6973ULL, 0x713c9673eec17a33ULL, 0x5224897e2379205aULL, 0xcceef76eee17bcecULL}}},
+    {{{0xe55fa86e9e87d135ULL, 0xe12534297122d892ULL, 0xcc0dc9cd8f9ac727ULL, 0x6fec2a9f2d287848ULL}},
+     {{0x3d0cffd2cd244943ULL, 0xe14859b440af6e07ULL, 0x88f87940bad9563aULL, 0x78346b290a8b5eacULL}}}
+  },
+  {
+    {{{0xb65a4259394e664fULL, 0x8221d14533875c67ULL, 0x8eba2cbfdc60e89cULL, 0x30f406f9adf05a75ULL}},
+     {{0x6b434c5f1fb3ff75ULL, 0xa444c9b8080d2b09ULL, 0x07cca98d50e2af02ULL, 0x68ff87cdabb0e2c7ULL}}},
+    {{{0x5be3eb2ee812cd58ULL, 0x0ff35dfb426cda6dULL, 0x40ec62aab00c06b0ULL, 0x42c33f5ff72a61caULL}},
+     {{0xa8c1e016dc1b264cULL, 0x021177894790a781ULL, 0x3d7f86b8eb6f7594ULL, 0xbe46dc0e88888d3cULL}}},
+    {{{0x91b392eb6736b49dULL, 0x5c906d1212171cb6ULL, 0xc093825eb57e37beULL, 0xd63aeb1c2dca1ab9ULL}},
+     {{0xd1f8c6a32fd51a4fULL, 0xb939e1a02ecdb17dULL, 0xaeda7593d07476ffULL, 0x6c36aada63eaa015ULL}}},
+    {{{0xfb581d5dbae20053ULL, 0x8ae29701134b4bf2ULL, 0xa5c4a33e9600f704ULL, 0xe8cd971fc13fd382ULL}},
+     {{0x57fee112cb9134bdULL, 0x11a0b793c8b35238ULL, 0x2967d854f3f90b9eULL, 0x3b8d9872cdd9bddbULL}}},
+    {{{0x435eafb5293e66a0ULL, 0x234863eb220d603dULL, 0x71ae7157ddefde8dULL, 0x8d936295cdb80402ULL}},
+     {{0x8626eb95b2059cedULL, 0xfd1ada80eb1b8b3eULL, 0x8feed1f5ec905160ULL, 0x87a9810306477b03ULL}}},
+    {{{0x31bb6fc954816da7ULL, 0x019f8688ea9e01baULL, 0xcbf09d8324d4f047ULL, 0xb8528f89ce706cf2ULL}},
+     {{0xdfadc7eb85b8e1f7ULL, 0x6b1b130aaa0c56abULL, 0x3b8395c27f2c3b6eULL, 0x4b43bba935b9797bULL}}},
+    {{{0x8653c62a22304c7fULL, 0x99ca3c8061c01a88ULL, 0xa24752afa158a145ULL, 0x33980eae5eaec787ULL}},
+     {{0xec857d3e442b5582ULL, 0x831598257c86e874ULL, 0xf6b88247569e7165ULL, 0x42ad48a06159b411ULL}}},
+    {{{0xe11c3daa5a3a149eULL, 0xe150d675c3a63a21ULL, 0x66a42ed530daf804ULL, 0x2ce792a7a7586465ULL}},
+     {{0xf4c0f59af924f195ULL, 0xb1093e74b6fe8c82ULL, 0x816d4b251433a973ULL, 0xcaf6552db8a76b6aULL}}},
+    {{{0x2d3dfe665eb2f45aULL, 0x3e3dc35b081a61d7ULL, 0x51b2b85f99bab973ULL, 0x1a0b16c127bd3c4bULL}},
+     {{0x1ea122456e41f1a3ULL, 0x24d79bca50fb87b1ULL, 0xc90a990c843c34c8ULL, 0x6a956cd951ce723cULL}}},
+    {{{0xf2dca35e4906a1f1ULL, 0xb79dab3685e1dad6ULL, 0x44fc674cd6e46a9eULL, 0x31f49a331b90e9edULL}},
+     {{0x904fec2ab82c9a1dULL, 0x02d6dd136aecfc67ULL, 0xacf7c4da453fbb9cULL, 0x49c71798182ba65aULL}}},
+    {{{0x459b58d342492b3fULL, 0xd6173868b4e8999cULL, 0x40834a809a3b0085ULL, 0xa48762227a99154dULL}},
+     {{0xbe413e5de4f9e931ULL, 0x5792a271d21402d9ULL, 0xec6f6ac2cf9a4dc8ULL, 0x4c2fc39c521fd501ULL}}},
+    {{{0x9317d8b159bdac7eULL, 0x87464ad96bb213bcULL, 0xac6b44b712b4aaefULL, 0xb40779f52cac4b9aULL}},
+     {{0x08168b9ea2eee32eULL, 0x7917d80dbf8c526eULL, 0xd70014b849a71811ULL, 0x98821c8bb3920ee2ULL}}},
+    {{{0xac435c05f2dd5edcULL, 0x395d999240b9fdafULL, 0x6957c2f825ae6f32ULL, 0xa2cfd0bf53483cf6ULL}},
+     {{0xc862d3eec8847207ULL, 0x1343c1c5a317ac28ULL, 0xba3734e53b566f54ULL, 0x77e06834a421feb3ULL}}},
+    {{{0x76e30041d814d99aULL, 0xa961695601bf8e0cULL, 0x4521dcf1cf4474e3ULL, 0xe1574eedced61b8dULL}},
+     {{0x586d9669becb64d7ULL, 0x6e37e174d2d55a01ULL, 0x316386a6c311ca29ULL, 0x1c3bb790020648b9ULL}}},
+    {{{0x3fa589fbdb0f577eULL, 0x6985a9807519dbeaULL, 0x60541bed7859d0e8ULL, 0x87dca134c5f2c79bULL}},
+     {{0xbcc5a263d7ec8e0bULL, 0x3cf5a35560eedd43ULL, 0x50f4e63b79d3dc5eULL, 0xfda09bb3d8ea3417ULL}}},
+    {{{0x1b7c6c66e39c9e7dULL, 0xfca18d71ed1a8503ULL, 0x4fbaccb1b00aaf98ULL, 0xa3d1e76ce66defa8ULL}},
+     {{0x17484a4371e2886eULL, 0x0545db7a862a6806ULL, 0xa643faa51d44a0eaULL, 0x56a0f8781b00ed83ULL}}}
+  },
+  {
+    {{{0x874c04d7b32fce28ULL, 0xf9334ce0b6527db8ULL, 0xd886faf7b9920c38ULL, 0x30f32cde358488a1ULL}},
+     {{0x8f9f17339b8b39b5ULL, 0x3bb87f121b64487fULL, 0x7fefa79fdbf502e7ULL, 0xe72915d18d0963a3ULL}}},
+    {{{0x8130235df09938f1ULL, 0xda93866b718821f3ULL, 0xed127ae5bf9d4dc1ULL, 0x7beaf068d763b509ULL}},
+     {{0xe35b041b8e2b9a21ULL, 0x3b91cc4a01c1a43aULL, 0x94474729bb8d82dfULL, 0xbc39a78536d5f6e8ULL}}},
+    {{{0x25cbdeb97ca0b1feULL, 0xbf0c0e05f6dabc27ULL, 0xa7b395537c974cbdULL, 0xa467305f929a2969ULL}},
+     {{0xa2bd473a36ba7351ULL, 0xe9061c4658fcc04aULL, 0xdaf9f5eb7d42fa03ULL, 0x8772fadd60526599ULL}}},
+    {{{0xd581df87f7f425d0ULL, 0x7e06f54cec843415ULL, 0x8470fffe8c171352ULL, 0xae4979dcf82626efULL}},
+     {{0xe2c6b511e6fd53d7ULL, 0xeb3ef6fc14404e96ULL, 0xc91ff42a643a5eb1ULL, 0x024e153b2ba199b8ULL}}},
+    {{{0x0b3bfea85e7fa3c8ULL, 0xb7621bbe881b2ae5ULL, 0xe44bb725d4c2278bULL, 0xf164663ff58038d9ULL}},
+     {{0xfe67f9cb3327a88dULL, 0xe2e1a54facb137bcULL, 0x786d4654435e5b98ULL, 0xc984e2a32d5b39fbULL}}},
+    {{{0x57d355214b67a78eULL, 0x610b3f8a35fb5462ULL, 0xfa20ad91be6ffea2ULL, 0xc92d3bbd28d9e20aULL}},
+     {{0x0f5ec9530766a9b2ULL, 0x62b9af8366dd8e62ULL, 0x1b95b3b5c4fb6ffbULL, 0xd0e88ea8c1a02404ULL}}},
+    {{{0x91ef30e4ceb1bd80ULL, 0x92e615078fadbb4fULL, 0xc352cfb5815928d8ULL, 0x133b33302fd78b15ULL}},
+     {{0x780847de6fb830bbULL, 0xfeb44da78342a4feULL, 0x1d84597c1b5a2084ULL, 0x9db0d51f922ff7f0ULL}}},
+    {{{0x7b7607a02a62b907ULL, 0xaf7d37e30444f3c5ULL, 0x2fdffd162b1e00e3ULL, 0x7e2af9b1f2ed967bULL}},
+     {{0xc495aa52255404caULL, 0x0860fb272ca4bc4fULL, 0xc05550db8f7c779fULL, 0x59cfcd310af9b920ULL}}},
+    {{{0x4c8deec6e4c758f1ULL, 0xe55d77db0373f01cULL, 0xbb1e8bd295ef3292ULL, 0xb254df7e9ece4943ULL}},
+     {{0x6c7272329c8048a6ULL, 0x7a0b0f6e0b961220ULL, 0xf25da9365477d8d1ULL, 0x746e662925ea7b06ULL}}},
+    {{{0xdd76e083fe5943cfULL, 0xe1f3b0d7b771dc95ULL, 0x11ebb723cf8051e3ULL, 0xd273defd69090804ULL}},
+     {{0x4fa10659cc380c7bULL, 0x77934fab3fe260bcULL, 0x4be79e42c03c7935ULL, 0x13119efce3bd5daaULL}}},
+    {{{0x48cd08d45c9c0e74ULL, 0x4083dd7d7ca653ceULL, 0x700bafcf271b7703ULL, 0x394ea446ead20713ULL}},
+     {{0xeefd65ca9f495986ULL, 0xf1b7d281c0112ec0ULL, 0xfa3986cbcce2054aULL, 0x458e238407d46f24ULL}}},
+    {{{0x896378d60da29a5eULL, 0xe2812dc3a8a2992fULL, 0x8a09be82b27545d7ULL, 0x8bd4c87cbbde70d0ULL}},
+     {{0xabf01f08c4b49891ULL, 0x8b5b0e9c8b9615e5ULL, 0x89601c01895d549dULL, 0x17cf6c72c7999255ULL}}},
+    {{{0x7c0bcd3101c0e529ULL, 0x90d67e0da440130eULL, 0xf76097a26543b409ULL, 0x02d6fb8d1a3d1f09ULL}},
+     {{0xe074574ff3df4839ULL, 0xa4dffb51695e3d10ULL, 0x3470854e92cae25eULL, 0xcc734bee80600f57ULL}}},
+    {{{0x4e860735de9524d3ULL, 0xb32377da29cc6c5eULL, 0x74af2dd9fc07ef1fULL, 0x8cf278ff1b6a539bULL}},
+     {{0x1d13cfbade61c8caULL, 0xce24d42f59a4b2e2ULL, 0x89eed60df9c14f43ULL, 0x00d1c68a093f210bULL}}},
+    {{{0x95c55839f47d1317ULL, 0x4d6448bbe0d00033ULL, 0xe5e2ef0e48295ac1ULL, 0x1ab12b4ef90c7933ULL}},
+     {{0x351bfac937375010ULL, 0x99e7ea7e71931b2fULL, 0xe17897057d04ad44ULL, 0xf1c592e172e93df7ULL}}},
+    {{{0x250c68173ded195eULL, 0xb3f4ba8e5590131cULL, 0xed5aca6e6f9f0e0bULL, 0x9cc7ac24e178192aULL}},
+     {{0x43b9f48c5f1a90a2ULL, 0x3ed3e2cc5560ba5cULL, 0x93540ccc98cc7013ULL, 0x0c84dd00bba374d4ULL}}}
+  },
+  {
+    {{{0x8469c61bc7f8ef69ULL, 0x9f9f3ce8afdcdcd0ULL, 0x51dd00a85d8575e8ULL, 0xa410280bb8f84f2dULL}},
+     {{0x2334fdc2cb7c654eULL, 0x6d3234c602175de9ULL, 0xc6f90c87639f5bddULL, 0x6769ec1b9c485eb4ULL}}},
+    {{{0x66384f4179620965ULL, 0xae9118362ec1fbf4ULL, 0x50ddd474f47a23acULL, 0xcfab9c28c52bc3d7ULL}},
+     {{0x8e303e908d914c69ULL, 0xb50bf6aae48d5d5aULL, 0x935c6b8c1395b33aULL, 0xb2925cc0be183c6eULL}}},
+    {{{0xade021cd3ed497cfULL, 0x4bacab3183ff1d80ULL, 0x0ad694f82b2a503fULL, 0xa0f0b6f53e6158c5ULL}},
+     {{0x831e021dcea4d785ULL, 0xafeae9b129182761ULL, 0x7ba29576ef727763ULL, 0x6b89acb9655534c7ULL}}},
+    {{{0x8be8e83d90ac9c7bULL, 0x1b90668d346ff822ULL, 0x8b9c5a4ab1b52380ULL, 0xc6c9aa134d43d830ULL}},
+     {{0x5dacd53731f4cf29ULL, 0x1d10fb1c1269f0ffULL, 0x31dffd436a3215e0ULL, 0xd4ecaad9bc0e758aULL}}},
+    {{{0x956c34e73e8d16a4ULL, 0x7316f83427321806ULL, 0xd8e7686974779fb1ULL, 0x8a9c07ade96e30aeULL}},
+     {{0x2eac45befe86be39ULL, 0xd7958cfc3c386037ULL, 0xca76b84386661e17ULL, 0xb047050d587535eeULL}}},
+    {{{0x2ddc76853c3904f0ULL, 0xa4c0ef47abbf1f53ULL, 0x36acf536069d3e6cULL, 0xefbdc5f820d5e79aULL}},
+     {{0x7b0c556037f1d8c5ULL, 0xcfa6d1e62c335873ULL, 0xab3c03e84aa7ff5eULL, 0x718d436041a72294ULL}}},
+    {{{0x47569213faea367dULL, 0xb0b30f8030872a85ULL, 0x49fdd205d647f429ULL, 0xd6f66425ac2bc923ULL}},
+     {{0x0f6631e9c4a20d70ULL, 0x7fc15ef8a14bd8fbULL, 0xd7728652ad323745ULL, 0x8f50c59cc73539a7ULL}}},
+    {{{0xe77bdff4e506cd8cULL, 0xea2ff9be542e3211ULL, 0x133b448a546e351fULL, 0x3450b69e9fddb998ULL}},
+     {{0x1815888221b2aff4ULL, 0x732086c5c74de012ULL, 0xc4ea8191316993bbULL, 0x6fae8b53f69f036aULL}}},
+    {{{0xb62b5baa78b04b93ULL, 0xc3bbcd0f8b96ceb0ULL, 0x7d3b677d52339a0bULL, 0x210887b9289f8d14ULL}},
+     {{0x67a02f4ad0ebcfecULL, 0xc8eb659e74f81242ULL, 0x51e873795431e4c9ULL, 0x7f69d2b0c77f3067ULL}}},
+    {{{0x702fcebb62abbaf2ULL, 0x2c7aa55f5eea12d2ULL, 0x30cac1000225147dULL, 0x4a7fda5fa2b13b93ULL}},
+     {{0xc90e4ab77a7cbab0ULL, 0x5c1b1fc5396f5f68ULL, 0xeaeaf68f29f0787dULL, 0x822f9b26eeb1f8dcULL}}},
+    {{{0x37d97f0f80932761ULL, 0xaaad9c7bbb6ec1d5ULL, 0x70c2d69d9875fff5ULL, 0xa125123840ef46acULL}},
+     {{0x63bf1fa96ca4e421ULL, 0xc19682aa0bb02924ULL, 0xf218db6acb483419ULL, 0x557821cb53c6c206ULL}}},
+    {{{0xa7143c0134acbd7aULL, 0x71eb0b58c385b4d1ULL, 0x44317a6c48d58093ULL, 0x5b41b61812568f9aULL}},
+     {{0x37ead0fc2c4844f2ULL, 0xacda360fbf415f14ULL, 0xc607d07f88977967ULL, 0x58c7c52e3512a47eULL}}},
+    {{{0xc3bbea0cadfdfe8eULL, 0x553d6157846cdb69ULL, 0xfe310c1275719c6eULL, 0x8892fb4cc885f767ULL}},
+     {{0x8dd93bfbd283b139ULL, 0x27076b2d528fcc21ULL, 0xca483452e1b8f7e3ULL, 0xef90ac2b0966966bULL}}},
+    {{{0xcf464f9a05e35b3dULL, 0x7f3ee77dabcf1c1cULL, 0x4880390f8d05a817ULL, 0xc857ab4c9c0600beULL}},
+     {{0x2cb019419445e28bULL, 0xb8df848be0e566d1ULL, 0xadd6249b145f1d9cULL, 0xaa04ca562e3c2d4eULL}}},
+    {{{0xf0e156e5394a62dbULL, 0x04dbcc558b05119fULL, 0x1adc6c7bdf138a96ULL, 0x284fd83e07911c7aULL}},
+     {{0xc3369cc79fbcb819ULL, 0xdfd747e37668b93cULL, 0x8653ea052d474f59ULL, 0x7f60671f66f3b5e0ULL}}},
+    {{{0xc3777b73ee54b412ULL, 0xde8a9d39905f76bbULL, 0x106c5751d762099eULL, 0x03802c9d0433d9fbULL}},
+     {{0xc966225783f14770ULL, 0x892e2c580358d4d9ULL, 0xb15bb7fa806e97e0ULL, 0x42f95aafdac5403cULL}}}
+  },
+  {
+    {{{0x984523ae7e894ceeULL, 0x7341d1d0aa16750dULL, 0xe7301b62baac8f3fULL, 0xf06838a3b15a1098ULL}},
+     {{0xda117274ac274144ULL, 0x675cb5f493d79b37ULL, 0xda8cd1581f8bc616ULL, 0x1236d921ad5c75ecULL}}},
+    {{{0x1a0067792ce8510cULL, 0x7069e0e6793bec77ULL, 0xf8e872379696eaacULL, 0x8b5ee2d93f4538e9ULL}},
+     {{0x30f1be940bc85360ULL, 0xc1f81ab63f378738ULL, 0x4df084183a57468cULL, 0x363863e2e8ec7d28ULL}}},
+    {{{0x1841bf1dd9bd8a82ULL, 0x6e4383db1fdc8714ULL, 0x236308192f9462eeULL, 0xd48ecb0555207336ULL}},
+     {{0x7e48bb31b4698353ULL, 0xd61663fc6d273c07ULL, 0x966252b376d03f74ULL, 0xf86d65b09fed9dd8ULL}}},
+    {{{0x2b5c1825737c9f9cULL, 0xf8090e3fc3528db4ULL, 0x25b693e2cae0d68bULL, 0x581d1517a50a3191ULL}},
+     {{0xb1e50101ef763f89ULL, 0x0856b6921d2c2781ULL, 0x2d28110ee55199d4ULL, 0xf8e8162b068e69feULL}}},
+    {{{0xed4ba8bac4dc10dfULL, 0x4bedd69a4dbe47b1ULL, 0x49fbd425909a045cULL, 0x14d26b68f32f87d1ULL}},
+     {{0xa3fc1297f40c2604ULL, 0x2fd795ddbd995fe7ULL, 0x08a6d91e81570687ULL, 0x74874f88b2f3750dULL}}},
+    {{{0x2f17f63282eb6322ULL, 0xe0b3104ca4b7d13aULL, 0x0dd2b4c16de4382cULL, 0xe3f73c0ad1de0287ULL}},
+     {{0xb6e1abb270640715ULL, 0x85c22e6fb3420f02ULL, 0xcdeb457bb8d7479eULL, 0xe828ec547577f47cULL}}},
+    {{{0xa1c7e97c52dc8d6bULL, 0xde3168faec9b0a91ULL, 0x854be0a38b56f4d4ULL, 0xa6b3202f6da83f02ULL}},
+     {{0xafd4dfc0caffadb4ULL, 0x9969b27d2400ee3cULL, 0x5c9daa49a1f1b807ULL, 0x68c692ff5b8f2db1ULL}}},
+    {{{0xd30cd8f261561d93ULL, 0x0cbec7d786c68bb1ULL, 0xb131f98e2a9647afULL, 0xaffa359a421c425eULL}},
+     {{0xe2fd63415b5e3621ULL, 0x1c603b8543ef5a79ULL, 0xa17a06ca680bc72fULL, 0xf0286ce922292fbdULL}}},
+    {{{0x80077a74cbdb37c2ULL, 0xdf54807dbebc1facULL, 0x2548e68c25a29366ULL, 0x97b2998934691effULL}},
+     {{0xf7e39d2809cfbfa1ULL, 0xa2d95da8b81c2b23ULL, 0xd7da8e47238bfecaULL, 0xbe7db0943e7c248aULL}}},
+    {{{0x70d137f1e9f76366ULL, 0xa3a89ceb7dcb546bULL, 0xcbcd05971b0ed7b4ULL, 0xc9567ec603753856ULL}},
+     {{0x3583fb0d02bee1aeULL, 0x28ad4653a2f21ce5ULL, 0x1a2f99105ec2e46bULL, 0xe14075375217d5efULL}}},
+    {{{0x87aed7e6d149a542ULL, 0x2c9b1aed10c37915ULL, 0x08acaff774148cd6ULL, 0x8bc8bf9d3923fba3ULL}},
+     {{0xee9b2e4e3a6380e7ULL, 0x8f018b7abcee26eaULL, 0xc962ef69299f38d7ULL, 0x66364a019684448fULL}}},
+    {{{0x33512fe5d738ee63ULL, 0x6d6ef58fe0851142ULL, 0xa2fbabb418df908bULL, 0x37496ee1b520328eULL}},
+     {{0x52abc34eed944efbULL, 0xfab8767437b6a66cULL, 0xaf130b1d0bdb820dULL, 0x32b0265d8e9dea18ULL}}},
+    {{{0x0ac87add1ff6917dULL, 0xee9079102d89b08fULL, 0x6bfb32925d721acbULL, 0x0d68c3c05ad35123ULL}},
+     {{0x06002967c34bb364ULL, 0xbf0558f382bdd972ULL, 0x11449a68f3327e2cULL, 0x43775279f00df3a4ULL}}},
+    {{{0xd8bcbfb4442e99d8ULL, 0xc00bebc586fc4f74ULL, 0x9cc1b2af123aa5caULL, 0xabf2a59cf61643a4ULL}},
+     {{0x11568a36cb364b80ULL, 0x6811225374caf36aULL, 0xf9d9e1b15f7f94d5ULL, 0x1faa7b247f00263cULL}}},
+    {{{0x8889db495ac5dc2dULL, 0x6f6cc2843f68f9d4ULL, 0xa30b724088611555ULL, 0x599d259a95f4afd5ULL}},
+     {{0x47c15dfc69eedc2eULL, 0x6a9a4b63e6222dc5ULL, 0x215dd3c824957ddeULL, 0x4c20985f9a722f3cULL}}},
+    {{{0x94ccf71778a9fbfaULL, 0x019c1428080f085dULL, 0x92e3e335e694099aULL, 0x4e04b543c316f258ULL}},
+     {{0xe5ca1ed3e7076f94ULL, 0x45c1480c30885828ULL, 0x486c475fe63cb777ULL, 0xefe42db266a14c30ULL}}}
+  },
+  {
+    {{{0x961874e1aee918aeULL, 0x6af777e58cc712b5ULL, 0x5ecd37f71bd54c37ULL, 0x8bfe74f4d8f65741ULL}},
+     {{0x87ea7b31130e4369ULL, 0xe8beb32a06d928daULL, 0xce455691669f6c2eULL, 0xed131a32bc32aedbULL}}},
+    {{{0xab103b92de24c3c9ULL, 0xb34403fe414912c7ULL, 0x1ea5fa23cc6f9b5fULL, 0xbca106fb0dbcd695ULL}},
+     {{0x5dde4e5fdfab9466ULL, 0xeb1930a928bb7c85ULL, 0xdb6ca5deed454124ULL, 0x608b0a917a960ae9ULL}}},
+    {{{0x8c78f8e5b7173bdeULL, 0x042de3f7c1fe2732ULL, 0xdc3dff0b3ce5d933ULL, 0x1ccd291bb6dacd2cULL}},
+     {{0x7cb26a89e75377b8ULL, 0x71a0d04632f3ac0fULL, 0xcd58c6bd89f4d770ULL, 0x463bbf0b1e288727ULL}}},
+    {{{0x4fa3b54000792625ULL, 0xd98bb81243ee6567ULL, 0xdb88d78aff73f086ULL, 0xb3db165be2a22434ULL}},
+     {{0xadbb92c3980d2ca3ULL, 0xd58fb1016ffe158fULL, 0xd7d1dd4ad2c53c7fULL, 0x002987114d2f3e21ULL}}},
+    {{{0xc816c2cf01e55e3aULL, 0xcfaf0e4fdaf9476fULL, 0x2b446712262573e4ULL, 0x14e015edfad97791ULL}},
+     {{0x00fb98ed85ad79f6ULL, 0x169d2b79d95ea0b0ULL, 0x2aa9923104b63285ULL, 0xa574a26ca85600b9ULL}}},
+    {{{0x295883439d55b87cULL, 0x4ed72d5e56417eafULL, 0xd3d3496c9350f21cULL, 0x0a5b969a11b67929ULL}},
+     {{0x318177267eee289aULL, 0x0d9c06a8bdecf4e6ULL, 0xb12815f3cae96b3eULL, 0x7d3a00dc79e642e4ULL}}},
+    {{{0x9337385a19213f11ULL, 0xeedccca1d1b0a0d7ULL, 0x05c0ff2efc0e7a60ULL, 0x69d9fedfc165f160ULL}},
+     {{0xb6b3903d3ec01197ULL, 0xa7928060144edf44ULL, 0x9bda2ffff51fc906ULL, 0x7628a5ce11389cb9ULL}}},
+    {{{0x37ca1fccab6a1f0aULL, 0x522022474f146321ULL, 0xeedd804afcc61c68ULL, 0x8fc63a157285e258ULL}},
+     {{0xb5a63a20c314a9e6ULL, 0xaba4441480829b59ULL, 0xd81d9357036c434bULL, 0x6c590442505b4830ULL}}},
+    {{{0xfd3f19fa7c3062eaULL, 0x2eee744c354339b6ULL, 0xb9748cba7af5bf33ULL, 0xf28e9f521cc9c97fULL}},
+     {{0x2a9a6d2b75e7a946ULL, 0xe5a22036828d4c60ULL, 0xf30b24958abc3e07ULL, 0x624f567f231a4ac5ULL}}},
+    {{{0xa94dc4b22ea2e39aULL, 0x224fe23bdae8d6a3ULL, 0xdabc30689d1607b2ULL, 0x24f8cbbd427306f4ULL}},
+     {{0x7279d908a7c26e6fULL, 0x82a54b7adeb726e9ULL, 0x5e3f6f748c827bddULL, 0xbb3da7ee5012447cULL}}},
+    {{{0xdc7f418dcee4c714ULL, 0xff4391e7d32874efULL, 0x3200e8c1584d795bULL, 0xa32b1e4fdeed8abbULL}},
+     {{0x2085cb62ee7c79b2ULL, 0x7b05d680188fd66eULL, 0xc92bf6238ffd4ed1ULL, 0xc167aa8fcdac8a95ULL}}},
+    {{{0xdc0988646286202aULL, 0x29d8729c26327977ULL, 0x5ded4713413e3cabULL, 0x3ce874663c338e01ULL}},
+     {{0xcfe41bb3d367dda7ULL, 0x48f4bea92f471e85ULL, 0x1d33a4dfe9ae973cULL, 0xdea367360c330ae1ULL}}},
+    {{{0x85593ca2f8c3e809ULL, 0x0f9822065aff9fd0ULL, 0xabe1747a40351ddaULL, 0x5106638635a29f22ULL}},
+     {{0x04ed8a51118ca969ULL, 0xe403ec6d1a835c95ULL, 0xf193d0e5c4a9aea5ULL, 0x8dcc653ac8b1a63fULL}}},
+    {{{0x79cd9e9d938676abULL, 0x3efe8c8c56fec468ULL, 0x1d55cb3658b8a6cfULL, 0x4aeb10d4074c396fULL}},
+     {{0xd1108c074f3c8f5cULL, 0x14c59c3cd68f3428ULL, 0xbd398b0b2ee6de97ULL, 0xa42ab3c1089f23ffULL}}},
+    {{{0xe77ee6fcefd1aac4ULL, 0x8c921fdad8e4f16bULL, 0xc692d3befddd8fb1ULL, 0xff6def44fd704f0fULL}},
+     {{0xc47040c8f8f54a5dULL, 0xab44df3f5881ccdeULL, 0xc170c03e2bc6677eULL, 0x3d677f7a252c3027ULL}}},
+    {{{0x7198d108afcb9d2aULL, 0x2340448ad6e0185bULL, 0xa4fb6441c78a678eULL, 0x7b0e21fe6193bb02ULL}},
+     {{0x4f1702201deeaa44ULL, 0x45fdcb8f066c6209ULL, 0x27e50d6b17b5c692ULL, 0x492ada6a6c26c0b1ULL}}}
+  },
+  {
+    {{{0xca7d84e8e971aed3ULL, 0x599e0ba4f53e4249ULL, 0x84cf77a8cc57dd3bULL, 0xa56929a62c6c7622ULL}},
+     {{0x9c898906d422a636ULL, 0x437c8f8a072d1c37ULL, 0x3520735110251fcbULL, 0x317e7b2f59b4d9b9ULL}}},
+    {{{0xde018705bb9eea17ULL, 0xc966594ecc6ee223ULL, 0xc900821a741be86fULL, 0x4287f98bc0d05786ULL}},
+     {{0x25ce50f2eb0d2699ULL, 0x50faa88deaab5a08ULL, 0x253623a6f2e0c954ULL, 0x21c37db4162ffefdULL}}},
+    {{{0xc71b4035f4a5a900ULL, 0x745fe3d4e7e212a6ULL, 0x7d65c256bc6c3282ULL, 0xdad75a210cac9337ULL}},
+     {{0x5e1fd60f702de28eULL, 0x875f7259b0b68e87ULL, 0xab463c10ef04e0a2ULL, 0x8905fe453f657a2eULL}}},
+    {{{0x17b7a101437365deULL, 0x6fd319f085a912a5ULL, 0xe47c670e9bb8d1b8ULL, 0xe53b8c986e435b70ULL}},
+     {{0xac9789eb494ea7fbULL, 0x74ce653af04b4562ULL, 0x01956571e2ba02b3ULL, 0x06a1215ec9b11529ULL}}},
+    {{{0x771680433f8a707eULL, 0x008fd5b0485c8765ULL, 0x4e280969aa3bb5ebULL, 0x1b69e158a671939dULL}},
+     {{0x6958965a6a1c2ca6ULL, 0xc9271384b90471feULL, 0x5cc0a150612c60deULL, 0x77e9c3598e946b65ULL}}},
+    {{{0x19e8977e6dc04ac1ULL, 0xc8b6167515fddf53ULL, 0x977907ade151e757ULL, 0x9df5a2db0f410469ULL}},
+     {{0xbc45029eb39b4a64ULL, 0x45532380f3b2c722ULL, 0x4c4dea253a11013cULL, 0x244c5badff3afdd9ULL}}},
+    {{{0xe1bdc665f1c9bfacULL, 0x7f164f8bd34d502bULL, 0x75efe27bdefa215fULL, 0xf0b6b7c1fe3aa9b8ULL}},
+     {{0xfcc9cb65b7993ae2ULL, 0x4931ac7b18ad52deULL, 0x3cb50967f1cf5aa8ULL, 0x894543cadf4c7a89ULL}}},
+    {{{0xee76f06650b24514ULL, 0x779805bc7892df73ULL, 0x07de13797245d3ddULL, 0x380eac672638e460ULL}},
+     {{0x13f847dae5f037a2ULL, 0xf3ed498ea0614bfcULL, 0x726e870043b7d34fULL, 0x8a289ff3a2d979e4ULL}}},
+    {{{0x1760923f871c23e4ULL, 0xe28860757b23d005ULL, 0x505823e703a2d14dULL, 0xcec0340037da358bULL}},
+     {{0x9ee9149535440dffULL, 0x0aa8ca0d9dc654f5ULL, 0xd564c201b6e42d8fULL, 0x27f9b38e6a0ef688ULL}}},
+    {{{0x65caa383a344c419ULL, 0x698b79f0cdf3bfa2ULL, 0xffbe0a78bc90f9fcULL, 0x592a5f5e7ca0f26fULL}},
+     {{0x7d80de89078001c3ULL, 0x59aee310777e71d7ULL, 0x67185065c06240a1ULL, 0xc8c4e02590c7781eULL}}},
+    {{{0xd14431df07539b07ULL, 0xa4160eaa5a0e1c87ULL, 0x142c5fc2646c348cULL, 0xcd65e02f65c3bfa9ULL}},
+     {{0xf363f8b739c31618ULL, 0x683a75e0b20a97b1ULL, 0x61dad458ac2f6197ULL, 0x741007e4329dcf7dULL}}},
+    {{{0x98c25d9e2b538948ULL, 0x0f86aed5e41b1990ULL, 0x500a391b06e60e22ULL, 0xd362231fcfcf235aULL}},
+     {{0x2c21231afb0bdbd6ULL, 0xd241a4039f86903bULL, 0x58fe7a9db95de11cULL, 0xadbee90c42f998bfULL}}},
+    {{{0x65e33719c58e11beULL, 0x40d5b03625ae4295ULL, 0x1a221e76654e60deULL, 0xf846d5203f31e90dULL}},
+     {{0x106310eec187655dULL, 0x1ab93e0112a16ed6ULL, 0xf3629b3d19278b59ULL, 0xd8c38dcec7cd5493ULL}}},
+    {{{0x01925c3c87f97a5cULL, 0x778c0e9d720d6712ULL, 0x42d22371af0c0eacULL, 0x5599e0d6c9846dcdULL}},
+     {{0x18840f33d0a2a44aULL, 0x69a58fa905db1640ULL, 0x5eade39c2631c3eaULL, 0x5f9b029e8cd3297aULL}}},
+    {{{0xfddf357f2aaa21c5ULL, 0x67325cd8d5c97517ULL, 0xb3a5b4523d58b901ULL, 0xa5fee466e21703b4ULL}},
+     {{0xd90ea58a7aa3d1fcULL, 0x29926e41c98ec559ULL, 0xb9688feeeab7674bULL, 0x67fe7ef782f640b1ULL}}},
+    {{{0xedbb197fda033747ULL, 0xf1218ef3bb5be51bULL, 0x7a9ef6b6cf0a465fULL, 0xa3a3d947caed300bULL}},
+     {{0x5b1b6eb5aa677a41ULL, 0x8108f7632bc61623ULL, 0x3da8a0f768c75143ULL, 0x099f4a9c5fcb6ed1ULL}}}
+  },
+  {
+    {{{0xf4e6fbcee96293b6ULL, 0x5beb30a26e7571c0ULL, 0x20a9b182ae6e203bULL, 0xd11d069282f0ab7dULL}},
+     {{0x129abbffba2f5e1bULL, 0x8c46d5ba7a4726bcULL, 0xad3356ebb8b1233bULL, 0x34ece6f82dd94944ULL}}},
+    {{{0xe6ea8ed81ffb6549ULL, 0x7b4c557aba61e79bULL, 0x2ff26212e5ad2996ULL, 0xd2746ef65ad404b4ULL}},
+     {{0xf1df2e4d44ad7b2fULL, 0xed111e134ca09129ULL, 0xe9365fcbc92029cdULL, 0xc93491bb2f582c37ULL}}},
+    {{{0x0f921d7eb57f309bULL, 0xee167ea7900652c9ULL, 0xc8dbd96a1a3e027dULL, 0x190910f635580428ULL}},
+     {{0x3ec94796a02a3d60ULL, 0x4ac657ae2213421dULL, 0x018262829b5880b7ULL, 0x2adfd4440a823453ULL}}},
+    {{{0x82e48bd4ab293011ULL, 0x1bcb912a133ddef3ULL, 0x43d220df65a9c7a7ULL, 0x1a15e51482c30cf4ULL}},
+     {{0x07993a3e649bf779ULL, 0xd02480d7a6763b4bULL, 0x6a6a03d7ba1596edULL, 0xacfc22df8c55b8c3ULL}}},
+    {{{0x0f9c384c830b4d48ULL, 0x29f924c857b0cedcULL, 0xfe44f52362c55bbbULL, 0xa75935cd13a8975aULL}},
+     {{0x4814f1cfd0ec3beeULL, 0x4b450573662294a8ULL, 0x8d8f189094c6de65ULL, 0x9ce7f83c25823a76ULL}}},
+    {{{0xf44ddcdbd200fbd0ULL, 0x35e60bd500b5ea49ULL, 0x4e2cd7d66bebd62dULL, 0xd1a5d671532901edULL}},
+     {{0x39dc81478b9e1771ULL, 0xfee6960d5436c2fcULL, 0x0150f533dd72e8bfULL, 0xd4dea4710fa265f4ULL}}},
+    {{{0x00945843d3afc032ULL, 0xad64d74ad3b01d2fULL, 0xcc9895760ea79af2ULL, 0xa1a8bc767d640ac3ULL}},
+     {{0x5b82899859adc3faULL, 0x43ebbfe1c5a36abdULL, 0x8710dae17fa93676ULL, 0x383216cb71857168ULL}}},
+    {{{0x429b49ee3f045530ULL, 0x548f8db407b8e212ULL, 0x9ee0c30c4a1f8e1dULL, 0xed7e78900a5a9263ULL}},
+     {{0x86f57a1808a49b58ULL, 0x08a53f6400a753b1ULL, 0xd3f21f3b6bd37b1fULL, 0x44641237ffefab82ULL}}},
+    {{{0x0bbc026a7ba5cb2eULL, 0x206ab8d6462c0b6bULL, 0xa72276069c0b3fb4ULL, 0x13b4de5df28af6e5ULL}},
+     {{0x1230400f1b4a1a18ULL, 0x826334a6897a32bcULL, 0xf2b3340d25666c6fULL, 0x298cf20d4fcc15b9ULL}}},
+    {{{0xc0f3704570ee6ffdULL, 0xdaca77a51f5955c4ULL, 0xaccf797a01e4a8dfULL, 0x92a0fa57159ad376ULL}},
+     {{0xbf510cd2edf0f82fULL, 0x9a04ae93143f47c6ULL, 0xa85962042092c92cULL, 0x6b9f6eb181a1dec2ULL}}},
+    {{{0xd8926a342963beedULL, 0xa9aca44d4839660cULL, 0x42cd18471c016c01ULL, 0x66dca2a03ca8d10bULL}},
+     {{0x00b9d79cf04fb5bcULL, 0x17ff29f62756ea3bULL, 0xd6b2fc1deedaae81ULL, 0x2a6c09e5d003ba13ULL}}},
+    {{{0xab032b04a5e9272eULL, 0xcccb15e336c33cf6ULL, 0xd460f8f37c051312ULL, 0xcf6f2fe6edcbe7e1ULL}},
+     {{0xce109ea3637b064cULL, 0xb8c8ac86cdc94459ULL, 0x5c53c1b3c9f00995ULL, 0xdcaac0037b060872ULL}}},
+    {{{0x2131b0a4119f01e2ULL, 0xfdaa8f0762569008ULL, 0x990f8214c0c91597ULL, 0x7a99d376824b1e7dULL}},
+     {{0x127d9aba1b391fc0ULL, 0xcc76aa5ff1dad219ULL, 0x755fab7911e6a3b5ULL, 0xa4beceddfeca416aULL}}},
+    {{{0x394d072de4768143ULL, 0x9392acd25e4a3929ULL, 0x8dff16fe88b10cb1ULL, 0x1482d5e68d1ebaf4ULL}},
+     {{0xd0b258ac12df352aULL, 0xb9041395768c4cb9ULL, 0xc155e6ca72d0733aULL, 0x80ed9682a941a98eULL}}},
+    {{{0x40f90573e7e2f87cULL, 0x81a098ec9cf8dd89ULL, 0xd98cc583fdd19312ULL, 0xc0fb0f237f98c2d0ULL}},
+     {{0x767b76d6855c5f21ULL, 0x83c96654b691532fULL, 0x9b3202d1c1346916ULL, 0xd8bc5410383bbb70ULL}}},
+    {{{0x78bd5527ba0f9377ULL, 0x1f01f6f4ff8a7068ULL, 0xa19919bf169beaf3ULL, 0xb8ac55ce82f417fbULL}},
+     {{0x5ac9e893b32fff79ULL, 0xab140a89d8b5a01cULL, 0xd4f9617ab324bb87ULL, 0x5e3e264bb3e02986ULL}}}
+  },
+  {
+    {{{0x25543a9808ece7bbULL, 0xbfce6e627c9e0008ULL, 0x91b2234b3811ed0bULL, 0x83a2ef82e5a815d8ULL}},
+     {{0x792bfd95daa83c96ULL, 0x01f7c014d70ce864ULL, 0x1beaa448b88075f6ULL, 0x03d344ea2fe4755dULL}}},
+    {{{0x0c579f617b8a5e23ULL, 0x4b203547a3a1864dULL, 0x4c849ebf2b318f95ULL, 0xa29394b867387363ULL}},
+     {{0x773705a64cecb325ULL, 0xa76e9ad91f0a6436ULL, 0x2df472a4c6425b96ULL, 0x11c9a9130fe56a56ULL}}},
+    {{{0xae324d6de5ed827fULL, 0x48fbc6631118e5e9ULL, 0x86bd4f6e02345d81ULL, 0xb8c30169c6e5a789ULL}},
+     {{0x9b30fb83e91b4e0eULL, 0x89b1f3cdb306c9a3ULL, 0xda881bcbebf939a2ULL, 0xd290d6dd53552674ULL}}},
+    {{{0x8af0160819d765ebULL, 0xcfe433bcd7a20b91ULL, 0xeead505a2fd5bce9ULL, 0xe07278d80502833eULL}},
+     {{0xeeddacaca6fcb1cdULL, 0x5c1763d9663811e3ULL, 0x18428638beac28ecULL, 0xeaa1454ff68eca43ULL}}},
+    {{{0x8edc7e68f14ec15bULL, 0xcd186111c5ab03fbULL, 0x0db7ad4924ec9a2dULL, 0x3135c3fc949d164aULL}},
+     {{0x288c00f8cf605889ULL, 0x4a1cbcc289e67c80ULL, 0xfb706575bbe182a8ULL, 0x64402d41d360809fULL}}},
+    {{{0xf4baf5eae85898c8ULL, 0x51d5c3aa81657c64ULL, 0xdf2b065810f296e9ULL, 0xdf82eb97f9b7d395ULL}},
+     {{0x53a8d39945b99090ULL, 0x7f287ac192de7042ULL, 0x1466e6d475a399d2ULL, 0x97b6c805223a2c85ULL}}},
+    {{{0x7ee31abdb2a37104ULL, 0xd80a4078a567b970ULL, 0xaee4d602316b72b0ULL, 0xf89fddea76bc2be6ULL}},
+     {{0x8dbcd525f98e0f7fULL, 0x7cb8d37e962d4f80ULL, 0xdd203be977b15691ULL, 0xcdca565c3cbf94ffULL}}},
+    {{{0x7b6839a39178cce0ULL, 0x2f63cb380a7fe098ULL, 0x84dbe8f5dc32b2dfULL, 0xe7682f9214e0b36aULL}},
+     {{0x0cdd25c09b22d381ULL, 0x45c4bcef75921eb2ULL, 0x01bb02c1d46ebb01ULL, 0xbad63a205fb28358ULL}}},
+    {{{0x95641e28bb01238cULL, 0xf6aa83f9281d1037ULL, 0xb8151f10b25086a5ULL, 0xaf685c12a179b384ULL}},
+     {{0xe69d2bd790ce1bd0ULL, 0x366db74ef9080820ULL, 0xb3a89a7bfe19a785ULL, 0x2eaeea9fe29a89e0ULL}}},
+    {{{0x14ab84e147835a60ULL, 0x58e3adbb1275c6f0ULL, 0xdd64a12446e6cfe9ULL, 0xcb6d0d14860194adULL}},
+     {{0xb6779d68c78dd5ffULL, 0x186ea47ceee36b1dULL, 0x7e1b57509383198eULL, 0xd3d9b535e51da635ULL}}},
+    {{{0x5240dd81a84f9c58ULL, 0xda159bb057db9712ULL, 0x526dca4a08deebfaULL, 0x4f73f0cd3300e7beULL}},
+     {{0xd4e0bc222d494801ULL, 0xfd7ccb380ece09fbULL, 0x870fe99a86086392ULL, 0x13c537d378cc60f8ULL}}},
+    {{{0xe98750d188cf7f88ULL, 0xf5be4098e1ae527aULL, 0x3782bc4c3f7af96eULL, 0x92512a770c44b7a1ULL}},
+     {{0x01e42e5650bcc066ULL, 0x21daa94b724482cdULL, 0xca25a2e5eb2c223bULL, 0x2d0d76ccbe94a86eULL}}},
+    {{{0x73d69d2ff7639c03ULL, 0xd9204edd14252789ULL, 0xd4edada7a19f8802ULL, 0x3c9b247753c2c9c3ULL}},
+     {{0xbe5f3ed7baf68e3bULL, 0x0b88c577f98a5170ULL, 0x536ee800d2ac0ea6ULL, 0x3990a96a04b4c3e0ULL}}},
+    {{{0x59acf65aa71f3f52ULL, 0x7af86199014e2537ULL, 0xf236f12d83025f01ULL, 0x818842aac4bf056bULL}},
+     {{0x8797bdea4b835b86ULL, 0xea627ccadbce81a9ULL, 0x9cfa3f8d7def519fULL, 0xbe5f555048bb7226ULL}}},
+    {{{0x6b3dc9c98f5a2f7aULL, 0x08fa6996f73d12ecULL, 0xe32d0b0272b6bce0ULL, 0xbe7bcdf99f983563ULL}},
+     {{0x4b6197ee450aeccaULL, 0xf4430820e597a264ULL, 0x72906b721d30da06ULL, 0xebca47d28fa2013fULL}}},
+    {{{0x72d64b8666c8e5b6ULL, 0x567b2b13a51436cfULL, 0xcad3650c686e222cULL, 0xdd4ea0a10646e9fbULL}},
+     {{0xac6a467c69e1ef5eULL, 0xb1c42e5d12d9e7b5ULL, 0xd35276b59db1da56ULL, 0x3086068e2c0bf875ULL}}}
+  },
+  {
+    {{{0xb4227ca6ec259a94ULL, 0xe2dcfe6cde3f30fbULL, 0x4648e67afcb8a0a5ULL, 0xa83002b78a26c4d1ULL}},
+     {{0xc0d4a8c6a4d29236ULL, 0xb09333474e0911acULL, 0xe2c30927b6b44832ULL, 0xd37ad709d21bca8dULL}}},
+    {{{0xb0f1fdef0176dcbdULL, 0x25c880c02ab2fc96ULL, 0x7b646f94f87b7b8bULL, 0xbfb9e77429f9b83dULL}},
+     {{0x74167e57a0851d4cULL, 0xb8c61c5449631435ULL, 0xb9f701f08b5e5854ULL, 0x1cad6f6bad7969ceULL}}},
+    {{{0xcfd2998eee26b52aULL, 0x1de6b8827d27d797ULL, 0xd904263d997eadaeULL, 0x85e2c5b82902476dULL}},
+     {{0x3922483de490382eULL, 0x66f32b0181479fe7ULL, 0xbd84b6013017d0e3ULL, 0xa1660a92d5af5a9cULL}}},
+    {{{0xdf1f3cab533b8f7dULL, 0xd71bb60c2b48ae47ULL, 0x7905dd8965431f81ULL, 0x6d09b5248bfcedd0ULL}},
+     {{0xfdd838e0d971ce5dULL, 0xbf2e3ec18515a89aULL, 0x52325d489762bff4ULL, 0x26aced6eec86e051ULL}}},
+    {{{0xacc949abf39ffd57ULL, 0x29b5183e19f3603bULL, 0xd3b929bcda8e14d8ULL, 0x35453651ddf90980ULL}},
+     {{0xa6164c37bb09c6a5ULL, 0xa3da8a686f31c3b7ULL, 0xb9c6693def9bcbb9ULL, 0x98a157d8b22d8651ULL}}},
+    {{{0xce73fff0358f1795ULL, 0xf15aaf46ec0c1c99ULL, 0x509e69b2ac8f5128ULL, 0x5a39a3db4626e79cULL}},
+     {{0xa5d9fd03285c53b0ULL, 0xacc3815974ff9fe8ULL, 0x99f9249c1dd929c2ULL, 0xd6166e9d4ea1821eULL}}},
+    {{{0x8d9efed3e335c4c6ULL, 0x87c9a515fbba3fcaULL, 0x95d18e201338abb8ULL, 0x240615122c51b6e5ULL}},
+     {{0x698a6e525638cf67ULL, 0xab8e5ff058aba846ULL, 0x73e78e1155940623ULL, 0x7dc828f5d715300fULL}}},
+    {{{0x33e9a54ae0c2e4f5ULL, 0xb825074b02e6f275ULL, 0xf113c2d476fa587dULL, 0x0eb9b9270693af6aULL}},
+     {{0xd916b115a4f9bee5ULL, 0x8c93a9d6db8d78abULL, 0x025f73ddd3460a0cULL, 0x743e3e3574da7a16ULL}}},
+    {{{0xd52ddbf09d16018cULL, 0xe9a211a974059750ULL, 0x06b26ec2df0305e6ULL, 0x99a1bc7573fa6008ULL}},
+     {{0xeb769b6eb6c15953ULL, 0x75c27ed75985c9acULL, 0xbc71a0997daddc90ULL, 0x76b7ca27482c8460ULL}}},
+    {{{0xf7672c8c205b870fULL, 0x333453e657d2bbb5ULL, 0x411b40b530997802ULL, 0x5846e9b560463035ULL}},
+     {{0xa1a4412e6817f7b8ULL, 0xcc03572defd373cfULL, 0xf165e1b85fea6ea1ULL, 0x2a3a706077f46706ULL}}},
+    {{{0x03ffb40350093bf1ULL, 0xabbffd70129f89daULL, 0x6433419cec9cd6acULL, 0xcd3d7679c6a9dbdbULL}},
+     {{0xb4e46e9b6d5330d7ULL, 0x6717d28d4f3401e9ULL, 0xb46886f87e9b98ffULL, 0x1c4b68f44abd08f8ULL}}},
+    {{{0x6c45e46e6e484f83ULL, 0x6b2f542401366881ULL, 0xe4f3a37a9e0e023bULL, 0x0fc41fbc06ebc76eULL}},
+     {{0x2b44fb8a77b6a3faULL, 0xf8ae45e3f52ce59aULL, 0xa3d48a6a1dcae275ULL, 0xa79778e3b9da7832ULL}}},
+    {{{0xb770ad5058ac3a8aULL, 0x0c728724895fc37dULL, 0x8b9f454e1ace9217ULL, 0xe65468e2e3b58149ULL}},
+     {{0x8eba1bdece8b82c4ULL, 0x31377b8a3db3bf67ULL, 0xb47134e55b8619a9ULL, 0x71dc6943582b9563ULL}}},
+    {{{0x58f49fee2528a1b3ULL, 0x2c747de4041ae993ULL, 0x66db9c5b847da524ULL, 0x1f82a7ea3931e840ULL}},
+     {{0xee88dd7bc7ce4d7fULL, 0xc0f928f7a33c6311ULL, 0x903c2e3b926735efULL, 0x71849962b6599e2dULL}}},
+    {{{0x34ae021a66115e16ULL, 0xc4c0e470f315f1caULL, 0x35592ab3586259b7ULL, 0xc61da7e51c0a65deULL}},
+     {{0xc05fe5ebe4bc6588ULL, 0x1f9ed79a2f1feb8eULL, 0x68a723b00594669eULL, 0x0f4ae1052a43216cULL}}},
+    {{{0x0a0cfbff21feafaaULL, 0x6ea283a1a921b6efULL, 0x8211b5df1340020cULL, 0x23f5e1d99114fd45ULL}},
+     {{0xc16755929033f18fULL, 0x72a5e157c8869adeULL, 0xb18c0e4ad0ed7a79ULL, 0xf74f3c8c8900871cULL}}}
+  },
+  {
+    {{{0x2d529888f4e93501ULL, 0x685c98d7ed0e522dULL, 0xc35440f239bea3beULL, 0x5e62811b478af190ULL}},
+     {{0x4938481b235c09bdULL, 0x5537945ef58f1ff8ULL, 0x816c9a8d5caa87e6ULL, 0x559bbfaac33d4f6eULL}}},
+    {{{0xbf2d34d910cde555ULL, 0x805ef01d6f8b2424ULL, 0x87333128c38b6457ULL, 0x2cfcc532381b4881ULL}},
+     {{0xe331ea320b40cc83ULL, 0x9350fdde3390aca1ULL, 0x082fabd2ec2f12cbULL, 0xacab8509f1ba9123ULL}}},
+    {{{0x361a35ef0a95afe0ULL, 0x12c7527e348b7b75ULL, 0x03acd07c190482e5ULL, 0x250b43f051e75b09ULL}},
+     {{0x2bff662387d729b5ULL, 0x1d254d8e04585ee2ULL, 0x89fca64a18d5ef41ULL, 0xfe97bb5b75b39d9bULL}}},
+    {{{0xba22e650c4a8eec8ULL, 0x5f977978a8d5ef87ULL, 0x7384424b5f6e1da6ULL, 0x40883b0e69e34b36ULL}},
+     {{0x623aa729ca5244c7ULL, 0x905b72ae44cfab12ULL, 0xb752031add843ffeULL, 0x40a74cba773672d1ULL}}},
+    {{{0x1fb29f01d45dd451ULL, 0x3b3825c33d3c00f8ULL, 0xfba85c7fda280dcaULL, 0x018a99acbe38707bULL}},
+     {{0x49210129988394beULL, 0x3d648b45599e9ad4ULL, 0x36ac002d8c968de6ULL, 0xde53ead9ffe62889ULL}}},
+    {{{0x4a493b89636036dcULL, 0x29ece7541766e941ULL, 0xe25371e84f202023ULL, 0x021b0dc5107eaf40ULL}},
+     {{0xe9a07c303a902e65ULL, 0x7fa35b683422361cULL, 0x4a21b207d0f7d163ULL, 0xf48a1f306951e776ULL}}},
+    {{{0x5b7ce1e43843fc27ULL, 0x371d13e0999f6919ULL, 0x8d062a7149dd2408ULL, 0xddcfe760d53a68bbULL}},
+     {{0x05774978c82b7ee7ULL, 0xca6d79f9f076dc44ULL, 0xfcc9f11741370597ULL, 0x27744cafda6609faULL}}},
+    {{{0xe3bfdc75356b2b35ULL, 0x16ef2b39cff323e9ULL, 0x330da2122d671156ULL, 0x07d2d02586c372a0ULL}},
+     {{0x124aec2876605a0bULL, 0x4430cbb4667dc536ULL, 0x801597b134ff2c6cULL, 0x0506175aff5675ceULL}}},
+    {{{0xa3181c21775d1d1cULL, 0xf5679a6adb3fc1faULL, 0x5db931e9b6f22145ULL, 0x8605190f499d9cb3ULL}},
+     {{0x1d658b36d2325a26ULL, 0x874f509806ac1519ULL, 0x64d4d3c7eb90cd0eULL, 0x02d2426cdaf001f4ULL}}},
+    {{{0x974afacd14da5ab1ULL, 0x18f21ad1dbce73abULL, 0xde36f4b5784e1f16ULL, 0xa9191fb86559abfaULL}},
+     {{0x17d3bdae1d8b9be0ULL, 0x131e23cff29f6db0ULL, 0x13825a8e65bd7dcaULL, 0x153050296d98bc7fULL}}},
+    {{{0xd2526c0785c7b6c3ULL, 0x37b316e627d60085ULL, 0x0c2d81350e5c5ebeULL, 0x53d7a75bf4cd84d5ULL}},
+     {{0x371bee9a0bb4e5a6ULL, 0x4bbb0a4df790dc63ULL, 0x0c52ab7d257d0bd0ULL, 0x9fb1b1c6a2294310ULL}}},
+    {{{0xef78b08f8ad04c0dULL, 0x46ce9a4a24f53d6aULL, 0x1047633f98bd3c77ULL, 0x14b27e70d5ac134dULL}},
+     {{0x27854538b84c0fa7ULL, 0x32c37ebae36cccf4ULL, 0xfa938fcc899887cbULL, 0xc06ba4cc8ce35d26ULL}}},
+    {{{0xf866e178557a86afULL, 0x08afc138f6fcc361ULL, 0x16187a603b909bd8ULL, 0x9ca7b0cf7d53e507ULL}},
+     {{0x07db938e0a807735ULL, 0xd8d5b199270bde7eULL, 0x4a0ea6236f88b0ccULL, 0xf6c8115a5aa9bfe5ULL}}},
+    {{{0x99ca319d6f71326dULL, 0x9e2b1a8baec7fc5bULL, 0xf37f8b0163ab2dd5ULL, 0x192dc86ce03d2938ULL}},
+     {{0x49bb566d59c0fe3aULL, 0x48f1855bf9136024ULL, 0x28214674405cb6b5ULL, 0xc30c1fca5a3d56d9ULL}}},
+    {{{0x904f55bad3d2db0cULL, 0x75d5d45bebed1946ULL, 0xa81fd43549ec8a70ULL, 0x76de6d6dcb542596ULL}},
+     {{0x0cd6a3c51d92d12dULL, 0xd519098590857479ULL, 0x0833474770e9da52ULL, 0x455532946f313727ULL}}},
+    {{{0xabb4d057d32372f5ULL, 0xbccbf207c66fc362ULL, 0xfa225454d22b8bdaULL, 0xc5bed0b1bd10e5faULL}},
+     {{0x344661959e019fa5ULL, 0x99b4c335a2410570ULL, 0x9871f55682e5cfaeULL, 0x709787fa317b6c77ULL}}}
+  },
+  {
+    {{{0x6a2b78be3fc324dbULL, 0x9d377a78dac2d710ULL, 0x908dedcf5efaae56ULL, 0x9cd776401534c77bULL}},
+     {{0xd845d8ec8a4c8584ULL, 0x695b30ede5e037c7ULL, 0x7d7417a56e5ec261ULL, 0x88b65e74bbd7af79ULL}}},
+    {{{0xf370d0f8f311eab2ULL, 0x4e2171efb4b478baULL, 0x92a5501297f4676dULL, 0x8e9f432c62283596ULL}},
+     {{0xe748507cc0eecf2dULL, 0x0451ee904ac9bd2fULL, 0x6de76959d2b008e1ULL, 0x06cd2fb15fd2d4acULL}}},
+    {{{0x3b98be6d6d417987ULL, 0x303fde76a66fc1fdULL, 0xc02b9611403ce43dULL, 0x2dadde0ee653a9b3ULL}},
+     {{0x3417f11681ddd4a0ULL, 0xfd65fd32895e60cfULL, 0x549923331a95cdd9ULL, 0xbb04ec72fef085d1ULL}}},
+    {{{0xdcb05ef9741298a2ULL, 0xd42d3275fa152fa8ULL, 0x59410776a3c3b8a5ULL, 0x649e737d1e5cfb7aULL}},
+     {{0x6b417b90265723e5ULL, 0x37c356ee3194db69ULL, 0xfdd180a02b5ad036ULL, 0xb4fdcb273f112e79ULL}}},
+    {{{0xa9c89cadde9786c5ULL, 0xa472a6fe6c0468f7ULL, 0x8573d6f95b98c6ebULL, 0x3a40a556a524fa39ULL}},
+     {{0x5af5784eb315f83dULL, 0x4b511e7e5e671216ULL, 0xeb8761d9f66f4d94ULL, 0x20296aadf361d75eULL}}},
+    {{{0xbc1c01fa3afe2c2fULL, 0xae28979337148bfaULL, 0xc7c90360200dfbefULL, 0xe022bec66fbeafe4ULL}},
+     {{0x2a19aed8d6195c6eULL, 0x3820947b31aaab6eULL, 0xfbe4a77ec2073391ULL, 0x9d73228b9f3ed4afULL}}},
+    {{{0x82b9c55b09abe93cULL, 0x67693e4cdcc38711ULL, 0xe7a3952f097351ddULL, 0x095f269458da24ddULL}},
+     {{0x2a96d60a7f14ed11ULL, 0x0ab7e3d4a1058eb4ULL, 0x66132a3f37de4998ULL, 0xb4185657a63701bbULL}}},
+    {{{0x4abaf2c3292ac18cULL, 0xc5b569517aa033a8ULL, 0xfa32f9761af5598aULL, 0x9f7531645ea6b658ULL}},
+     {{0xbca80adb6ece6ae0ULL, 0x622f743ac748dfe6ULL, 0x39b182e4841ce734ULL, 0xbec7eb7d60395684ULL}}},
+    {{{0x8badd3bfd4042a42ULL, 0x28cc941b33551179ULL, 0x56374394a44cf9f9ULL, 0x41892adad49783c5ULL}},
+     {{0x2b88e7165f81fed3ULL, 0x7d27ca2683815feeULL, 0x78feb57d366ba168ULL, 0xbe09bbf52205b6cbULL}}},
+    {{{0xaa81b370919aa45bULL, 0x61d2f1ab0e245cafULL, 0x51923b9be4bd0191ULL, 0x8705e006b9a9fc8fULL}},
+     {{0x4267a6ec6687d613ULL, 0xb31b9467dccd2a71ULL, 0x82a3ad8f2da98138ULL, 0x44254681e0368405ULL}}},
+    {{{0xe9021faf35881623ULL, 0xa9570014c235ce72ULL, 0xfa31fbd6d2980631ULL, 0xeab83b0173de31d6ULL}},
+     {{0x7e108ab7835115d8ULL, 0x31441aa425407590ULL, 0xebbefea4c5a08b98ULL, 0xcf09fa4cd5ea70b7ULL}}},
+    {{{0xca6984e70ef49b94ULL, 0xa7be1122d2533839ULL, 0x967511260d4fc949ULL, 0x60154b030c5f7767ULL}},
+     {{0xb2e03cfa97b31981ULL, 0x8eb5d8cc22923568ULL, 0xb9de7bb715c2a001ULL, 0xda5ec7c2c0182cb1ULL}}},
+    {{{0x1da9b6cfe1e1ece7ULL, 0x47d67dc2a384219eULL, 0xa52f9d23f6fe4478ULL, 0xa97bf0849cdcb99eULL}},
+     {{0x960b1f83aa419748ULL, 0x810a9641edd45be1ULL, 0x9553490f18255580ULL, 0x44bc1dbcd2a33683ULL}}},
+    {{{0x445232aadfd15a0cULL, 0x5bbc553185f5e6f5ULL, 0xedc4909d5be855c4ULL, 0x0669e3b0a33e4de2ULL}},
+     {{0x6bab5e879fc1c209ULL, 0xe5f0a7fe8caa736aULL, 0x74c4e87d8d8dee06ULL, 0xd8aa5aeaf253a86fULL}}},
+    {{{0xfe6165a65b68e850ULL, 0xe909295e6a70efe4ULL, 0x889d38ccb6f7575aULL, 0xc452672044c606beULL}},
+     {{0x2145bc1d56ee1dc3ULL, 0x5c666e1df90fcc35ULL, 0x44fa7caf90f916ceULL, 0xb007738b1b80be3dULL}}},
+    {{{0x256fe50827d7183dULL, 0x0e99199894fc2a48ULL, 0xa528256c1a9d51a6ULL, 0x004dd7195c572a17ULL}},
+     {{0x79e2eac1c9e31ffcULL, 0x3b7dfef6632683dbULL, 0xf7c3563bc531cbb7ULL, 0xf1068268d6f5458bULL}}}
+  },
+  {
+    {{{0xb10194f96ad11cecULL, 0x57a55bc3665576f5ULL, 0xd653a1062e87c666ULL, 0xfd3269711b167d05ULL}},
+     {{0x8532debb9ebba164ULL, 0xc6dc490d4e39f307ULL, 0x23aa90a5a8dc5585ULL, 0x7370286ab310b505ULL}}},
+    {{{0x9ec0ad4bac95eb33ULL, 0x0c7f07a05f04eaffULL, 0x7879763fb798cd33ULL, 0x6f9100a2cd8336b1ULL}},
+     {{0xd512b8d590077af6ULL, 0x4333f32575e97fb3ULL, 0xa421e8fb36903c0eULL, 0x4931634bc992d6c2ULL}}},
+    {{{0x021b781ceee7707aULL, 0x09b91be573a07164ULL, 0x23e351ada21e14c6ULL, 0x12b9582f0267e795ULL}},
+     {{0xc8ab0681f32b117fULL, 0x008e7571c48c6267ULL, 0x224328e8e5199079ULL, 0xe753e9015a3796dbULL}}},
+    {{{0xdc588642e43c0cd6ULL, 0x23698c174bb6f983ULL, 0x7db8d3f110264abaULL, 0x2c3bd3378baeb9b7ULL}},
+     {{0x377575b6bfb80e96ULL, 0xb4774d5d91274479ULL, 0x2650454efc85fe47ULL, 0x31ff95d9cf1c6e59ULL}}},
+    {{{0x99019529972a6568ULL, 0x2cadfb67d96a049cULL, 0xe66bba8819a13aa3ULL, 0x62e8194ab0516665ULL}},
+     {{0x0184cc799477356cULL, 0x6c808ddf8c8d15e1ULL, 0x9f0d875ce73ca5ceULL, 0x4afbbf1fdf567f17ULL}}},
+    {{{0x6efc95c8e88fef53ULL, 0x5af731c40d6815ebULL, 0xa17d4af6c6376c14ULL, 0x1276dc7d19cfc6deULL}},
+     {{0x1d3a93bf9f47384bULL, 0x3e5f2560ca56bd88ULL, 0xc4939bd03c0a5360ULL, 0x3d2cb77f914502eeULL}}},
+    {{{0xfa33f5882d967808ULL, 0x8e921ccc721e69d3ULL, 0xd00c857f4f6ad3f7ULL, 0x23c5e941850a7731ULL}},
+     {{0xb6080ea0c8561319ULL, 0xac4065ebeced0bd0ULL, 0xeb4273ab8c2c4028ULL, 0xc2e13d0d7cf1b94dULL}}},
+    {{{0xda5e66f8af27abe9ULL, 0x89c83d03ac730fc0ULL, 0x5c698079595f1b09ULL, 0xec3884d3c72846c6ULL}},
+     {{0xb3ea4f31ae4fe6adULL, 0x90a2d57fc5ef0805ULL, 0x5f3d17030cfb35f7ULL, 0x9f296d9dc1e1eb4cULL}}},
+    {{{0x9fb6d044a470a34eULL, 0xbc60ea95d39b2395ULL, 0xd530989b922e4f26ULL, 0x5cf6c28275520435ULL}},
+     {{0x7f3009acd58e7299ULL, 0x69c0069dfab94f14ULL, 0x848dcde91970e179ULL, 0x1eeb0121cb6722d3ULL}}},
+    {{{0xd70f38ceab92e250ULL, 0xd02c26597e915d78ULL, 0x4e8a973c78eee4fbULL, 0x75482c5f7847ff0eULL}},
+     {{0x3bb188f6a2878fa1ULL, 0x00393f2b64d7e001ULL, 0xd7955bbe12961adeULL, 0x633017af269a13a2ULL}}},
+    {{{0xb7a5ee470fd98ad1ULL, 0xabadf6ac07359edeULL, 0xf28c8f85b102983eULL, 0xaba8ec601c8e2b4cULL}},
+     {{0xe85630ba3e47443fULL, 0x12e922d3bb0cc4d7ULL, 0x47c8a065f3ddca36ULL, 0x1355b0786aa0bf08ULL}}},
+    {{{0x3f84fb25d3e225d3ULL, 0xd02ec25971c7f7fbULL, 0x082b1fb366456dcfULL, 0xbc762448391e1a6dULL}},
+     {{0x56d1f9a132aeba39ULL, 0xd0896e1249e61750ULL, 0xda49ada2e0f1ba2cULL, 0x3321e12931d00311ULL}}},
+    {{{0x4c93fb99e09e7ff1ULL, 0x7bfa50183780492aULL, 0x13f3d070aaec852dULL, 0xe2199d16294934cfULL}},
+     {{0x87a9ffb99ea29c0dULL, 0x10bd8590a0ad0213ULL, 0x3ba4fed01f0842cbULL, 0x3ff2160f26a74618ULL}}},
+    {{{0x3bd8760f1629db97ULL, 0x074997acf00e2121ULL, 0xd5bb78fcc444a0d3ULL, 0x92aac5334d598023ULL}},
+     {{0x97a2c026ac87c9baULL, 0x236017ec35044a03ULL, 0x8f511afb17cdb178ULL, 0x1d3ff5b580863a3bULL}}},
+    {{{0xee8ab3999c5a3496ULL, 0x5e073486ab1a54daULL, 0xa37f6668866098a3ULL, 0x4fe54e986063a7daULL}},
+     {{0xb08f65683e6c808fULL, 0x31bf1e69b3b59316ULL, 0x5b22bab22a313bb1ULL, 0x0b4b08abd29cfb24ULL}}},
+    {{{0xc40848008a7a45b7ULL, 0x1305389c43900ceaULL, 0x415e0c3cfa74377cULL, 0xd3c77f3a40981711ULL}},
+     {{0x61fa16259eabb3eeULL, 0xbdbdd6e0b09cd6caULL, 0x2197bd8a777669abULL, 0xcf8a72b412fe5d5aULL}}}
+  },
+  {
+    {{{0xd9405cb09f5b9283ULL, 0x7eb164ea403bf230ULL, 0xd9fe160ac4c81342ULL, 0x7bd1c6c5e251cb20ULL}},
+     {{0x139b845888b47419ULL, 0xb82ca88559520253ULL, 0x9eaed8a8c5fcf52cULL, 0x29bd05df6d1148b9ULL}}},
+    {{{0x367d18295ad4f3b6ULL, 0xd7f430279e810de2ULL, 0xd7c1edfa0b549695ULL, 0xb8c10d1e08d09ad5ULL}},
+     {{0xbbb49ceb65124aeeULL, 0xcbd9206ce371e17fULL, 0x9cfc55df38fd6a1eULL, 0x5e48de531aec3e40ULL}}},
+    {{{0x345a34c34e9fe78aULL, 0xe2f21fc691188d39ULL, 0x929c0d1da1a696ffULL, 0x75639bacb4f833a0ULL}},
+     {{0x27cc8dbd6c11a02dULL, 0x14db067edc148725ULL, 0x60acffff0aea12e2ULL, 0xfa77aa98cf31a50aULL}}},
+    {{{0x18fd7dbd36346f1dULL, 0x8ae0206c253d24a2ULL, 0xd29271c5f31226f9ULL, 0x7c435cf51271447cULL}},
+     {{0xa49e04085badef28ULL, 0xb73ea816e57d23f9ULL, 0x4ccefa8d5ff4c300ULL, 0x97d70bbdb7b86db2ULL}}},
+    {{{0xae89dfa32b76f35cULL, 0xec2524bda3e7c6d9ULL, 0x17d051999545dc02ULL, 0x983c17861d8dc9c2ULL}},
+     {{0xcbc677e959cde88bULL, 0x482e815220347603ULL, 0xfeef5b5ddb00970dULL, 0x7beb7989e6b5ef05ULL}}},
+    {{{0x9e2e7778c16021d2ULL, 0x38f58475ee43e6e5ULL, 0xa8136a200a5607e8ULL, 0x959f9b88dc0b1d05ULL}},
+     {{0x77af74f826c47cbeULL, 0xd2bfb6d14d297f29ULL, 0xb7843c28221ff3a8ULL, 0xce56141c1f38f334ULL}}},
+    {{{0x6c80c4601ff6fd6aULL, 0x4d76508ac9791e6dULL, 0x950a90d39152e054ULL, 0xf734cc66a98d6032ULL}},
+     {{0xe74e8a1fc8d68658ULL, 0xe6dec0e665f16e53ULL, 0xf3a61b595ac87fddULL, 0xb70049c6c8fc0e68ULL}}},
+    {{{0xff65601f0eafcb12ULL, 0x1820d479d483787aULL, 0xc9b32ef1c40db74cULL, 0x974670d05690ec3aULL}},
+     {{0x7ad847064a7640abULL, 0x50fcf606e3c924c2ULL, 0xdfd116883f991c7fULL, 0x95acdfa746497f46ULL}}},
+    {{{0x9fdffde96e3701acULL, 0x4113e22dd8b673d1ULL, 0x453e77f81c1873d7ULL, 0x75922d13ec80db50ULL}},
+     {{0xeb53e597a539d8d1ULL, 0xe43ead408de8169cULL, 0xb94a060af7e8ad2aULL, 0x194ad0793e3b0e56ULL}}},
+    {{{0xad4d2c53a0b4f0f8ULL, 0xcda4c248c5eeb2adULL, 0x1194bda824dc4ecfULL, 0x38127493d0b70269ULL}},
+     {{0x80ffd839961a6bdcULL, 0x6afc5e3069be8e0dULL, 0x7280a9d02163b1faULL, 0x43355bd94cfe3ea5ULL}}},
+    {{{0x22f32a9202339f55ULL, 0x204f29f4e3d6c34fULL, 0xf5d5846893d30e4cULL, 0xa8c347dc186aaf0bULL}},
+     {{0x00dd04d1fce9ece8ULL, 0xaf93cdfc5b637af4ULL, 0x0c8f90ca6feca392ULL, 0x3e5d9294910425bbULL}}},
+    {{{0x0138d56b01994118ULL, 0xfe0aff54206ade71ULL, 0xdba4093403dd25a7ULL, 0xcde7abce9d1960d8ULL}},
+     {{0xdbec1a110767aa4bULL, 0x2ab2c48a10122d9eULL, 0x40b223b3c8413eccULL, 0xf0d57935843b51b6ULL}}},
+    {{{0x4fd9c73449a45cd9ULL, 0xbc607aa223661465ULL, 0x830f3e46f511a229ULL, 0xab9ca689d8932c46ULL}},
+     {{0x4055c145efe0ce8dULL, 0x8d96f6b3209f6b75ULL, 0x81467ca28bfd7250ULL, 0x141ed4666dbd4f62ULL}}},
+    {{{0x3c2079bb5523d4c8ULL, 0xe662c315fe74e36dULL, 0x2762a31890ac714bULL, 0xf4559d0b59c9718cULL}},
+     {{0x9162addbe51e8423ULL, 0x7183440d80a72c37ULL, 0x97e216dd2373725eULL, 0x24a3593576466b7eULL}}},
+    {{{0x30caee2e3dea9446ULL, 0xa40cbb23035de618ULL, 0xf13fdd947b4f60a0ULL, 0x601f3e0c75b5c295ULL}},
+     {{0x9a01de5757797aa4ULL, 0xec21ce4b18dd450dULL, 0x08bcb51933f6123dULL, 0xd2f400401b6e497aULL}}},
+    {{{0x0fe20aec17f3f58bULL, 0xb42f5c80f1dfb965ULL, 0x687615792e901a7dULL, 0xec159a4eca69a318ULL}},
+     {{0x43303eed94bcd0f7ULL, 0xaa328510c393a895ULL, 0x5c1da10d3b150db6ULL, 0xbb7ef75ba5b3a000ULL}}}
+  },
+  {
+    {{{0x36f2fafd0ad1e78cULL, 0xd483ddb24300fb1dULL, 0xd1c74e3ed7a1f2a0ULL, 0x20cd9334b88d061cULL}},
+     {{0xabbdee0515574c09ULL, 0x80edefe963f6940cULL, 0xcb1eac33e85d8ecdULL, 0xf81e5bc476e497c6ULL}}},
+    {{{0xba6fe0d3398861cdULL, 0xa4cb86caa28727d5ULL, 0x01f01774e2cf7eb3ULL, 0xd09e5bc71950c078ULL}},
+     {{0x8ba277c5e0384809ULL, 0xa3ced8758ac614abULL, 0xcc9805e22d7e43dbULL, 0x5d9ca4e67fe203fbULL}}},
+    {{{0xa9887d80cde413b1ULL, 0x1baba0b46e21d4b6ULL, 0x6a3c9dc6163df9a8ULL, 0x2e34eeaa4f16c96dULL}},
+     {{0xf9d1342e6cdad3a0ULL, 0x008ccd25b16b2e7fULL, 0x8a2bdedfb10453c3ULL, 0x9e31600968c27ddcULL}}},
+    {{{0x94478521628fefb8ULL, 0x59c58caa49be34eaULL, 0x5753a1c5b195d10aULL, 0xbcf7467c9d7c6f7cULL}},
+     {{0xe3ec92a6c894bf9dULL, 0x5462a5aba6062ce9ULL, 0x7cceb43f30e1180cULL, 0x785c7f0f1a2a7641ULL}}},
+    {{{0xa1561f3c15b2a0dcULL, 0xb987dd0d45e1dd2fULL, 0x7ed3a49142fd8317ULL, 0x237f0c9363a8104cULL}},
+     {{0x9d11e1103dd99b06ULL, 0x165469ec75c89e0bULL, 0xea939922ce145071ULL, 0xc968bfd6d46a532dULL}}},
+    {{{0x7af2525abbad427dULL, 0x1a22e868dd41734dULL, 0xd02faecc591ba358ULL, 0x1d3d2e84b3c5e267ULL}},
+     {{0xad72b643d303071aULL, 0xdd44edff412fccf4ULL, 0xf4f626d434bd63c2ULL, 0x141bf7604781d7eeULL}}},
+    {{{0x70d02261756094aeULL, 0x6c3b7ab1e0a693deULL, 0xcdb669bb2b84f4f1ULL, 0xe26c8129f267ac71ULL}},
+     {{0x20ab8f5865aa3e5fULL, 0x4708a1e42bba228eULL, 0xb7556f3e1d9d891cULL, 0xf63fc48f2ab24f3aULL}}},
+    {{{0xdfaefb1b40117e20ULL, 0xf5af2bee3159a196ULL, 0xe1214d45507a9759ULL, 0xd7e672c0d268a008ULL}},
+     {{0x0168c98f1ce4065cULL, 0x7c4ff55be09266d0ULL, 0x33d0abee260526f5ULL, 0xddfd666d53b6bc87ULL}}},
+    {{{0x5680703a591dc856ULL, 0x2b5bf421ad98b331ULL, 0xa956b25be9b3b73fULL, 0x75c3c531a57d6970ULL}},
+     {{0x103e17ef98a88cb4ULL, 0x0ac16d1e4b295b71ULL, 0xd917b5d8d74a2a47ULL, 0x446dcfade9852049ULL}}},
+    {{{0x238db0ff82316612ULL, 0x1479a3c5926ef02dULL, 0x44877135b2e613a0ULL, 0xb59cce79eebf0bbfULL}},
+     {{0x966846701b7b7bd8ULL, 0xa2b063fbfd4da941ULL, 0x751c27d5978cadb2ULL, 0x8df6f12f8bc4e89eULL}}},
+    {{{0x6a7a7d3189ebc88dULL, 0x56c7cb507123d2c9ULL, 0xfcef3ab0d6418e61ULL, 0x75206343cfa24b83ULL}},
+     {{0xd0f131aaaeec3e4cULL, 0x6e111bdb6746d508ULL, 0xee59517c40e001ceULL, 0x74380beabab1fedeULL}}},
+    {{{0x785b2dd0e0004fbdULL, 0x0d1705beade2dfb6ULL, 0x0e0f5f5849150a0aULL, 0xad061b20248415ceULL}},
+     {{0x47cf4a78fb414b00ULL, 0xe259e0ebbdcf1d74ULL, 0xa7f9721f2f245f85ULL, 0xa9a128a9a1f7b1b6ULL}}},
+    {{{0xbb2ca1a9a93aadedULL, 0x2100da05cf4ba347ULL, 0xc93b628b46a6f448ULL, 0x5a7165196ea917dbULL}},
+     {{0x7447e178cc95b575ULL, 0xf25a712eaf3b35bfULL, 0x16e4a89d592eeffeULL, 0x0a2a0086f495566bULL}}},
+    {{{0x7c79f3d89cd3f65eULL, 0x5032ead458d61e0cULL, 0xe08d4b3d5e2b70efULL, 0x7f2a856f6a67cc5bULL}},
+     {{0x787084f09ce43bb3ULL, 0xb9e6cffbda2e14e3ULL, 0xf25bbd0132ca6adcULL, 0x5682d387a59b250aULL}}},
+    {{{0x7973e3821d15f1c3ULL, 0x81af75e9a838e912ULL, 0x4a2f179ab9f26fa7ULL, 0xa188042800dbf7f0ULL}},
+     {{0xf9a7b6f98c5c8055ULL, 0xd52925146192bc92ULL, 0xf3ec108defb18d24ULL, 0x89e690e4f6f96636ULL}}},
+    {{{0xedbd7c8778ff2733ULL, 0x08e03f2cc2b09306ULL, 0x4371874e6eee759cULL, 0xea3672f07b18c38fULL}},
+     {{0xc90bba9eacfabb76ULL, 0x4e330552145748ecULL, 0xa5a96b22e71bc1b9ULL, 0x0ef1e91b61dd1006ULL}}}
+  },
+  {
+    {{{0x70d40ba48a7f0b8bULL, 0x1555e8b44a8e0b7dULL, 0x1100f529040649f6ULL, 0xb2f583c90de6b5dfULL}},
+     {{0x31b41a274b1df62cULL, 0x58c17b4cf14d2e2eULL, 0x01c77d4786301c96ULL, 0x08f00da3252279c9ULL}}},
+    {{{0x36e02b24308a2dafULL, 0xdf6caea74046415bULL, 0x43eb2755b1e1f220ULL, 0xe2acc5c727ee341eULL}},
+     {{0xd90fd737e35b012bULL, 0xf2aab37e2969bb32ULL, 0xbd8d4734d141f11aULL, 0x0a37dd238f63b6fbULL}}},
+    {{{0x7eea64d7f6636ce8ULL, 0xad5a156c9fa4cc8dULL, 0x4d3a49fd3bef6301ULL, 0xa5afcffecdaab1c5ULL}},
+     {{0x5765647c7924999cULL, 0xea2f27aead09528bULL, 0x7e69c3c784cc3a47ULL, 0x26c1a0b4ded8a932ULL}}},
+    {{{0x806163701ee8591dULL, 0x36b584e72c08bea0ULL, 0xa29772cf1b996bb5ULL, 0xa6c88fbe130e771aULL}},
+     {{0x26e77860cba5c690ULL, 0x93322d817b19f602ULL, 0x25f41f5f532286e3ULL, 0x9a774eeb4e0ce53dULL}}},
+    {{{0xcfe2f80a284482fbULL, 0x00d75d7f0d36623bULL, 0x6d1cc179cfe59167ULL, 0x78ff868c7a58b27cULL}},
+     {{0x41c3208f76bd185fULL, 0x99bcda6f81b01133ULL, 0xed77fdbdaa79d6daULL, 0x255ab67ed8c195c4ULL}}},
+    {{{0xbf53e8c8e037e271ULL, 0x8e5f2a10a4034fd6ULL, 0x2d1aa598f7a6f93eULL, 0x8fd83bb674c9f333ULL}},
+     {{0xd8ab7210a6c5d43cULL, 0x80f3cd6a8f514c4aULL, 0x765c23bb8b096dc7ULL, 0x9610c3b6b9bf2dfaULL}}},
+    {{{0x80731315ad487275ULL, 0x16e4227e8aaa556eULL, 0x1c9d03dc4552e2d5ULL, 0x3ea598ed8a0b7fb9ULL}},
+     {{0xa0a2b7eeabbd60caULL, 0xc242a085403e8952ULL, 0xcf7517e8b0494710ULL, 0x8d0c4043a66638a5ULL}}},
+    {{{0x1a598528c9115b2aULL, 0xe11fe876e51e7e43ULL, 0xbdc9eafb59be195bULL, 0xfb595a198fc98987ULL}},
+     {{0xbd3fe118e27afc8dULL, 0x8119e64de137539dULL, 0xbd9f707d41e25ca9ULL, 0x6c875d9827393289ULL}}},
+    {{{0x044b0bfcf9cc2060ULL, 0x7f2fd1ebb14d2d3bULL, 0xc23d8b5b58547adaULL, 0x956248159c51ff8dULL}},
+     {{0x57aba0a5313923d8ULL, 0x604773bc5f27cbdcULL, 0x5a4e9be4f98f9b18ULL, 0x0e2485771ae85103ULL}}},
+    {{{0x21f03b45179be78dULL, 0x574fbca0853b2883ULL, 0x52e1d9cd5120bb27ULL, 0x9593dce00b94fe03ULL}},
+     {{0x76a1cb6a1f2696a2ULL, 0x16d8d6b82290eecfULL, 0x1bc1edac7fbbd342ULL, 0x1ae095dce29ae785ULL}}},
+    {{{0xc13fbd761b9c8392ULL, 0xf69132fcdcac7f93ULL, 0x454f5da15783bb59ULL, 0x5cdc9c3479a889efULL}},
+     {{0xec18dc676bb5a08bULL, 0x8e559641ad48c1acULL, 0xefbec32a7bc57c8cULL, 0x18680d0020e04264ULL}}},
+    {{{0x940bb83a748d4a5fULL, 0x4729f0508e3e8f16ULL, 0x82dcb3a597db1cd1ULL, 0x90d6c81e7fbe5935ULL}},
+     {{0x61fad3544a6ad819ULL, 0x0d059bc25b46d32aULL, 0x5e2d00b22178b822ULL, 0x4bce4401586c6ac5ULL}}},
+    {{{0x1e4ee02f896fc74bULL, 0xfe467ea8b12d009eULL, 0xdc96488ab9b208b6ULL, 0x1dd02324ec17f4ccULL}},
+     {{0x213edb1c04446ba5ULL, 0xf6bb3884c78db3e4ULL, 0xecf961a3d7af3eaeULL, 0x00dc4e066f4b9459ULL}}},
+    {{{0xeec8a9313de02e3cULL, 0xe6f1cca76605e1e3ULL, 0x515e68263bfb1ba6ULL, 0x9aa4d653902c53ffULL}},
+     {{0x162d9d433e7a47daULL, 0xbff555000d2404a3ULL, 0xfbf0d522fbf722cdULL, 0xa85b9ccddf236045ULL}}},
+    {{{0xd1e4dbf990aa4225ULL, 0xd9e213193a0bc88fULL, 0x6541579fb88a3567ULL, 0x5fb761becbfbf90eULL}},
+     {{0xdae581b0bfd1dbb3ULL, 0x9a20cbdae76ed998ULL, 0x8225470bdbdfd953ULL, 0x270dec79ef5eb1abULL}}},
+    {{{0x8363e82815cf1739ULL, 0x3f1b3dcdaa0a9a1dULL, 0x897bbf89405418f0ULL, 0x2a13a451013bb8b6ULL}},
+     {{0x0492ee88e4241faeULL, 0x2888a7e82ca3d30cULL, 0xaf1ca7d726833095ULL, 0xbfce6b6e67ce8c15ULL}}}
+  },
+  {
+    {{{0x09a7084156bcea80ULL, 0x6fe3f7578a189c2eULL, 0xa4b4d8deffaf3679ULL, 0xf6405222c595ff14ULL}},
+     {{0x461c257fa78a49c1ULL, 0x8902b5721ed7013bULL, 0x9ba1c28645084206ULL, 0xf27bde3ff0fb1b1cULL}}},
+    {{{0x57b01da14030d138ULL, 0xb13af6f9007b59cfULL, 0x92c4d6a2e9266140ULL, 0x612b5de9d3d6cbc3ULL}},
+     {{0x40997aefa326144aULL, 0x354235d29c20d373ULL, 0xfeed422074710993ULL, 0x42fdd2c97bdb9976ULL}}},
+    {{{0x3cbe30c04ba4a460ULL, 0xa3d62b0f304cf52cULL, 0xba2e4b452560c1f6ULL, 0x60ce8759a1d18924ULL}},
+     {{0xd023a604091a69edULL, 0x49e6c5e2326bc4a4ULL, 0x128dcb59dca2b06aULL, 0xff01a5ffa633f7e8ULL}}},
+    {{{0xefd8ef9a1a43df33ULL, 0x9d38130e6e874f15ULL, 0x20b904058316c94cULL, 0xafcacef827237fb3ULL}},
+     {{0x857cac0fd3427262ULL, 0xf1f69d67caff65e2ULL, 0x47c534becea8400cULL, 0xd196203093bb5957ULL}}},
+    {{{0x9c9737d97747f183ULL, 0xfb0dc255724d2fefULL, 0xc52815614e4bd70aULL, 0x86af30f3c488c9c4ULL}},
+     {{0x376e0f61569ba8e4ULL, 0xb9ebaba6a91cee58ULL, 0xe96be1ca42911d2eULL, 0xdd1c6dfc3855f2d7ULL}}},
+    {{{0xa55bc4096b9506a4ULL, 0x5bcec1ce929ef25bULL, 0x199765111b8d45f8ULL, 0x5427e297943c3030ULL}},
+     {{0xa162db6b1509f7ebULL, 0x26a899843bf0cc54ULL, 0xec28d8f2f8dcecb3ULL, 0x80a3898eac39784fULL}}},
+    {{{0xb67e8c3c227c125dULL, 0xe8b10100fb36287eULL, 0xd078be9a68dcf51fULL, 0xd7fcd9eb639c9c92ULL}},
+     {{0x1d5eddc83ec36a21ULL, 0x4b1c99cedc90dcc5ULL, 0x2621ef88dd0fabc3ULL, 0x14072b9a45a9026bULL}}},
+    {{{0x7df7e8562d39d12fULL, 0xd02cfa54c100ac72ULL, 0x3b2794c5df635993ULL, 0x0a7c0a658fe7c2caULL}},
+     {{0x39fc8c6552c757a8ULL, 0xc115ea525f2180a0ULL, 0xdfd8fb0ebb6c7004ULL, 0xa5d20a19348345d1ULL}}},
+    {{{0x5e88ea33baf842dcULL, 0xdcb24b0a7d52f882ULL, 0xe47217a87dab1560ULL, 0xbb286d445e016058ULL}},
+     {{0x18f5972d1ab30578ULL, 0xb9374a304d675c73ULL, 0x310e35aaf8f35271ULL, 0x7f816cd074d21da4ULL}}},
+    {{{0x0bb2e081807872f5ULL, 0xef47da2d990ad187ULL, 0x3eba29e7313ab482ULL, 0x2b0b76608adde02cULL}},
+     {{0x70d8f6ea49e3097bULL, 0xd231234a6b0279a3ULL, 0xd80083ccdc78df76ULL, 0x119b0fa456eac0f9ULL}}},
+    {{{0x7fc7054a05a850f3ULL, 0x8852e57a6be46177ULL, 0x3add4d3e8ae83870ULL, 0x0e369e339a762660ULL}},
+     {{0x473c44c3b83fbd5cULL, 0xbe684ad12608b6ecULL, 0xfe959267ac7c59a9ULL, 0x9f220265e6e219b2ULL}}},
+    {{{0xebaf3ea90ecc59eeULL, 0xf8d4604edda39060ULL, 0x8dacce2034e4acdeULL, 0x054a4c9c4907f461ULL}},
+     {{0x03d5d1e57f83e51bULL, 0x0d061737c91a8841ULL, 0x7df2c54d4b2e762cULL, 0xf2f9e5389d1d0784ULL}}},
+    {{{0xbfbab8816f611e5fULL, 0xd95c9523c283eb0dULL, 0xed8def3b5e04a31aULL, 0x3b8f4dec7575b82eULL}},
+     {{0x1b993b216c0db670ULL, 0x09df3b5c6a4ce8f9ULL, 0x511ddc118ab0f9a4ULL, 0x3f95106f30b4185dULL}}},
+    {{{0xd93d30d322041f52ULL, 0x95cc237e4c2e3ce2ULL, 0x678b4cf1de30867dULL, 0xdf238d33ef127857ULL}},
+     {{0x8306d6816b81d991ULL, 0xf23c2241486c4789ULL, 0xf385c2fafa84e4beULL, 0x005569c23b7f53deULL}}},
+    {{{0xbf47ec2d685a81eaULL, 0x9e7d6e7657159696ULL, 0xd8f9afcae5d085e6ULL, 0xbfbec5f10e6b193fULL}},
+     {{0xdffbbfdc854c5b93ULL, 0x59883920f3d2d606ULL, 0x76ba218b6e230522ULL, 0x561df4dd5506eaaeULL}}},
+    {{{0x1773ec0c87dd3565ULL, 0x8df43aa17f5cfb11ULL, 0x2ce2906ce26b5b82ULL, 0x56eb3ddcf3ac4714ULL}},
+     {{0x4aefcce9bc694362ULL, 0x9812ad04318246c9ULL, 0x071f4c1eb5c0b281ULL, 0xb475e4d92a9b71bbULL}}}
+  },
+  {
+    {{{0x4bab762f1e61f2deULL, 0xb2e6b4ac870c3a9eULL, 0xeeacce085386a75bULL, 0x198f7e7d006d4ee7ULL}},
+     {{0x9cb7317a833ad442ULL, 0x0ec7c900da6089feULL, 0x8f49c09e9feabfd3ULL, 0xb3b197393048d496ULL}}},
+    {{{0xd7e3ff3b3f2f515fULL, 0xcdbe5575d215c688ULL, 0xd3bcc7ea486bee91ULL, 0xe3b8a217a2db4916ULL}},
+     {{0xa8b9526f88a4f9d0ULL, 0x4165916426d16dbeULL, 0x7d8db9c8e6185a2aULL, 0xc964e2bc3807ccfbULL}}},
+    {{{0x67c6b324c35330e8ULL, 0x3887a69d84775854ULL, 0x1d6f331e71cbc6bcULL, 0x6425f8c3de9a407cULL}},
+     {{0x4b5464143a674341ULL, 0x4737ab3fb57e2e81ULL, 0xd9125e89b0fb661dULL, 0xf6d8e0a9c1c62c75ULL}}},
+    {{{0x63c80c12b4413a54ULL, 0x22de1ff04c5b6eb5ULL, 0x017419142db2f95cULL, 0xefce2200900dd0e0ULL}},
+     {{0x3de053f54f812a4eULL, 0x29ee6a72ba4a5b57ULL, 0x7de969ce86dcf558ULL, 0xeec6737dbbc78d66ULL}}},
+    {{{0xe9e8bd82ea2887a0ULL, 0x227ebd6a18e7ec3dULL, 0xa929564330ff207aULL, 0x97bfde09587f064aULL}},
+     {{0x4eb152e03cd76fceULL, 0xff423031e7d44f0bULL, 0xa8acaa45dcda342cULL, 0x6f4fd22ea5e2e228ULL}}},
+    {{{0x186d0fba31245c7aULL, 0x03c04633d95b367bULL, 0x7b58007b07d1dc0fULL, 0x02028f98d56579aaULL}},
+     {{0x57f667ed292b6b60ULL, 0xa4a5bd691eb585afULL, 0xf7f8fd307b3d55a2ULL, 0x0dbd60ab8873b908ULL}}},
+    {{{0x1fe58ce048feae4fULL, 0x407e57233b0ed7f5ULL, 0x8af61c6e6c9102cdULL, 0x5d1b224773c1dbb8ULL}},
+     {{0xcc392a4e2603b249ULL, 0x22586e4283b3e157ULL, 0xf9c6bb662b7ceb3cULL, 0x5e08021dbc02f703ULL}}},
+    {{{0xe06491ef3bb59704ULL, 0x1f5b12e32a203ccfULL, 0x62d6a996672e37e6ULL, 0x94c3e29c59679c3bULL}},
+     {{0xdbc1983bbd53f36eULL, 0x56647a5d1f008132ULL, 0xc7e584770b9c0519ULL, 0x6fbe119ad02a2195ULL}}},
+    {{{0xaccf77f458f6b887ULL, 0x7799146be18f200dULL, 0x4b9a1b4c263ac115ULL, 0x4d0b2c4fb7c77bd6ULL}},
+     {{0xfd8e750235056b01ULL, 0x3c898a0e83eabb58ULL, 0x3378dc3a6e4e72baULL, 0x0b17087968a2f516ULL}}},
+    {{{0x2ead903c0f8de6d5ULL, 0x68d440cc2cca1467ULL, 0x8edda181556fcfecULL, 0x85aafdd32a11f70eULL}},
+     {{0x4d8a9da7b8ebbdabULL, 0xe19c41fd11883cb9ULL, 0xd4c7a045dc190a2fULL, 0xd9d7a6b41fd7c40bULL}}},
+    {{{0xa74f2e4f5feae48dULL, 0x80fd8b322a470c18ULL, 0x1867c07e1756dfb9ULL, 0x8867ed7db2b6d13aULL}},
+     {{0x27fb11e22a4863fbULL, 0xec87f9ffd6ee84a4ULL, 0xece53996390ad1b2ULL, 0xdf2b63f2abff6f9aULL}}},
+    {{{0x16508f90d8a0368eULL, 0x0c97efaf2fa7f859ULL, 0xfedd99101c50aefbULL, 0x644c49beb26240aeULL}},
+     {{0x99f52c88fe8ce562ULL, 0xabc0020c88c8104bULL, 0x1902fb48737b5603ULL, 0x966025bc61415af4ULL}}},
+    {{{0x46b50f7316661991ULL, 0x375806448732cb27ULL, 0x3f3b2e830bac294bULL, 0x8cf2b74d3eff5bffULL}},
+     {{0xba204246403e8fa4ULL, 0x7d6e15ae3a164674ULL, 0x25b93ee8e55f3607ULL, 0x4e158e2c690cc1c5ULL}}},
+    {{{0x8fda0c50106aa247ULL, 0x8ca857c1a7f5d55fULL, 0xaf6162cc485a6904ULL, 0x6f6d3e26dbad9009ULL}},
+     {{0xcb003c6951810316ULL, 0xc0e278a8a3dafc95ULL, 0x292052b476ecdfb7ULL, 0x4cab6a6e41b0a25bULL}}},
+    {{{0x9fae7b2f5107cf66ULL, 0x1711901e078f7c2bULL, 0xb54d67399b8c2373ULL, 0x7682994aba1b0103ULL}},
+     {{0xdeceef75daeefe50ULL, 0x48cfe6696c60faa8ULL, 0x37a541e958f0632bULL, 0x6f3c94fde71f9c8aULL}}},
+    {{{0x3a673d8e18fd18cdULL, 0xcf4540e2a94a9398ULL, 0x448389ec99d5f485ULL, 0x3b555bbabddcf477ULL}},
+     {{0x2d0e9d19a88ce721ULL, 0x44f4cbeb55b222ebULL, 0xc4e02ecaa9280ea9ULL, 0x6097f8a7e2efac57ULL}}}
+  },
+  {
+    {{{0xde46b004ef0be552ULL, 0xb5b58678b4fff55aULL, 0x4fdc10033530db5dULL, 0x206f0f69bdd8f739ULL}},
+     {{0x7bd555ed8295f035ULL, 0xb01a0aa9239fcd7fULL, 0xa7fd31dc6173ecb1ULL, 0xa9713967f7153dd9ULL}}},
+    {{{0x535934ca321f0315ULL, 0x6456778653082ea0ULL, 0x1e977eec2c748283ULL, 0xd98eeb9b8f8204c7ULL}},
+     {{0x906983a9b9bf1f64ULL, 0xc16499c0e52c6c3eULL, 0x9092127d5c2499ceULL, 0x7bdcc0e372c1fb4bULL}}},
+    {{{0x6e18ea883c38b242ULL, 0xbef6e881f3ec99c4ULL, 0x2a8db65d8a6354dbULL, 0x44b67c6e1df54e8bULL}},
+     {{0xdb24aed77be52da4ULL, 0x2d5777716a04abfcULL, 0x14459bc9dd098a55ULL, 0x2bf956761442f2adULL}}},
+    {{{0x7312fd0770270475ULL, 0x5259f9193c4d8565ULL, 0x3812136fb2a1aefcULL, 0x5584bc3c8edafac4ULL}},
+     {{0x4ed9a8f8599d9c81ULL, 0xcebc598fca961368ULL, 0x5120363aafcd8cc1ULL, 0xedd511b803d1344eULL}}},
+    {{{0xdb7a78e82a64918cULL, 0x1618bf690c973018ULL, 0xbdc2061ccc8aac18ULL, 0x18353170b0fbc5eaULL}},
+     {{0x000a3674cb3e8b36ULL, 0x0a19b66b79162d29ULL, 0xcf8081887c76e6fcULL, 0x1c10c9517a5740b9ULL}}},
+    {{{0xec51ae11faaf53d8ULL, 0xa67aff5abc6ae8a2ULL, 0x3369306076e334e4ULL, 0x7702171897db784aULL}},
+     {{0xbe65e0aaf5132b34ULL, 0x196948bf67010320ULL, 0x45b85cc38df6877dULL, 0x30ed4b6b12c9a4d3ULL}}},
+    {{{0x1d04c1e21d50856dULL, 0x80ef9191ec804869ULL, 0xdba5963c368f565eULL, 0xc902f01865cb3523ULL}},
+     {{0x8e4811993fa4ecdeULL, 0x9d2803fca41a528cULL, 0xbe2c9bfc6b3915e5ULL, 0x984cbc3a991efdd5ULL}}},
+    {{{0x22427b66ab285507ULL, 0x4a1f0d1e33627556ULL, 0x82cad7a9088e32ffULL, 0xf6c6d2f738cacd73ULL}},
+     {{0x90f39fac69d50fe9ULL, 0x284f7a6b2912fb75ULL, 0x697c40fcce1f4798ULL, 0x73140f0fac0ad164ULL}}},
+    {{{0x06847d1dee6515a6ULL, 0x8db4f4c01e31282aULL, 0xd05a473fb2cd1e43ULL, 0x2428934434dd003bULL}},
+     {{0x55071bfe5c80cad0ULL, 0x9916831108a90d8dULL, 0x00b524ad05f6c1cfULL, 0x1797c34614fdfe28ULL}}},
+    {{{0x7fe5d5779834094aULL, 0x7032f89d046acafdULL, 0x9dd4bfc076da6b7aULL, 0xeb3f063cd57c25daULL}},
+     {{0x876f99520ee71319ULL, 0x6d79095a06063724ULL, 0xd9638efb29a35c36ULL, 0xd4e92af2256b5a59ULL}}},
+    {{{0xdcb60d8717bd0cabULL, 0x000e9e3ba4602624ULL, 0xa439512fc468c494ULL, 0x28f76b79d7209efeULL}},
+     {{0x556643669137e50fULL, 0xc653a445800b88d5ULL, 0x290fc753848e9875ULL, 0xe95c6adcd2f5c668ULL}}},
+    {{{0x1d35ce78be132052ULL, 0xe86e833bca20bdbfULL, 0x22f4471ebed319c4ULL, 0xc7844a41373001c9ULL}},
+     {{0x6de03a1b21b9a43eULL, 0xe57211b3498175fdULL, 0x0e1393301d70be8fULL, 0x9b12e0d369ebe639ULL}}},
+    {{{0xc4c6109098b2fe07ULL, 0x3b21c4bd1cf2ef23ULL, 0x3b1e7148191b29aeULL, 0x6e9037f44d65269cULL}},
+     {{0x466ce5ce90f8355bULL, 0x60fb2ff22553cdc3ULL, 0x054e6acb7f7513f8ULL, 0x6f0e95c1efcd0c49ULL}}},
+    {{{0x403c8809f40800bdULL, 0x89498bc0f598e54cULL, 0xb63e860f55ed253eULL, 0xb6d9b848ffb1fba7ULL}},
+     {{0x0456fa0d67f88ff0ULL, 0x0eed84e4538013f4ULL, 0x1a82385ef3466e99ULL, 0x1bf920d8456694b8ULL}}},
+    {{{0xb58055269fbcde76ULL, 0x6b5ad154c16a96cfULL, 0x10e921971877b8e2ULL, 0x9252fbfd5516b175ULL}},
+     {{0xbc59753cfb7d108eULL, 0xe3305a9839bdcf3cULL, 0x0e6cda17312133b6ULL, 0x5f7ae30efd33c2adULL}}},
+    {{{0x6d9614e24c18b940ULL, 0x2403025383aa8ca4ULL, 0x6e34246ea0b7c4aeULL, 0xf19fd3eec40918ecULL}},
+     {{0x5ec04b578c8c5a00ULL, 0x3f193a2eb8bccb59ULL, 0xed423ff4fd0efb6cULL, 0x37e3538337b69cb8ULL}}}
+  },
+  {
+    {{{0x88b6803abaee98d3ULL, 0x960f2ad4266f2b07ULL, 0x1da89a7d508e2a1bULL, 0xb3d7e88c63403d3cULL}},
+     {{0x1c745d36a4aeeb6bULL, 0x4ae7c50515c84b56ULL, 0xe4dd1bcacde49603ULL, 0x3734b9ac284d3f46ULL}}},
+    {{{0xf3a0c6f8114fba2dULL, 0x29b3650e8aba1be9ULL, 0xeddf858fddf30ae2ULL, 0x32a94fa71e060414ULL}},
+     {{0x60e551d76eeddef3ULL, 0xeb478c652dd5c107ULL, 0xe4f3cb292e203e36ULL, 0x6a5f5ecf156278efULL}}},
+    {{{0xadd8fd9e23331d87ULL, 0x8db79b74a7e25d02ULL, 0x31f8b9f68053c948ULL, 0xbfe043da0b0b3297ULL}},
+     {{0x590202efeed1025bULL, 0x8c7144104dc7086bULL, 0xe85434cf63bb9287ULL, 0x2c7b70d0f9a61461ULL}}},
+    {{{0x681f925389fb2b1bULL, 0xe081764dc6c1d680ULL, 0x94d86b9fefa5ac05ULL, 0x3b43c2b062a4da6eULL}},
+     {{0x59364709824c44eaULL, 0xdb2726b892b9aff9ULL, 0x9f4df66d8a749ff8ULL, 0x8a070fc5c4c085deULL}}},
+    {{{0x3196b9148e8578e5ULL, 0x142fcdce088ffa1bULL, 0x4748b0e6f7d3975dULL, 0xdaefde73e2ab5bbaULL}},
+     {{0x7ec6fbd2e41b569fULL, 0xe1b0c485266eb893ULL, 0x274212c1eb692cb7ULL, 0x6104fc5ac3c07681ULL}}},
+    {{{0x1ac968fde10da811ULL, 0x5c0a2233c60f2bc7ULL, 0x032d4e661677ee7eULL, 0xbc3a18c0286fcf86ULL}},
+     {{0x7324bf9d0c41ae13ULL, 0x6ea0dddabdf636ceULL, 0xb80fecb4bf982b84ULL, 0x490847f2005bad4fULL}}},
+    {{{0x509c718815e52cc0ULL, 0xf1cdef6ee933df21ULL, 0xff0e570b56f301e4ULL, 0x117bde72dc33d7e1ULL}},
+     {{0xdc799264cc8cef59ULL, 0x9b5d6772065c6779ULL, 0xe0923465d094da58ULL, 0x4fd06bb22c85823bULL}}},
+    {{{0xee7462370f006903ULL, 0x1a66b671a4648dc5ULL, 0xcf4f0bdf78bf9288ULL, 0x79c3f9ca3b4bcfedULL}},
+     {{0xff9f1af8ccfbdca6ULL, 0x8b824d2219e5cd2cULL, 0xa778f5429d659098ULL, 0xf471ca4d9bdac152ULL}}},
+    {{{0xa35c2bcb3950e069ULL, 0x58c0a9e6c25d35dbULL, 0xaab5345dfe4f0a5fULL, 0xff59bbaad3483b92ULL}},
+     {{0xa2c0931fa32b192aULL, 0xe3d7e12eee39f373ULL, 0xff389e3e18091a81ULL, 0x14bacebfe33b688eULL}}},
+    {{{0x69d92cc748176370ULL, 0x34a0b2714f7bb1acULL, 0x13ea47cc42911b4eULL, 0x6ed1990adea6ff33ULL}},
+     {{0x8980e9a0c4cf70aaULL, 0xc399403ab5b4f59aULL, 0x7f28bf4841abd001ULL, 0x4d11ce23add82539ULL}}},
+    {{{0x711d80e226565623ULL, 0x904589ca8fe64f59ULL, 0x7cea0836745b2dbfULL, 0x773661ee5d6bcb60ULL}},
+     {{0x52e001af5c920fdcULL, 0xc5fd84791f586f7bULL, 0x42dc73b374416924ULL, 0x5edc4b68570c6dfeULL}}},
+    {{{0xc9c865a59a7132dcULL, 0x93984f5f0252990cULL, 0x7aeddaa0137f2c45ULL, 0x6d25b1fc915d898aULL}},
+     {{0x9024851652b94d16ULL, 0x047d363b69f80329ULL, 0xbf4ec547a8913ccdULL, 0x48d194eeb92746cfULL}}},
+    {{{0xd8c6504784519e1fULL, 0x23c02b36d7755739ULL, 0x8fe5915a7d4b451bULL, 0x730dfe384bcac5b5ULL}},
+     {{0x533853e1e6c8d802ULL, 0xb6b1b91f1e26e3d8ULL, 0x9cbe59268ac802d4ULL, 0xbc4d0e521b4a7e2aULL}}},
+    {{{0x39ab61d077dbac7fULL, 0x2c92811a82660867ULL, 0xc51d832654968d5bULL, 0x6b9a64845d44178fULL}},
+     {{0xecf645bd98d6aa9dULL, 0xa6db94ebba7c80c4ULL, 0xf8ba0d2375389ac0ULL, 0x96ea1a07fb0e1ca0ULL}}},
+    {{{0xcd69cbcdc4ef9f65ULL, 0x39f5f90a50887ee8ULL, 0x68ae12dfd7288341ULL, 0x62b7583aea5b6131ULL}},
+     {{0x3117d006c7d11c52ULL, 0xe2108fe0882368fcULL, 0xea50c03ee410f1baULL, 0xb550d6790c617d15ULL}}},
+    {{{0xc292b9722d62258bULL, 0x61e7b7601ab08377ULL, 0xc96ecb4a3e3c4cf0ULL, 0xbf6d09c56d8e4733ULL}},
+     {{0x6fee1b8faf6bcc74ULL, 0x0c9492a82d93f2f6ULL, 0x612dbcb24e06e815ULL, 0x1824d0670aa25aacULL}}}
+  },
+  {
+    {{{0x82a69340c5bc73e3ULL, 0x1489234521efbc62ULL, 0x35c2d05a3d62e1edULL, 0xf826ba8ec999f207ULL}},
+     {{0xfb703cbb1dff424dULL, 0x7f8274cbe77be640ULL, 0x13fdbf688e3248f4ULL, 0x2f5754e5d0346e3bULL}}},
+    {{{0x310a7446eec288a4ULL, 0x49290d08d41ebf2bULL, 0xcffa47800d20676aULL, 0x091e98f83b963e4cULL}},
+     {{0x5d52e3746f4d63a8ULL, 0x1bfda5c9a3dc6454ULL, 0x758fce257d2a9ca7ULL, 0xd4643ba0361da223ULL}}},
+    {{{0xfe43ccf89ed80881ULL, 0x941f922b624c698cULL, 0x20cfc47bb296489aULL, 0xcb769bb76d1a075dULL}},
+     {{0x23c7f38fdb7fe87dULL, 0x1167ca8ed4a9415aULL, 0x3cb435d707505aedULL, 0xb037ebbc79247b61ULL}}},
+    {{{0xf054c902fd0506c0ULL, 0xc9ea22b5e02c7acdULL, 0xe340370c21259a7bULL, 0x10c29673bac9edb3ULL}},
+     {{0x36137f6d41923231ULL, 0x2371c6156cbf5783ULL, 0xf3ccfcb8d6b0035cULL, 0xc5056f1e0e57966aULL}}},
+    {{{0x14e5c9a0c183b76aULL, 0xd3f2a4a33c69a323ULL, 0x1b3b39753d9ed7d4ULL, 0x269f2b613edc1b6cULL}},
+     {{0x204e9bdf4cdaf45dULL, 0x07846002b3c4b69cULL, 0x09d6f7764feeee88ULL, 0x08e0e245d0629c26ULL}}},
+    {{{0xdb8f047f546eb326ULL, 0xeb2b67302791275cULL, 0x509dfe3aea1fc18cULL, 0xc327e99733769417ULL}},
+     {{0x41c83d870087d513ULL, 0x69e4fe0a7860b5d9ULL, 0x287674eb4b92858aULL, 0x9ebc983feef1883dULL}}},
+    {{{0xe55433509a658716ULL, 0x81929446fdfd560aULL, 0x724ff7d56e7758f6ULL, 0xf3c224255afc708bULL}},
+     {{0xcce72291c284c04eULL, 0xaa208033aec4a12aULL, 0x80657b64a5373dafULL, 0x56d5ad83ef4afa99ULL}}},
+    {{{0x8d8bd0b3ef6e0e50ULL, 0x057f834930d48f02ULL, 0x6b45b79193cb6b45ULL, 0xa7fda013fae84d53ULL}},
+     {{0xe765d37b02127b85ULL, 0x6b991bed5b322f3fULL, 0x361ee6fcc6c281ffULL, 0xf83740c8131ade3fULL}}},
+    {{{0x8eb4e96382852f3cULL, 0x2f73d726b66bd400ULL, 0xf99c56637fcbe003ULL, 0xcb18ba105a9922bbULL}},
+     {{0x2bfc3c6ef8c8aa11ULL, 0xe5ff8f93c97b9f50ULL, 0xa9f4e8888759b94aULL, 0x684eddfc769d0f71ULL}}},
+    {{{0xb71412ccf0c13c78ULL, 0x44dca2b7437562b0ULL, 0xd455479a8ba2dc17ULL, 0x27934274a428df4eULL}},
+     {{0xa17b893eb45f5259ULL, 0x3254c2f9ec0aa8d4ULL, 0xc3df2d6970ff44f8ULL, 0xe09ad16787dab31cULL}}},
+    {{{0x8f8fbb21395a36fcULL, 0xeb0a803e3bab49d4ULL, 0x2265b594ccfc99d1ULL, 0xcb175b8d9b8ac1efULL}},
+     {{0x25aa7287ceaa01f5ULL, 0x23f66d068f48e9b7ULL, 0x4b835b03e06a1f1dULL, 0x6eba43ad5bb0b6b2ULL}}},
+    {{{0x3fdc34bb5a5dd65cULL, 0x9a02c69863a349f5ULL, 0x2d3d01e3ddd96ac7ULL, 0xdd2337195f535751ULL}},
+     {{0x3007319123698001ULL, 0xf9fdd297ce3decd5ULL, 0xb236aa3995625305ULL, 0xaa4344ca13261f3dULL}}},
+    {{{0xe91300a3a56803c5ULL, 0xc748c3d8e8ff741dULL, 0x0f1ceb04d4a913b1ULL, 0x514d91aed4d248afULL}},
+     {{0x610d165bfa8583d4ULL, 0x46f4e65466fda3d4ULL, 0x45688b8626f418a0ULL, 0x17d1ac57a0c34bcaULL}}},
+    {{{0x2ba278079f5d6952ULL, 0xce90b3f5dedc2a11ULL, 0x89238b960a3d8a1eULL, 0x22b5d1ab5756abd0ULL}},
+     {{0xd8b45012efc3b7f0ULL, 0xa8d75b9f3858eab8ULL, 0x2d9c4f4550b6144fULL, 0xc2b8c8952714e258ULL}}},
+    {{{0xe849b87fa623aa7bULL, 0xf66b26c204e96759ULL, 0x5bac718e87dea5edULL, 0x60fcc622f71c58beULL}},
+     {{0x6dfd4515c53f1a5aULL, 0x29416157eb28ae0dULL, 0x138cc10a438938c8ULL, 0xf005d031fbb49051ULL}}},
+    {{{0x0e6037a8c446805aULL, 0xda6db3f7cd80243bULL, 0x9b00205cf7f5a0eeULL, 0xf58eee30f30f9fbdULL}},
+     {{0xfcf8c1ff303056bfULL, 0x5d8722b04f84c47dULL, 0x4be6fa8fa4466ad1ULL, 0xc0b2d2e857f19b57ULL}}}
+  },
+  {
+    {{{0x48d6e568d8291613ULL, 0xe6d6ca3e85330a0fULL, 0x61741e8bdb0ca373ULL, 0xa06d88c2e5017007ULL}},
+     {{0x8d0aa38c80de87fdULL, 0x59164ae64ede608fULL, 0x1ffe269d9274f03bULL, 0x5c3c14769456fc94ULL}}},
+    {{{0x8dc664388e52f374ULL, 0xe85d903ee69b9470ULL, 0xb4688593096a64b7ULL, 0x91685fb87e3c3e1dULL}},
+     {{0x4df5de107d6fe762ULL, 0x9709cecac5e50149ULL, 0x1543278bf564b388ULL, 0x701328e53c93cf4bULL}}},
+    {{{0x4760cc9e81676333ULL, 0xb2a0ae0c7311fd63ULL, 0xf5debfe8a5b0f75cULL, 0xb1e365d3c1e6cef6ULL}},
+     {{0xd57d566fd09a9e9eULL, 0xefcb717f239ab1f7ULL, 0x5e4b88d70eaf3333ULL, 0xd25b69dddd4b370eULL}}},
+    {{{0xdecf02df4a0c6284ULL, 0xe2c659f3519937cdULL, 0xe4192815aa1aeb43ULL, 0xc13941ebf033e5eaULL}},
+     {{0xf737afd700ea1a58ULL, 0x106e17af591ff758ULL, 0x7ac6ea5d29f05833ULL, 0x3462d3e56b2f9afcULL}}},
+    {{{0xd88e4d3fe26001ffULL, 0xdeed33d7416d0361ULL, 0xf4dec0c99ca83e64ULL, 0xc5cd14516e9b116dULL}},
+     {{0x16afb699d411533aULL, 0x12a4e2681ca806f3ULL, 0x0d4438e8a7ddf4e6ULL, 0x61683bf64be127c9ULL}}},
+    {{{0xa545324076d975e1ULL, 0x5968c491b5c1e5f3ULL, 0x6d90fe4b566bd4efULL, 0xfee7353bc0486172ULL}},
+     {{0xb2b704c2f047efa4ULL, 0x8021ad5657c15872ULL, 0xce02944e0871cd98ULL, 0x35087f949362df2bULL}}},
+    {{{0x2ab4f194391cd32aULL, 0x3ceab69e56cf4321ULL, 0x5c723634eed85fadULL, 0x10bd346df4c02620ULL}},
+     {{0x57e7485a299ee2d7ULL, 0xbaa0c7ed399d7788ULL, 0x8a0b3bbb5845714cULL, 0x8e7e2ed6dcc46009ULL}}},
+    {{{0x91df1b02764e46b4ULL, 0xdf6ce00351ecbf45ULL, 0xf574d378b9b7f710ULL, 0x6c8f6e14a1cdaf6bULL}},
+     {{0x350b4273bf0e16c7ULL, 0x232fa5debd2bb3a9ULL, 0x7d6f020d8e80d7a0ULL, 0x4dbb1cde518dbda7ULL}}},
+    {{{0x2493359e73bb3206ULL, 0xdf08ad5ed52154c4ULL, 0xb9599a598ec8cde1ULL, 0xa2df54ad84aac82fULL}},
+     {{0xa04beaae45440366ULL, 0x79b4efa840467dfbULL, 0xfb5742367bd4cbc1ULL, 0x489ce12489706905ULL}}},
+    {{{0xb7a2e4e053f6fecbULL, 0x178f3313fead75b7ULL, 0x54977a3003901879ULL, 0x2bdcf35d7d6e7109ULL}},
+     {{0x47b821c3c891d55cULL, 0x9a97523acae487f5ULL, 0x3a5a7ce9d05dfaa6ULL, 0xd6d3b7cf8e848a8fULL}}},
+    {{{0xcd6e0b1af4b0e94eULL, 0xd2e16c221ee75f93ULL, 0xf0bcc1b58e8858cfULL, 0x4b2fc48a8aa37cb5ULL}},
+     {{0xfa4247dd7187ceabULL, 0x3513edc8fd0dc44aULL, 0xf1fa8a7bd80b168aULL, 0x54ac5d6c84f7e104ULL}}},
+    {{{0xa9d497bc75ba104aULL, 0xd80b30a4ce11a74dULL, 0xab875e289406838eULL, 0xe12950331e542b34ULL}},
+     {{0xfc8c92c5d280034fULL, 0x99896711c947c9a7ULL, 0xa35419dd3b45d6e0ULL, 0x0ddc2972a40dcee3ULL}}},
+    {{{0x26ee232480896041ULL, 0xee008a4d2948621bULL, 0xe22d55826f5f3626ULL, 0xd968ecb0dd2e69f6ULL}},
+     {{0xdae2383006c80ec0ULL, 0x3b441787f3622916ULL, 0xa08887d24420c358ULL, 0xa2fb5f7137eec4ffULL}}},
+    {{{0x96d3716203a582a9ULL, 0x9741d539d5e03d07ULL, 0x1cf336fb9d2fedd0ULL, 0xc46ec6a30db3a89cULL}},
+     {{0xc51704148da72b6eULL, 0x900eed77773ef2e8ULL, 0x65b05be8554860f8ULL, 0x7be087a2c7a26275ULL}}},
+    {{{0xa6b67d065667ea5eULL, 0xa36d41c1c84ce925ULL, 0xe0b7c743297254dfULL, 0xd80825c42c95b96dULL}},
+     {{0x76c15d95ca2a815eULL, 0x80a32868f7ca128fULL, 0xc074b60012654d5cULL, 0xef948c264a199045ULL}}},
+    {{{0xde6404adfce7751eULL, 0x90291afe7738066eULL, 0x532b6dcf3472ef04ULL, 0x570aa6cabc3e1c86ULL}},
+     {{0x048255c077edbc16ULL, 0xdd0f59ff6985b73bULL, 0xc93f6ff2a2a4c88eULL, 0xee88f0a02d7023bdULL}}}
+  },
+  {
+    {{{0x492fa795c2c6c1ffULL, 0x9d31b9ea589d0314ULL, 0x0688934ca3260970ULL, 0x20439b4283eb7befULL}},
+     {{0x581f976d58323112ULL, 0x1a4df2578dcbd135ULL, 0x3d97c8916a5dbf5eULL, 0x945d65fe9515e452ULL}}},
+    {{{0x8135ebd5ad1f9c34ULL, 0xc2139908cb965b65ULL, 0x1ac3c609e4a0603cULL, 0xaa9b7196d6957a6bULL}},
+     {{0x036b34afd26b8374ULL, 0xddd5afaf1a32f751ULL, 0x834374f84f3a3312ULL, 0xf8648d01212c68dfULL}}},
+    {{{0x47bb436826896d5bULL, 0x79561778378548dcULL, 0x3e6b2eb6b7a63182ULL, 0xb8f3187b60542fb1ULL}},
+     {{0xb256543b660f8814ULL, 0x168e8733649dcc0eULL, 0xe000a290751585d4ULL, 0x60b90ab6215f126aULL}}},
+    {{{0x8ad10f1532b4e1f2ULL, 0x13731d974ea81c4bULL, 0x46eb0da2f1b173adULL, 0x0226497a994c084cULL}},
+     {{0x4e74440dadd767b5ULL, 0x3fa5fca0d1de4d43ULL, 0x469ee57426acbab0ULL, 0x4d060a6b014ac954ULL}}},
+    {{{0x405f799c8801a40eULL, 0x808cfc96c8378c41ULL, 0xfb5c46796eb0fd8fULL, 0x5a9c71a6bdc170f3ULL}},
+     {{0xb802e7707e6dcd88ULL, 0x76b90a80c4a8f377ULL, 0x444bc0b593b7f560ULL, 0x8971d3dfea8c814cULL}}},
+    {{{0xa51d4548da176c39ULL, 0x691947c67bd7a14aULL, 0xdb4a76c4ea3773a3ULL, 0xa8f400d133a41378ULL}},
+     {{0xf154b6996c7dc7e2ULL, 0x1e0ff6a7358683c3ULL, 0x0561f86a02e6d2daULL, 0x8b21ea8b3caab816ULL}}},
+    {{{0x914fdd16b8eb87e3ULL, 0x80cd273d6abf683eULL, 0xed407c822a824910ULL, 0xb1030ee902b2c1d4ULL}},
+     {{0x6c4ae5e9be3c5fedULL, 0x3a5ba2b8bb5d0a38ULL, 0x7a15c7a86fe9a70aULL, 0x9b2d078e762cce11ULL}}},
+    {{{0xf1c6f6c513fcccc3ULL, 0xc693a0559e8a956eULL, 0x605573972c1623caULL, 0xb34464fd7efa1ec4ULL}},
+     {{0x35339baecd89ad8aULL, 0x548af2c059b6e71fULL, 0x9d689b1c4853c622ULL, 0xe36b446d44b9cb8eULL}}},
+    {{{0xa1d5c5ad77d753beULL, 0x69c6c749cc1cf197ULL, 0x68f552a888fe123eULL, 0x452cceb024f4685fULL}},
+     {{0xd4cefe203de5bedcULL, 0x2fe151af25c1ff29ULL, 0x209210152972b2a0ULL, 0x8cf0c7f581358b63ULL}}},
+    {{{0xf01c3b757a80fbe7ULL, 0x9aebe8d4e23c6c68ULL, 0xefa267cc3d45aa4bULL, 0xcc5fc5a1ee3fac96ULL}},
+     {{0x79394ef7f0306a8bULL, 0xe37f20db89ecc486ULL, 0x3a022c82637730f7ULL, 0x7c1c85a56c1ab180ULL}}},
+    {{{0x4bcf89be8bb0850dULL, 0x474a287c2d0c66f8ULL, 0x1448d5a7f17eb042ULL, 0x88c60a40d0ffd128ULL}},
+     {{0x72985012cd2dee36ULL, 0x06d95be49543a19bULL, 0x6c45ca249160ab59ULL, 0x57e2047a89d8a307ULL}}},
+    {{{0x2df7b396572c2a64ULL, 0x0c60d7c3d72cef66ULL, 0x26bb8463b27da964ULL, 0x9faec1071e4a5cceULL}},
+     {{0x8fed2d1449bdfee1ULL, 0x2ea1c414e421a6ceULL, 0x7297288a4273f6d9ULL, 0xdff105ae7e50f8c5ULL}}},
+    {{{0xb34845d279d642ceULL, 0x65fa70f8f48c8394ULL, 0xedfe4f73fe61c22dULL, 0x3c201c6f8e09e42dULL}},
+     {{0x5947383d3477a36aULL, 0x63cddbcd829327f8ULL, 0xdff2c9739a9f8cffULL, 0x1f98f0c74c32c71eULL}}},
+    {{{0x24fa0f3e12061e72ULL, 0x215259139e37b177ULL, 0x6c2c5a217303ac75ULL, 0x28f0673027f1b30aULL}},
+     {{0x1943b8008bfe4851ULL, 0x7b8a53875aa2b1abULL, 0x0f8c132bce59dd47ULL, 0x5ae33cf18e882c0eULL}}},
+    {{{0x6cd3a3d2d3b11c67ULL, 0xdfb56c7b0e21318cULL, 0xaf87e6ed03f2ad21ULL, 0x3ea7c0dbf2150469ULL}},
+     {{0x95f26fb549bdcc83ULL, 0x046d3e36975faa47ULL, 0x0acc8f26062a741aULL, 0xb230b1ebb2b185d0ULL}}},
+    {{{0x7eb055a57867e91dULL, 0x976f7156657d31ddULL, 0x561a6967971d0ddeULL, 0xf122ab56938a1ac9ULL}},
+     {{0x225bcc73c09fa9d9ULL, 0xeea9c8b09d809d98ULL, 0x096bf3bcf44b140bULL, 0x2845aba005a5a005ULL}}}
+  },
+  {
+    {{{0xb0e569961286dcb8ULL, 0x6bddbad649d13cc9ULL, 0x1a25536f832f54abULL, 0xde1697bf184ad27bULL}},
+     {{0x78dbab79831a5b1cULL, 0x5dfdb95fe62deba9ULL, 0x15702e9c28f6bcc1ULL, 0xeeedd6a35a128172ULL}}},
+    {{{0xf4ed73170e3c12d6ULL, 0x2e1a0f65292444b0ULL, 0x5e6cd56fad0d1b63ULL, 0x32630f87b0b97545ULL}},
+     {{0xa989840a275a90c2ULL, 0x5c74b33ec57efb9eULL, 0xa2d30a93b0103db5ULL, 0x25bbeb3838d2d228ULL}}},
+    {{{0x3a31d7adf4707184ULL, 0xe721ec3241928aa6ULL, 0xf457941aff49d086ULL, 0xf7d6d98c692e9d18ULL}},
+     {{0x437fddcd31141dcdULL, 0xe1cd60e64380c27aULL, 0x5e9c84365a20cf71ULL, 0xc6e0e04601f07b3dULL}}},
+    {{{0x5870ddb35fa092f1ULL, 0x9e67022acc86df99ULL, 0xb5679ab01f646063ULL, 0x246da7744e14e75dULL}},
+     {{0x5063dfeb20086988ULL, 0x1a2d7d9fe0f37052ULL, 0xe752dc860f895eeeULL, 0xc36fe15a4c1eb790ULL}}},
+    {{{0x45742c8720507d5eULL, 0x37232c2ea1395a26ULL, 0x9b367d35e8a17f47ULL, 0x08b766d029fc5f70ULL}},
+     {{0x795a2bab20f3655bULL, 0xaaa04cf44c53b5f3ULL, 0x2b058bf3331039e6ULL, 0xf6ab5434a2791c91ULL}}},
+    {{{0x4e9b403606a361cfULL, 0xfe4ae8a40376efbdULL, 0x2da428eb232fa124ULL, 0xedda6b4fff87c6caULL}},
+     {{0xc4a17b5fe615a092ULL, 0xe1dde2037a9c9ea7ULL, 0x9b827644b336eb47ULL, 0x211a8b1f5f32aeeeULL}}},
+    {{{0xef7a636a8ff767d2ULL, 0xcf3cf3d46d04b05aULL, 0x340cd46be0562272ULL, 0x2d98288adb489696ULL}},
+     {{0xa8d8f6a77969d619ULL, 0xef8f271f0519d563ULL, 0x6214a685de54f644ULL, 0x2e0e293bd91cf190ULL}}},
+    {{{0x8436c74caf7f9654ULL, 0xd58adfc6b5d8470bULL, 0x16b6812b330f73bdULL, 0x0b937f177a8aa89dULL}},
+     {{0x19db1f2663ad0a9aULL, 0xff97d2e0f21462c9ULL, 0x953eb3414034fc9dULL, 0x1260f844b56f59d7ULL}}},
+    {{{0xfef6d71abf3b0938ULL, 0x1ae9d6c45c987acfULL, 0x190199c4c6c2961cULL, 0x8248a9aaa7648871ULL}},
+     {{0xbaf69a0832c9b89eULL, 0x976c650dd6afcab5ULL, 0xb39ea55851571d06ULL, 0x5dde91864df15818ULL}}},
+    {{{0xf99d902a14bdee6cULL, 0x76448fdc3ce2ce46ULL, 0x0a170f755a5fd358ULL, 0xf33ff17d64e45374ULL}},
+     {{0x36b341d1327316c6ULL, 0xe1e35ab757d34bfaULL, 0x673ad964a2cee020ULL, 0x5e3936926d4dab8fULL}}},
+    {{{0xfdd8daac6b274923ULL, 0xf57cd7b3158c5655ULL, 0xa13463a66e82ed60ULL, 0x5dbfbd77f3bdf0ccULL}},
+     {{0x98e415b8d0136ea6ULL, 0x97b2e0363c335151ULL, 0x25ee349b46d95bafULL, 0xf5a5ccdd48d3fd10ULL}}},
+    {{{0xa13bba16b3c9c6a9ULL, 0x9097d5d92361e743ULL, 0x771bfb6453943df9ULL, 0xb02a73ec211d7400ULL}},
+     {{0x900a9be188fd6c43ULL, 0x192619ab334167c7ULL, 0xbb89234d0871f19eULL, 0xb34aab87ce62f4e6ULL}}},
+    {{{0x54ed64b0afc93980ULL, 0xc0e1884803f92691ULL, 0x8b7a7aa3de38e287ULL, 0x015e5991ff1a493fULL}},
+     {{0xacc655d0453ebf77ULL, 0x2a955f2e28f24857ULL, 0x984df969799cb67dULL, 0xfb0b1ad078497999ULL}}},
+    {{{0x9e163a65bd5aa7aeULL, 0xfc8ec57732530993ULL, 0xe21f0a2784f6fb56ULL, 0x2345650d0d2ab920ULL}},
+     {{0x6de9db233c9480a8ULL, 0xfbf10e652f24b6fdULL, 0x8aa77d14a7862bdeULL, 0xcac239b0961396e1ULL}}},
+    {{{0x60ac8eac0da205dfULL, 0x30bcc98f20f6e9faULL, 0xf9dd0fdabb662776ULL, 0xd9383404c5b82f05ULL}},
+     {{0xa8d6d28f51cf6444ULL, 0x5528b7ed6611fd43ULL, 0xf788176f5ac40f97ULL, 0x615e3308e37fce90ULL}}},
+    {{{0xbeda48b0f1b35d2bULL, 0x26caa0188eda0035ULL, 0x7828650febc18f98ULL, 0xc18fb4007d837125ULL}},
+     {{0x256c00d148569a16ULL, 0x5bdba430f48bbe2bULL, 0x050af712873a1dc2ULL, 0x0bedeb89ceea7ef8ULL}}}
+  },
+  {
+    {{{0x09ba43982a642848ULL, 0x31dd8e0cba556b3fULL, 0xce38ef60f48e55c4ULL, 0x3cbc99ba96b3a547ULL}},
+     {{0x45861dd378e02d9dULL, 0xffcb0c9b15eeca91ULL, 0xb67f4b4ef84fb3cbULL, 0x3bfd8ad1aeed5893ULL}}},
+    {{{0xaeaf0c3b90d9348bULL, 0xea571bcccc76cae3ULL, 0xd402951316f18023ULL, 0xf634fe7316d49a02ULL}},
+     {{0xb674d40e882ff88cULL, 0xa4d811112810e2cbULL, 0x1783a9ca3c87a6d2ULL, 0xf5b5d6804f91880fULL}}},
+    {{{0xd4c80af7ca49ebeeULL, 0xe00201c1f1ec97efULL, 0x1c5331e7eae6dcd8ULL, 0xe6c7a860f38b0b3eULL}},
+     {{0x22bd4842d02823a2ULL, 0xff0b21c2f3b67549ULL, 0xd456b09532dc1f3aULL, 0xb0c5f984e7b4ffe7ULL}}},
+    {{{0xebe73b3bb9198718ULL, 0xef1e37f50dbe7783ULL, 0x38020f60ea2b3809ULL, 0x63661525e733e72dULL}},
+     {{0x11b245e8ddf13618ULL, 0x7ac1e938d6edda82ULL, 0x24e91b8776335854ULL, 0xb1b025bf831aff48ULL}}},
+    {{{0xda544121578a0a19ULL, 0x96415724747c16a4ULL, 0x1c23e03c84542b0aULL, 0xfe9039f9a1afef80ULL}},
+     {{0xf705a1084fa9f02eULL, 0xf6cf6fb3d4e8ea4cULL, 0xf3e0fabd4ee3eeafULL, 0xb49e5207cdc7c24aULL}}},
+    {{{0x0b7c50e4328c5d1eULL, 0xf361c1fb1db242cbULL, 0x6dc09c81f361b44cULL, 0x6317db0c5fd3546dULL}},
+     {{0xb2bb10c2c33aae92ULL, 0xe89c1256b6e642daULL, 0x4c4ea7681a8de268ULL, 0x446f2d5b7c5a15d9ULL}}},
+    {{{0x036ef3126094bd1cULL, 0x898304a28aaa4bc4ULL, 0x34ef0a208b5ee998ULL, 0x76de6046611991f0ULL}},
+     {{0x19b3841bbc5aaa04ULL, 0x84d7079f2d4b4b80ULL, 0x1073c674003a7be2ULL, 0x7595f2a251bd7c57ULL}}},
+    {{{0x769bfd24981d37f2ULL, 0x7d7641e64a7163c0ULL, 0x6e5eabe63f4cfbb1ULL, 0x5e9321a599e6719dULL}},
+     {{0xa7b51fd1b5419f1aULL, 0x6f28255f31a9e033ULL, 0x90b1dbb7fbc0e463ULL, 0xfe2c7557dce0fc52ULL}}},
+    {{{0x1b48e1f6ca3ba016ULL, 0xda66450ca63ba372ULL, 0x256b9aeb9441a8e3ULL, 0x8dfe45ffac2e4686ULL}},
+     {{0x4e89ce5f12b43445ULL, 0xbee550948a70ef96ULL, 0xfa82b3e188c12e77ULL, 0x386da03ae49ba6afULL}}},
+    {{{0x19cbf3f7a72c49f2ULL, 0x11c73b863c05c30bULL, 0xc96601ec6fc87fe2ULL, 0x4bfba2c3270e10f3ULL}},
+     {{0x7e0059a0c7872116ULL, 0x1af1dffc63bc18f3ULL, 0xdd9630bcc44dc862ULL, 0xddde4efa8aa6eda5ULL}}},
+    {{{0x033d1c4bdc2a72c9ULL, 0x1f2c263925f8579eULL, 0x1ac814e1135003e4ULL, 0x1df58377fccf2554ULL}},
+     {{0x2cdefd605b397759ULL, 0x8202a0809d55e00aULL, 0xfdd2a7109ff89f3cULL, 0xe3846a132f90f9dbULL}}},
+    {{{0x534b8265db1af59dULL, 0x5184e624053e860bULL, 0x3d0dba38476a5f7cULL, 0x4f9f4791a64d6606ULL}},
+     {{0x9ab20ab19739b197ULL, 0xc43b9f2771591839ULL, 0xd739d5d9f87c1961ULL, 0xfdaa5f34f1536d12ULL}}},
+    {{{0x715a05d1c1c66a0dULL, 0x8e24c87d99b66be1ULL, 0x77fceffb74ee5a5cULL, 0x4293cc8e2b437c93ULL}},
+     {{0x7ff44779fa6cb47eULL, 0x2fcb3b03f5750c23ULL, 0x5d2e1ccedc271b3cULL, 0x6653c76ac804b060ULL}}},
+    {{{0xb7db0fe5c75ca407ULL, 0x48ac13b40fd5fb95ULL, 0xfdc249eda814e41eULL, 0x70b33dfd6a0e1782ULL}},
+     {{0x6f3e6166c7093b97ULL, 0xf0c4f4db6c1cf487ULL, 0x2aab4d722133e827ULL, 0x678b3b0184dbc273ULL}}},
+    {{{0xbae51086fde32be1ULL, 0xf2b26e545d9c42c7ULL, 0x0c2709510bbc8046ULL, 0x1a98d74cc90f81a4ULL}},
+     {{0xc90d8aa7fa83322dULL, 0x3d7c1918e299265bULL, 0xa3a1c7c3f47e6657ULL, 0xb74066e31066e3f7ULL}}},
+    {{{0x0330695b43fae198ULL, 0x4bb07da8f5e7603cULL, 0x39a7b19a3d55df3bULL, 0x7000c3eaed6f9ab9ULL}},
+     {{0xc4dca02a087cf32bULL, 0x53fd8b67e60201bcULL, 0xc48b7cba315a7593ULL, 0xbebc3259de6b05e2ULL}}}
+  },
+  {
+    {{{0x79ce53482c124d8eULL, 0x47cddb1dffa19a1eULL, 0xe4a8b4257484e171ULL, 0x53e6d0e9f032ba36ULL}},
+     {{0x669bc4a3a02dfc78ULL, 0xbed0aeb94c6df136ULL, 0xa1bedaa9df16d6a2ULL, 0x211174d7f0be02fbULL}}},
+    {{{0x6b1bcd2ece5a77eaULL, 0xc37210048d2c0f48ULL, 0x12594cd736eead65ULL, 0xb0447c682f816f03ULL}},
+     {{0x94ff626927641b4bULL, 0x0c31fa1e22a056e0ULL, 0xb519b3424f44b4c4ULL, 0x41c262243d76c50cULL}}},
+    {{{0xc348ce4687f29eb2ULL, 0xb91ae9d6d36c0546ULL, 0x3b9708aa14bf12a6ULL, 0x6218d4b0616ed5c2ULL}},
+     {{0x4fb078a6f37e5f00ULL, 0xc76c1df29c428d16ULL, 0x62f1e94653f13881ULL, 0x72e39c9bd9d1c9deULL}}},
+    {{{0x585537587d0c47e7ULL, 0x8a78f48b76bd5158ULL, 0xa1aa275c461de040ULL, 0x55d0060a22e1ccccULL}},
+     {{0xa0ac27456620a2e2ULL, 0x7f22345503a8b411ULL, 0xdcbf3f926de9bb97ULL, 0x129444aaaacfb5e8ULL}}},
+    {{{0xefcbeb6a23a718d1ULL, 0x361849ab3bfb5a7eULL, 0xd0c47ca9bc43d723ULL, 0xef9c573bcddd468aULL}},
+     {{0x531cfa65c1de6c48ULL, 0x7d9d8503e061f26dULL, 0x3f14e74dd14f7454ULL, 0x6865311b84914b3bULL}}},
+    {{{0x156889867ec7912fULL, 0x616313733a22bc3fULL, 0x553aa749b94e5fdaULL, 0x833860a997d66324ULL}},
+     {{0xef85ac86b2add26dULL, 0x17d9bc8e0dbfde2cULL, 0xc5110a436521586dULL, 0xb0c0f7e88c20b2d4ULL}}},
+    {{{0x2b628bbf4d0d51c1ULL, 0x0edaca081fccdb92ULL, 0x9f18a4ba7948453dULL, 0x47aebb9e8abb9752ULL}},
+     {{0xa5325bca515df4e0ULL, 0xa880be60c73ab2d9ULL, 0x2f951797f1c83f67ULL, 0xc7fad11af48630f3ULL}}},
+    {{{0x2839072e698cb4bdULL, 0xa74b61d652d53735ULL, 0x970596bfe46b61cbULL, 0x3abfb45ae8c7f7f9ULL}},
+     {{0xee8d78a3aba4b25bULL, 0x6aa43afa015730fdULL, 0xc00f36d32202370eULL, 0x075f2e79bedef948ULL}}},
+    {{{0xd5023839f0dbad8cULL, 0x9cddaafe05d4fbe9ULL, 0xf072ae0e8acf4b7fULL, 0xe8ca5fd337a057f1ULL}},
+     {{0x4080d556489cedc9ULL, 0xaf83751b92163ef7ULL, 0xa12923515e7bf321ULL, 0x486e559a5087d7c9ULL}}},
+    {{{0x4b65d707bb58b1b7ULL, 0x8e1b9e1f86e92e52ULL, 0x14e9861649d6b5d1ULL, 0xb686e06f55a4d45bULL}},
+     {{0xd88cfe18e0bfeab6ULL, 0x95c22e03a1b6869dULL, 0xff9ca0c393415f9aULL, 0x17374e72e13a7123ULL}}},
+    {{{0x1feb648c84b966aaULL, 0x046284029b2332baULL, 0x14525989d183c17dULL, 0xf3300adfc3020903ULL}},
+     {{0x653cc4023cee5ea9ULL, 0xae23a29fab232297ULL, 0x53d4f97ece79cd84ULL, 0x7ca86c53f86c3e89ULL}}},
+    {{{0x39ccf45e22766705ULL, 0xb694cb3e2e52d801ULL, 0xbc724ff16692af32ULL, 0xe5c9ef26f72f0e94ULL}},
+     {{0x21668cd5fb66c55bULL, 0xaab67535bd0ca442ULL, 0x4f6df61d04684296ULL, 0x8e2191d8f0a4146fULL}}},
+    {{{0xd3fd73ff7e863c3aULL, 0x70c966b376f55126ULL, 0x887da0d3ecf2f97fULL, 0xff32a45200dd8048ULL}},
+     {{0x49160cb392f5d90bULL, 0xecaf7147303c4289ULL, 0xdddfa4170003b5e1ULL, 0xc4c2e127471c14d2ULL}}},
+    {{{0xdb135c72bf4b128fULL, 0x186bb161cf1b2a05ULL, 0xc0c34f7729e34003ULL, 0x31ff4c5511c35e86ULL}},
+     {{0x49ba214de6cc803bULL, 0xfe8787761146d4c8ULL, 0x00ba95edf5fc4d74ULL, 0x0c3373c53eb7ededULL}}},
+    {{{0xffbe79ee7755b166ULL, 0x6447bf6d1985ceb3ULL, 0x6947ab952a5b42c3ULL, 0x6ef8cd75ae512721ULL}},
+     {{0xc2fb0b7ad8d9044aULL, 0x27f66bf147eaee0eULL, 0x0df06f559020cf04ULL, 0x05b3437f8123994dULL}}},
+    {{{0xd17b6e6d7bbedc38ULL, 0x88fc62a25ce631e6ULL, 0xa403b4ecc19ff75bULL, 0xb692d8a10f50320aULL}},
+     {{0xeb931dafb5290414ULL, 0x911aadbf387c0879ULL, 0x46902186250832a3ULL, 0x629aae03c82461bdULL}}}
+  }
+};
@@ -0,0 +1,157 @@
+#include "ec.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Multi-scalar multiplication: res = sum k_i * P_i.
+// Every input is first GLV-split into two terms (|k| < 2^128, +/-P or +/-lambda*P),
+// then either interleaved wNAF (Strauss-Shamir) or the bucket method (Pippenger)
+// runs over all terms with one shared doubling chain. Variable time.
+
+#define EC_MULTI_STRAUSS_MAX 16   // Up to this many inputs Strauss wins
+#define EC_MULTI_W           5
+#define EC_MULTI_TABLE       (1 << (EC_MULTI_W - 2))
+#define EC_MULTI_WNAF_LEN    257
+#define EC_MULTI_BITS        129  // Split halves are below 2^128 in absolute value
+
+typedef struct {
+    bigint256_t k;   // Non-negative, < 2^128
+    ec_apoint_t p;
+} ec_term_t;
+
+// Split every (k_i, P_i) into up to two terms; returns the number of terms
+static size_t ec_multi_terms(ec_term_t *terms, const bigint256_t *scalars, const ec_point_t *points, size_t n) {
+    size_t m = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (points[i].is_infinity) continue;
+
+        bigint256_t half[2];
+        ec_apoint_t base[2];
+        ec_scalar_split_lambda(&half[0], &half[1], &scalars[i]);
+        ec_apoint_set(&base[0], &points[i]);
+        ec_apoint_mul_lambda(&base[1], &base[0]);
+
+        for (int h = 0; h < 2; h++) {
+            ec_term_t *t = &terms[m];
+            t->k = half[h];
+            t->p = base[h];
+            // k > n/2 stands for -(n - k): negate both so the scalar is small
+            if (ec_scalar_is_high(&t->k)) {
+                bigint_neg_mod_n(&t->k, &t->k);
+                ec_apoint_neg(&t->p, &t->p);
+            }
+            if (t->k.limbs[0] | t->k.limbs[1] | t->k.limbs[2] | t->k.limbs[3]) m++;
+        }
+    }
+    return m;
+}
+
+// --- STRAUSS-SHAMIR ---
+
+static int ec_multi_strauss(ec_jpoint_t *acc, const ec_term_t *terms, size_t m) {
+    ec_jpoint_t *jac = malloc(m * EC_MULTI_TABLE * sizeof(ec_jpoint_t));
+    ec_apoint_t *tables = malloc(m * EC_MULTI_TABLE * sizeof(ec_apoint_t));
+    int *wnaf = malloc(m * EC_MULTI_WNAF_LEN * sizeof(int));
+    if (!jac || !tables || !wnaf) { free(jac); free(tables); free(wnaf); return 0; }
+
+    // Odd multiples of every term, normalized together with one inversion
+    int len = 0;
+    for (size_t t = 0; t < m; t++) {
+        ec_jpoint_t *row = &jac[t * EC_MULTI_TABLE];
+        ec_jpoint_t d;
+        ec_jacobian_from_affine(&row[0], &terms[t].p);
+        ec_jdouble(&d, &row[0]);
+        for (int i = 1; i < EC_MULTI_TABLE; i++) ec_jadd(&row[i], &row[i - 1], &d);
+
+        int l = ec_wnaf(&wnaf[t * EC_MULTI_WNAF_LEN], &terms[t].k, EC_MULTI_W);
+        if (l > len) len = l;
+    }
+    ec_batch_to_affine(tables, jac, m * EC_MULTI_TABLE);
+
+    for (int i = len - 1; i >= 0; i--) {
+        if (!acc->is_infinity) ec_jdouble(acc, acc);
+        for (size_t t = 0; t < m; t++) {
+            ec_jadd_digit(acc, &tables[t * EC_MULTI_TABLE], wnaf[t * EC_MULTI_WNAF_LEN + i]);
+        }
+    }
+
+    free(jac);
+    free(tables);
+    free(wnaf);
+    return 1;
+}
+
+// --- PIPPENGER (bucket method) ---
+
+static unsigned int ec_multi_bits(const bigint256_t *k, int bit, int count) {
+    unsigned int v = 0;
+    for (int i = 0; i < count && bit + i < 256; i++) {
+        v |= (unsigned int)((k->limbs[(bit + i) / 64] >> ((bit + i) % 64)) & 1) << i;
+    }
+    return v;
+}
+
+// Window width minimizing (bits / c) * (m + 2^(c+1)) point additions
+static int ec_multi_window(size_t m) {
+    int best_c = 2;
+    double best = -1;
+    for (int c = 2; c <= 16; c++) {
+        int windows = (EC_MULTI_BITS + c - 1) / c;
+        double cost = (double)windows * ((double)m + (double)(2u << c)) + (double)(windows * c);
+        if (best < 0 || cost < best) { best = cost; best_c = c; }
+    }
+    return best_c;
+}
+
+static int ec_multi_pippenger(ec_jpoint_t *acc, const ec_term_t *terms, size_t m) {
+    int c = ec_multi_window(m);
+    size_t num_buckets = ((size_t)1 << c) - 1;
+    ec_jpoint_t *buckets = malloc(num_buckets * sizeof(ec_jpoint_t));
+    if (!buckets) return 0;
+
+    int windows = (EC_MULTI_BITS + c - 1) / c;
+    for (int w = windows - 1; w >= 0; w--) {
+        if (!acc->is_infinity) for (int i = 0; i < c; i++) ec_jdouble(acc, acc);
+
+        // Drop every term into the bucket of its digit in this window
+        for (size_t b = 0; b < num_buckets; b++) buckets[b].is_infinity = 1;
+        for (size_t t = 0; t < m; t++) {
+            unsigned int digit = ec_multi_bits(&terms[t].k, w * c, c);
+            if (digit) ec_jadd_mixed(&buckets[digit - 1], &buckets[digit - 1], &terms[t].p);
+        }
+
+        // sum_j (j + 1) * bucket[j] via running sums from the top bucket down
+        ec_jpoint_t running, total;
+        running.is_infinity = 1;
+        total.is_infinity = 1;
+        for (size_t b = num_buckets; b-- > 0; ) {
+            ec_jadd(&running, &running, &buckets[b]);
+            ec_jadd(&total, &total, &running);
+        }
+        ec_jadd(acc, acc, &total);
+    }
+
+    free(buckets);
+    return 1;
+}
+
+int ec_multi_mul(ec_point_t *res, const bigint256_t *scalars, const ec_point_t *points, size_t n) {
+    ec_term_t *terms = malloc((2 * n + 1) * sizeof(ec_term_t));
+    if (!terms) return 0;
+
+    size_t m = ec_multi_terms(terms, scalars, points, n);
+    ec_jpoint_t acc;
+    acc.is_infinity = 1;
+
+    int ok = 1;
+    if (m > 0) {
+        if (n <= EC_MULTI_STRAUSS_MAX) ok = ec_multi_strauss(&acc, terms, m);
+        else ok = ec_multi_pippenger(&acc, terms, m);
+    }
+    free(terms);
+    if (!ok) return 0;
+
+    ec_apoint_t out;
+    ec_jacobian_to_affine(&out, &acc);
+    ec_apoint_get(res, &out);
+    return 1;
+}
\ No newline at end of file
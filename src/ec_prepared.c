@@ -0,0 +1,179 @@
+#include "ec.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct ec_prepared {
+    ec_point_t point;
+    ec_point_storage_t table[EC_GEN_WINDOWS][EC_GEN_WINDOW_SIZE];
+};
+
+// --- PREPARED KEYS ---
+
+ec_prepared_t *ec_prepare(const ec_point_t *p) {
+    enum { N = EC_GEN_WINDOWS * EC_GEN_WINDOW_SIZE };
+    if (!ec_is_on_curve(p)) return NULL;
+    ec_prepared_t *pp = malloc(sizeof(*pp));
+    ec_jpoint_t *jac = malloc(N * sizeof(ec_jpoint_t));
+    ec_apoint_t *aff = malloc(N * sizeof(ec_apoint_t));
+    if (!pp || !jac || !aff) goto fail;
+
+    ec_apoint_t a;
+    ec_jpoint_t base;
+    ec_apoint_set(&a, p);
+    ec_jacobian_from_affine(&base, &a);
+
+    // Same layout and offsets as ec_gen_table: row i is offset_i + j * 16^i * P
+    for (int i = 0; i < EC_GEN_WINDOWS; i++) {
+        ec_jpoint_t *row = &jac[i * EC_GEN_WINDOW_SIZE];
+        ec_apoint_t offset;
+        fe_set_bigint(&offset.x, &ec_gen_table[i][0].x);
+        fe_set_bigint(&offset.y, &ec_gen_table[i][0].y);
+        offset.is_infinity = 0;
+
+        ec_jacobian_from_affine(&row[0], &offset);
+        for (int j = 1; j < EC_GEN_WINDOW_SIZE; j++) ec_jadd(&row[j], &row[j - 1], &base);
+        for (int j = 0; j < 4; j++) ec_jdouble(&base, &base);
+    }
+
+    ec_batch_to_affine(aff, jac, N);
+    for (int i = 0; i < N; i++) {
+        // Only reachable for points crafted against the offsets
+        if (aff[i].is_infinity) goto fail;
+        ec_point_storage_t *e = &pp->table[i / EC_GEN_WINDOW_SIZE][i % EC_GEN_WINDOW_SIZE];
+        fe_get_bigint(&e->x, &aff[i].x);
+        fe_get_bigint(&e->y, &aff[i].y);
+    }
+
+    pp->point = *p;
+    free(jac);
+    free(aff);
+    return pp;
+
+fail:
+    free(pp);
+    free(jac);
+    free(aff);
+    return NULL;
+}
+
+void ec_prepared_free(ec_prepared_t *pp) {
+    free(pp);
+}
+
+void ec_mul_prepared(ec_point_t *res, const bigint256_t *k, const ec_prepared_t *pp) {
+    ec_mul_table(res, k, pp->table);
+}
+
+// --- LRU CACHE ---
+// Hash chains for lookup plus a doubly linked list in recency order (head = newest).
+
+typedef struct ec_cache_entry {
+    ec_point_t key;
+    ec_prepared_t *prep;            // NULL if the point could not be prepared
+    struct ec_cache_entry *prev, *next;
+    struct ec_cache_entry *chain;
+} ec_cache_entry_t;
+
+struct ec_prepared_cache {
+    size_t capacity;
+    size_t count;
+    size_t num_buckets;             // Power of two
+    ec_cache_entry_t **buckets;
+    ec_cache_entry_t *head, *tail;
+};
+
+static size_t ec_cache_hash(const ec_point_t *p) {
+    if (p->is_infinity) return 0;
+    uint64_t h = p->x.limbs[0] ^ (p->x.limbs[1] * 0x9E3779B97F4A7C15ULL) ^ (p->y.limbs[0] << 1);
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 32;
+    return (size_t)h;
+}
+
+static int ec_cache_key_eq(const ec_point_t *a, const ec_point_t *b) {
+    if (a->is_infinity || b->is_infinity) return a->is_infinity == b->is_infinity;
+    return memcmp(&a->x, &b->x, sizeof(a->x)) == 0 && memcmp(&a->y, &b->y, sizeof(a->y)) == 0;
+}
+
+static void ec_cache_unlink(ec_prepared_cache_t *c, ec_cache_entry_t *e) {
+    if (e->prev) e->prev->next = e->next; else c->head = e->next;
+    if (e->next) e->next->prev = e->prev; else c->tail = e->prev;
+    e->prev = e->next = NULL;
+}
+
+static void ec_cache_push_front(ec_prepared_cache_t *c, ec_cache_entry_t *e) {
+    e->prev = NULL;
+    e->next = c->head;
+    if (c->head) c->head->prev = e; else c->tail = e;
+    c->head = e;
+}
+
+static void ec_cache_evict(ec_prepared_cache_t *c) {
+    ec_cache_entry_t *e = c->tail;
+    ec_cache_entry_t **link = &c->buckets[ec_cache_hash(&e->key) & (c->num_buckets - 1)];
+    while (*link != e) link = &(*link)->chain;
+    *link = e->chain;
+
+    ec_cache_unlink(c, e);
+    ec_prepared_free(e->prep);
+    free(e);
+    c->count--;
+}
+
+ec_prepared_cache_t *ec_prepared_cache_new(size_t capacity) {
+    if (capacity == 0) return NULL;
+    ec_prepared_cache_t *c = calloc(1, sizeof(*c));
+    if (!c) return NULL;
+
+    c->capacity = capacity;
+    c->num_buckets = 1;
+    while (c->num_buckets < capacity * 2) c->num_buckets <<= 1;
+    c->buckets = calloc(c->num_buckets, sizeof(ec_cache_entry_t *));
+    if (!c->buckets) { free(c); return NULL; }
+    return c;
+}
+
+void ec_prepared_cache_free(ec_prepared_cache_t *cache) {
+    if (!cache) return;
+    while (cache->count) ec_cache_evict(cache);
+    free(cache->buckets);
+    free(cache);
+}
+
+static ec_cache_entry_t *ec_cache_find(const ec_prepared_cache_t *c, const ec_point_t *p) {
+    ec_cache_entry_t *e = c->buckets[ec_cache_hash(p) & (c->num_buckets - 1)];
+    while (e && !ec_cache_key_eq(&e->key, p)) e = e->chain;
+    return e;
+}
+
+const ec_prepared_t *ec_prepared_cache_get(ec_prepared_cache_t *cache, const ec_point_t *p) {
+    ec_cache_entry_t *e = ec_cache_find(cache, p);
+    if (e) {
+        ec_cache_unlink(cache, e);
+        ec_cache_push_front(cache, e);
+        return e->prep;
+    }
+
+    if (cache->count == cache->capacity) ec_cache_evict(cache);
+    e = calloc(1, sizeof(*e));
+    if (!e) return NULL;
+    size_t b = ec_cache_hash(p) & (cache->num_buckets - 1);
+    e->key = *p;
+    e->prep = ec_prepare(p);
+    e->chain = cache->buckets[b];
+    cache->buckets[b] = e;
+    ec_cache_push_front(cache, e);
+    cache->count++;
+    return e->prep;
+}
+
+int ec_prepared_cache_contains(const ec_prepared_cache_t *cache, const ec_point_t *p) {
+    return ec_cache_find(cache, p) != NULL;
+}
+
+void ec_prepared_cache_mul(ec_prepared_cache_t *cache, ec_point_t *res, const bigint256_t *k, const ec_point_t *p) {
+    const ec_prepared_t *pp = ec_prepared_cache_get(cache, p);
+    if (pp) ec_mul_prepared(res, k, pp);
+    else ec_mul(res, k, p);
+}
\ No newline at end of file
@@ -0,0 +1,316 @@
+#include "ec.h"
+#include "cpu.h"
+#include "ecies_stats.h"
+#include "field_x4.h"
+#include <string.h>
+
+#ifdef FE4_AVAILABLE
+
+// Four scalar multiplications in lockstep, one per AVX2 lane. Each k is split
+// with GLV into two ~128-bit halves, and each half is recoded into fixed 4-bit
+// signed odd digits, so every lane runs the same sequence: 4 doublings and two
+// mixed additions per window, with table reads that touch every entry.
+//
+// The split, the sign flips, the recoding and the digit selection are all
+// branch-free, so a lane's timing does not depend on its k. Jacobian arithmetic
+// here has no special cases: hitting P == +-Q in an addition (or a true result
+// of infinity) makes Z zero, which then stays zero. Such lanes are reported to
+// the caller, which redoes them: ec_mul_x4 with ec_mul, ecdh_shared_x4 with the
+// ladder. For a valid point and a key in [1, n-1] that takes knowing the key.
+
+#define EC_X4_TABLE   8    // P, 3P, ..., 15P
+#define EC_X4_WINDOWS 33   // 132 bits covers a GLV half plus the skew
+
+// --- LANE ARITHMETIC ---
+
+// dbl-2009-l, same steps as ec_jdouble
+static FE4_TARGET void ec_x4_double(fe4_t *x, fe4_t *y, fe4_t *z) {
+    fe4_t a, b, c, d, e, f, t;
+    ECIES_STAT_ADD(ECIES_STAT_POINT_DOUBLE, 4);
+    fe4_sqr(&a, x);                     // A = X^2
+    fe4_sqr(&b, y);                     // B = Y^2
+    fe4_sqr(&c, &b);                    // C = B^2
+
+    t = *x; fe4_add(&t, &b);            // D = 2 * ((X + B)^2 - A - C)
+    fe4_sqr(&d, &t);
+    fe4_negate(&t, &a, 1); fe4_add(&d, &t);
+    fe4_negate(&t, &c, 1); fe4_add(&d, &t);
+    fe4_mul_int(&d, 2);
+    fe4_normalize_weak(&d);
+
+    e = a; fe4_mul_int(&e, 3);          // E = 3A
+    fe4_sqr(&f, &e);                    // F = E^2
+
+    fe4_mul(z, y, z);                   // Z3 = 2 * Y * Z
+    fe4_mul_int(z, 2);
+    fe4_normalize_weak(z);
+
+    fe4_negate(&t, &d, 1);              // X3 = F - 2D
+    fe4_mul_int(&t, 2);
+    *x = f; fe4_add(x, &t);
+    fe4_normalize_weak(x);
+
+    fe4_negate(&t, x, 1);               // Y3 = E * (D - X3) - 8C
+    fe4_add(&t, &d);
+    fe4_mul(y, &e, &t);
+    fe4_negate(&t, &c, 1);
+    fe4_mul_int(&t, 8);
+    fe4_add(y, &t);
+    fe4_normalize_weak(y);
+}
+
+// madd-2004-hmv, same steps as ec_jadd_mixed
+static FE4_TARGET void ec_x4_add_mixed(fe4_t *x, fe4_t *y, fe4_t *z, const fe4_t *qx, const fe4_t *qy) {
+    fe4_t z2, z3, u2, s2, h, r, t, h2, h3, v;
+    ECIES_STAT_ADD(ECIES_STAT_POINT_ADD, 4);
+    fe4_sqr(&z2, z);
+    fe4_mul(&z3, &z2, z);
+    fe4_mul(&u2, qx, &z2);              // U2 = x2 * Z1^2
+    fe4_mul(&s2, qy, &z3);              // S2 = y2 * Z1^3
+    fe4_negate(&h, x, 1); fe4_add(&h, &u2);     // H = U2 - X1
+    fe4_negate(&r, y, 1); fe4_add(&r, &s2);     // R = S2 - Y1
+
+    fe4_sqr(&h2, &h);
+    fe4_mul(&h3, &h2, &h);
+    fe4_mul(&v, x, &h2);                // V = X1 * H^2
+
+    fe4_mul(z, z, &h);                  // Z3 = Z1 * H
+    fe4_mul(&t, y, &h3);                // Y1 * H^3
+
+    fe4_sqr(x, &r);                     // X3 = R^2 - H^3 - 2V
+    fe4_negate(&h3, &h3, 1); fe4_add(x, &h3);
+    fe4_negate(&h2, &v, 1); fe4_mul_int(&h2, 2); fe4_add(x, &h2);
+    fe4_normalize_weak(x);
+
+    fe4_negate(&h2, x, 1);              // Y3 = R * (V - X3) - Y1 * H^3
+    fe4_add(&h2, &v);
+    fe4_mul(y, &r, &h2);
+    fe4_negate(&t, &t, 1);
+    fe4_add(y, &t);
+    fe4_normalize_weak(y);
+}
+
+// Per-lane table read: entry idx[j] of lane j, negated where neg[j] is all-ones
+static FE4_TARGET void ec_x4_lookup(fe4_t *rx, fe4_t *ry, const fe4_t *tx, const fe4_t *ty, __m256i idx, __m256i neg) {
+    fe4_t ny;
+    memset(rx, 0, sizeof(*rx));
+    memset(ry, 0, sizeof(*ry));
+    for (int e = 0; e < EC_X4_TABLE; e++) {
+        __m256i m = _mm256_cmpeq_epi64(idx, _mm256_set1_epi64x(e));
+        fe4_cmov(rx, &tx[e], m);
+        fe4_cmov(ry, &ty[e], m);
+    }
+    fe4_negate(&ny, ry, 1);
+    fe4_cmov(ry, &ny, neg);
+}
+
+// Table index and sign mask for digit i of every lane; flip[j] negates the whole lane
+static FE4_TARGET void ec_x4_digit(__m256i *idx, __m256i *neg, const int digits[4][EC_X4_WINDOWS], const int flip[4], int i) {
+    long long ix[4], ng[4];
+    for (int j = 0; j < 4; j++) {
+        int d = digits[j][i];
+        int s = d >> 31;                    // All ones for a negative digit
+        int a = (d ^ s) - s;                // |d|, odd
+        ix[j] = (a - 1) >> 1;
+        ng[j] = -(long long)((s & 1) ^ flip[j]);
+    }
+    *idx = _mm256_set_epi64x(ix[3], ix[2], ix[1], ix[0]);
+    *neg = _mm256_set_epi64x(ng[3], ng[2], ng[1], ng[0]);
+}
+
+// --- SCALAR RECODING ---
+
+// k = -k mod n where flip is 1, without branching on it
+static void ec_x4_cneg(bigint256_t *k, int flip) {
+    bigint256_t neg;
+    bigint_neg_mod_n(&neg, k);
+    limb_t mask = (limb_t)0 - (limb_t)flip;
+    for (int i = 0; i < NUM_LIMBS; i++) k->limbs[i] ^= (k->limbs[i] ^ neg.limbs[i]) & mask;
+}
+
+// Fixed-width signed odd digits: s = sum digits[i] * 16^i with every digit odd in [-15, 15].
+// Only odd s can be written this way, so an even s is recoded as s + 1 and *skew = 1
+// (the caller subtracts one P at the end). s must be below 2^129.
+static void ec_x4_recode(int digits[EC_X4_WINDOWS], int *skew, const bigint256_t *k) {
+    uint64_t s0 = k->limbs[0], s1 = k->limbs[1], s2 = k->limbs[2];
+
+    *skew = (int)(1 - (s0 & 1));
+    s0 += (uint64_t)*skew;                  // s0 was even, so no carry
+
+    for (int i = 0; i < EC_X4_WINDOWS - 1; i++) {
+        int d = (int)(s0 & 31) - 16;
+        digits[i] = d;
+
+        // s = (s - d) / 16, as a three-limb subtract with d sign-extended
+        uint64_t dl = (uint64_t)(int64_t)d, dh = (uint64_t)((int64_t)d >> 63);
+        uint64_t b0 = s0 < dl;
+        s0 -= dl;
+        dlimb_t t = (dlimb_t)s1 - dh - b0;
+        s1 = (uint64_t)t;
+        s2 = s2 - dh - (uint64_t)((t >> 64) & 1);
+
+        s0 = (s0 >> 4) | (s1 << 60);
+        s1 = (s1 >> 4) | (s2 << 60);
+        s2 >>= 4;
+    }
+    digits[EC_X4_WINDOWS - 1] = (int)s0;   // Odd and at most 15 for s < 2^129
+}
+
+// --- DRIVER ---
+
+// res[j] = k[j] * p[j], except lanes with redo[j] set, which the caller must redo
+static FE4_TARGET void ec_x4_core(ec_point_t res[4], int redo[4], const bigint256_t k[4], const ec_point_t p[4]) {
+    ec_jpoint_t jac[4 * EC_X4_TABLE], d, out[4];
+    ec_apoint_t tab[4 * EC_X4_TABLE], lam, base;
+    int digits1[4][EC_X4_WINDOWS], digits2[4][EC_X4_WINDOWS];
+    int flip1[4], flip2[4], skew1[4], skew2[4];
+
+    for (int j = 0; j < 4; j++) {
+        bigint256_t k1, k2;
+
+        // Infinity lanes run on G as a placeholder and are reported for redoing
+        redo[j] = p[j].is_infinity;
+        if (redo[j]) {
+            ec_point_t g;
+            ec_init_g(&g);
+            ec_apoint_set(&base, &g);
+        } else {
+            ec_apoint_set(&base, &p[j]);
+        }
+
+        // k = k1 + k2 * lambda; a high half stands for -(n - half)
+        ec_scalar_split_lambda(&k1, &k2, &k[j]);
+        flip1[j] = ec_scalar_is_high(&k1);
+        flip2[j] = ec_scalar_is_high(&k2);
+        ec_x4_cneg(&k1, flip1[j]);
+        ec_x4_cneg(&k2, flip2[j]);
+        ec_x4_recode(digits1[j], &skew1[j], &k1);
+        ec_x4_recode(digits2[j], &skew2[j], &k2);
+
+        ec_jacobian_from_affine(&jac[j * EC_X4_TABLE], &base);
+        ec_jdouble(&d, &jac[j * EC_X4_TABLE]);
+        for (int e = 1; e < EC_X4_TABLE; e++) ec_jadd(&jac[j * EC_X4_TABLE + e], &jac[j * EC_X4_TABLE + e - 1], &d);
+    }
+
+    // Odd multiples of all four points with a single inversion
+    ec_batch_to_affine(tab, jac, 4 * EC_X4_TABLE);
+
+    // Transpose into lanes: entry e of the P table and of the lambda * P table
+    fe4_t t1x[EC_X4_TABLE], t1y[EC_X4_TABLE], t2x[EC_X4_TABLE], t2y[EC_X4_TABLE];
+    for (int e = 0; e < EC_X4_TABLE; e++) {
+        fe_t lx[4], ly[4], mx[4];
+        for (int j = 0; j < 4; j++) {
+            const ec_apoint_t *a = &tab[j * EC_X4_TABLE + e];
+            lx[j] = a->x;
+            ly[j] = a->y;
+            ec_apoint_mul_lambda(&lam, a);
+            mx[j] = lam.x;
+        }
+        fe4_set(&t1x[e], lx);
+        fe4_set(&t1y[e], ly);
+        fe4_set(&t2x[e], mx);
+        t2y[e] = t1y[e];
+    }
+
+    fe4_t x, y, z, qx, qy;
+    __m256i idx, neg;
+
+    // Top window: start from the P-table entry directly (Z = 1)
+    ec_x4_digit(&idx, &neg, (const int (*)[EC_X4_WINDOWS])digits1, flip1, EC_X4_WINDOWS - 1);
+    ec_x4_lookup(&x, &y, t1x, t1y, idx, neg);
+    fe4_set_int(&z, 1);
+    ec_x4_digit(&idx, &neg, (const int (*)[EC_X4_WINDOWS])digits2, flip2, EC_X4_WINDOWS - 1);
+    ec_x4_lookup(&qx, &qy, t2x, t2y, idx, neg);
+    ec_x4_add_mixed(&x, &y, &z, &qx, &qy);
+
+    for (int i = EC_X4_WINDOWS - 2; i >= 0; i--) {
+        for (int s = 0; s < 4; s++) ec_x4_double(&x, &y, &z);
+        ec_x4_digit(&idx, &neg, (const int (*)[EC_X4_WINDOWS])digits1, flip1, i);
+        ec_x4_lookup(&qx, &qy, t1x, t1y, idx, neg);
+        ec_x4_add_mixed(&x, &y, &z, &qx, &qy);
+        ec_x4_digit(&idx, &neg, (const int (*)[EC_X4_WINDOWS])digits2, flip2, i);
+        ec_x4_lookup(&qx, &qy, t2x, t2y, idx, neg);
+        ec_x4_add_mixed(&x, &y, &z, &qx, &qy);
+    }
+
+    // Undo the skews: subtract the (signed) base point where a half was even
+    const int *skews[2] = { skew1, skew2 };
+    const int *flips[2] = { flip1, flip2 };
+    const fe4_t *tx[2] = { t1x, t2x }, *ty[2] = { t1y, t2y };
+    for (int h = 0; h < 2; h++) {
+        fe4_t sx = x, sy = y, sz = z;
+        const int *sk = skews[h], *fl = flips[h];
+        idx = _mm256_setzero_si256();
+        neg = _mm256_set_epi64x(-(long long)!fl[3], -(long long)!fl[2], -(long long)!fl[1], -(long long)!fl[0]);
+        ec_x4_lookup(&qx, &qy, tx[h], ty[h], idx, neg);
+        ec_x4_add_mixed(&sx, &sy, &sz, &qx, &qy);
+
+        __m256i m = _mm256_set_epi64x(-(long long)sk[3], -(long long)sk[2], -(long long)sk[1], -(long long)sk[0]);
+        fe4_cmov(&x, &sx, m);
+        fe4_cmov(&y, &sy, m);
+        fe4_cmov(&z, &sz, m);
+    }
+
+    fe_t ox[4], oy[4], oz[4];
+    fe4_get(ox, &x);
+    fe4_get(oy, &y);
+    fe4_get(oz, &z);
+    for (int j = 0; j < 4; j++) {
+        out[j].x = ox[j];
+        out[j].y = oy[j];
+        out[j].z = oz[j];
+        redo[j] |= fe_normalizes_to_zero(&oz[j]);
+        out[j].is_infinity = redo[j];
+    }
+
+    ec_apoint_t aff[4];
+    ec_batch_to_affine(aff, out, 4);
+    for (int j = 0; j < 4; j++) ec_apoint_get(&res[j], &aff[j]);
+}
+
+#endif // FE4_AVAILABLE
+
+void ec_mul_x4(ec_point_t res[4], const bigint256_t k[4], const ec_point_t p[4]) {
+#ifdef FE4_AVAILABLE
+    if (cpu_has(CPU_AVX2)) {
+        int redo[4];
+        ec_x4_core(res, redo, k, p);
+        // Result is infinity, an addition hit P == +-Q, or P itself is infinity
+        for (int j = 0; j < 4; j++) if (redo[j]) ec_mul(&res[j], &k[j], &p[j]);
+        return;
+    }
+#endif
+    for (int j = 0; j < 4; j++) ec_mul(&res[j], &k[j], &p[j]);
+}
+
+int ecdh_shared_x4(uint8_t out[4][32], int ok[4], const bigint256_t *priv, const ec_point_t pub[4]) {
+    int all = 1;
+#ifdef FE4_AVAILABLE
+    if (cpu_has(CPU_AVX2)) {
+        bigint256_t k[4];
+        ec_point_t p[4], r[4];
+        int redo[4];
+        for (int j = 0; j < 4; j++) {
+            k[j] = *priv;
+            ok[j] = ec_is_on_curve(&pub[j]);   // Invalid points run on G and are discarded
+            if (ok[j]) p[j] = pub[j];
+            else ec_init_g(&p[j]);
+        }
+        ec_x4_core(r, redo, k, p);
+        for (int j = 0; j < 4; j++) {
+            if (!ok[j]) memset(out[j], 0, 32);
+            else if (redo[j]) ok[j] = ecdh_shared_x(out[j], priv, &pub[j]);
+            else bigint_get_bytes(out[j], &r[j].x);
+            all &= ok[j];
+        }
+        memset(k, 0, sizeof(k));
+        memset(r, 0, sizeof(r));
+        return all;
+    }
+#endif
+    for (int j = 0; j < 4; j++) {
+        ok[j] = ecdh_shared_x(out[j], priv, &pub[j]);
+        all &= ok[j];
+    }
+    return all;
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "ec.h"
+#include "ecies_stats.h"
+#include <string.h>
+
+// x-only Montgomery ladder on y^2 = x^3 + 7 in projective (X : Z) coordinates,
+// x = X / Z. Uses the Brier-Joye formulas for a = 0, b = 7. The ladder keeps
+// R1 - R0 = P, so every addition is a differential one against the fixed x(P).
+// Infinity is (1 : 0) and goes through both formulas unchanged, so the ladder
+// can start at R0 = O and run all 256 bits without a data-dependent start.
+
+// R0 = 2 * R0:
+//   X' = X^4 - 56 X Z^3
+//   Z' = 4 Z (X^3 + 7 Z^3)
+static void ecdh_xz_double(fe_t *x, fe_t *z) {
+    ECIES_STAT_INC(ECIES_STAT_POINT_DOUBLE);
+    fe_t xx, zz, xz, t, u;
+    fe_sqr(&xx, x);
+    fe_sqr(&zz, z);
+    fe_mul(&xz, x, z);
+
+    fe_mul(&t, &xz, &zz);               // X Z^3
+    fe_mul_int(&t, 56);
+    fe_negate(&t, &t, 56);
+    fe_sqr(x, &xx);
+    fe_add(x, &t);
+    fe_normalize_weak(x);
+
+    fe_mul(&t, &xz, &xx);               // X^3 Z
+    fe_sqr(&u, &zz);                    // Z^4
+    fe_mul_int(&u, 7);
+    fe_add(&t, &u);
+    fe_mul_int(&t, 4);
+    fe_normalize_weak(&t);
+    *z = t;
+}
+
+// R1 = R0 + R1, given x(R1 - R0) = xd:
+//   X' = (X0 X1)^2 - 28 Z0 Z1 (X0 Z1 + X1 Z0)
+//   Z' = xd (X0 Z1 - X1 Z0)^2
+static void ecdh_xz_diffadd(fe_t *x1, fe_t *z1, const fe_t *x0, const fe_t *z0, const fe_t *xd) {
+    ECIES_STAT_INC(ECIES_STAT_POINT_ADD);
+    fe_t a, b, c, d, t;
+    fe_mul(&a, x0, x1);
+    fe_mul(&b, z0, z1);
+    fe_mul(&c, x0, z1);
+    fe_mul(&d, x1, z0);
+
+    t = c;
+    fe_add(&t, &d);
+    fe_mul(&t, &t, &b);
+    fe_mul_int(&t, 28);
+    fe_negate(&t, &t, 28);
+    fe_sqr(x1, &a);
+    fe_add(x1, &t);
+    fe_normalize_weak(x1);
+
+    fe_negate(&d, &d, 1);
+    fe_add(&c, &d);
+    fe_sqr(&t, &c);
+    fe_mul(z1, &t, xd);
+}
+
+int ecdh_shared_x(uint8_t out32[32], const bigint256_t *priv, const ec_point_t *pub) {
+    memset(out32, 0, 32);
+    if (!ec_is_on_curve(pub)) return 0;
+
+    fe_t xd, x0, z0, x1, z1;
+    fe_set_bigint(&xd, &pub->x);
+    fe_set_int(&x0, 1);
+    fe_set_int(&z0, 0);
+    x1 = xd;
+    fe_set_int(&z1, 1);
+
+    // Regular ladder: one conditional swap, one addition and one doubling per bit
+    int swap = 0;
+    for (int i = 255; i >= 0; i--) {
+        int bit = (int)((priv->limbs[i / 64] >> (i % 64)) & 1);
+        fe_cswap(&x0, &x1, swap ^ bit);
+        fe_cswap(&z0, &z1, swap ^ bit);
+        swap = bit;
+
+        ecdh_xz_diffadd(&x1, &z1, &x0, &z0, &xd);
+        ecdh_xz_double(&x0, &z0);
+    }
+    fe_cswap(&x0, &x1, swap);
+    fe_cswap(&z0, &z1, swap);
+
+    // x = X / Z; Z = 0 means priv * pub is infinity
+    fe_normalize(&z0);
+    int ok = !fe_is_zero(&z0);
+    bigint256_t x;
+    fe_inv(&z0, &z0);
+    fe_mul(&x0, &x0, &z0);
+    fe_normalize(&x0);
+    fe_get_bigint(&x, &x0);
+    bigint_get_bytes(out32, &x);
+    if (!ok) memset(out32, 0, 32);
+    return ok;
+}
\ No newline at end of file
@@ -0,0 +1,542 @@
+#include "ecies.h"
+#include "kdf.h"
+#include "cpu.h"
+#include "field_x4.h"
+#include "ecies_stats.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/random.h>
+
+static const uint8_t ecies_kdf_info[] = "ECS1 AES-256-GCM";
+
+// --- KEYS ---
+
+int ecies_random(uint8_t *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = getrandom(buf, len, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return 1;
+}
+
+int ecies_keygen(bigint256_t *priv, ec_point_t *pub) {
+    // 512 random bits reduced mod n: the bias is below 2^-256
+    bigint512_t wide;
+    do {
+        if (!ecies_random((uint8_t *)wide.limbs, sizeof(wide.limbs))) return 0;
+        bigint_mod_n(priv, &wide);
+    } while ((priv->limbs[0] | priv->limbs[1] | priv->limbs[2] | priv->limbs[3]) == 0);
+
+    memset(&wide, 0, sizeof(wide));
+    ec_mul_g(pub, priv);
+    return 1;
+}
+
+// --- SIZES ---
+
+uint64_t ecies_ciphertext_size(uint64_t plain_len, size_t chunk_size) {
+    uint64_t records = plain_len == 0 ? 1 : (plain_len + chunk_size - 1) / chunk_size;
+    return ECIES_HEADER_SIZE + plain_len + records * ECIES_TAG_SIZE;
+}
+
+int ecies_plaintext_size(uint64_t *plain_len, uint64_t cipher_len, size_t chunk_size) {
+    if (cipher_len < ECIES_HEADER_SIZE + ECIES_TAG_SIZE) return 0;
+
+    uint64_t body = cipher_len - ECIES_HEADER_SIZE;
+    uint64_t record = chunk_size + ECIES_TAG_SIZE;
+    uint64_t full = body / record, rem = body % record;
+    if (rem != 0 && rem < ECIES_TAG_SIZE) return 0;
+
+    *plain_len = full * chunk_size + (rem != 0 ? rem - ECIES_TAG_SIZE : 0);
+    return 1;
+}
+
+// --- SETUP ---
+
+// KDF output: AES-256 key || nonce prefix
+#define ECIES_OKM_SIZE (32 + 7)
+
+static void ecies_stream_keys(ecies_stream_t *s, const uint8_t okm[ECIES_OKM_SIZE]) {
+    aes_ctx_t aes;
+    aes_setkey(&aes, okm, 32);
+    aes_gcm_init(&s->gcm, &aes);
+    memcpy(s->nonce_prefix, okm + 32, sizeof(s->nonce_prefix));
+    memset(&aes, 0, sizeof(aes));
+}
+
+// Both sides: key || nonce prefix = HKDF(salt = header, ikm = shared x)
+static int ecies_stream_setup(ecies_stream_t *s, const uint8_t shared_x[32], size_t chunk_size, int decrypt) {
+    uint8_t okm[ECIES_OKM_SIZE];
+
+    ECIES_STAGE_BEGIN(t);
+    hkdf_sha256(okm, sizeof(okm), s->header, ECIES_HEADER_SIZE, shared_x, 32, ecies_kdf_info, sizeof(ecies_kdf_info) - 1);
+    ecies_stream_keys(s, okm);
+    ECIES_STAGE_END(ECIES_STAGE_KDF, t);
+    memset(okm, 0, sizeof(okm));
+
+    s->chunk_index = 0;
+    s->chunk_size = chunk_size;
+    s->record_size = decrypt ? chunk_size + ECIES_TAG_SIZE : chunk_size;
+    s->buffered = 0;
+    s->decrypt = decrypt;
+    s->failed = 0;
+    s->buf = malloc(s->record_size);
+    return s->buf != NULL;
+}
+
+// x-coordinate of r * P through the prepared comb table (constant time in r)
+static int ecies_prepared_shared_x(uint8_t out[32], const bigint256_t *r, const ec_prepared_t *recipient) {
+    ec_point_t S;
+    ec_mul_prepared(&S, r, recipient);
+    int ok = !S.is_infinity;
+    if (ok) bigint_get_bytes(out, &S.x);
+    else memset(out, 0, 32);
+    memset(&S, 0, sizeof(S));
+    return ok;
+}
+
+// Shared by both encrypt entry points: the ECDH goes through the prepared
+// table when there is one, the ladder otherwise
+static int ecies_encrypt_start(ecies_stream_t *s, const ec_point_t *recipient, const ec_prepared_t *prepared,
+                               size_t chunk_size, uint8_t header[ECIES_HEADER_SIZE]) {
+    memset(s, 0, sizeof(*s));
+    if (chunk_size == 0) chunk_size = ECIES_CHUNK_DEFAULT;
+    if (chunk_size < ECIES_CHUNK_MIN || chunk_size > ECIES_CHUNK_MAX) return 0;
+
+    bigint256_t r;
+    ec_point_t R;
+    uint8_t shared_x[32];
+    ECIES_STAGE_BEGIN(t);
+    if (!ecies_keygen(&r, &R)) return 0;
+    ECIES_STAGE_END(ECIES_STAGE_KEYGEN, t);
+
+    ECIES_STAGE_BEGIN(t_ecdh);
+    int ok = prepared ? ecies_prepared_shared_x(shared_x, &r, prepared) : ecdh_shared_x(shared_x, &r, recipient);
+    ECIES_STAGE_END(ECIES_STAGE_ECDH, t_ecdh);
+    memset(&r, 0, sizeof(r));
+    if (!ok) return 0;
+
+    memcpy(s->header, ECIES_MAGIC, 4);
+    s->header[4] = (uint8_t)(chunk_size >> 24);
+    s->header[5] = (uint8_t)(chunk_size >> 16);
+    s->header[6] = (uint8_t)(chunk_size >> 8);
+    s->header[7] = (uint8_t)chunk_size;
+    ec_point_encode(s->header + 8, &R, 1);
+    memcpy(header, s->header, ECIES_HEADER_SIZE);
+
+    ok = ecies_stream_setup(s, shared_x, chunk_size, 0);
+    memset(shared_x, 0, sizeof(shared_x));
+    return ok;
+}
+
+int ecies_encrypt_init(ecies_stream_t *s, const ec_point_t *recipient, size_t chunk_size, uint8_t header[ECIES_HEADER_SIZE]) {
+    return ecies_encrypt_start(s, recipient, NULL, chunk_size, header);
+}
+
+int ecies_encrypt_init_prepared(ecies_stream_t *s, const ec_prepared_t *recipient, size_t chunk_size, uint8_t header[ECIES_HEADER_SIZE]) {
+    return ecies_encrypt_start(s, NULL, recipient, chunk_size, header);
+}
+
+// Magic and chunk size of a received header
+static int ecies_header_chunk(size_t *chunk_size, const uint8_t header[ECIES_HEADER_SIZE]) {
+    if (memcmp(header, ECIES_MAGIC, 4) != 0) return 0;
+    *chunk_size = ((size_t)header[4] << 24) | ((size_t)header[5] << 16) | ((size_t)header[6] << 8) | header[7];
+    return *chunk_size >= ECIES_CHUNK_MIN && *chunk_size <= ECIES_CHUNK_MAX;
+}
+
+int ecies_decrypt_init(ecies_stream_t *s, const bigint256_t *priv, const uint8_t header[ECIES_HEADER_SIZE]) {
+    size_t chunk_size;
+    memset(s, 0, sizeof(*s));
+    if (!ecies_header_chunk(&chunk_size, header)) return 0;
+
+    ec_point_t R;
+    uint8_t shared_x[32];
+    ECIES_STAGE_BEGIN(t);
+    if (!ec_point_decode(&R, header + 8, EC_POINT_COMPRESSED_SIZE)) return 0;
+    if (!ecdh_shared_x(shared_x, priv, &R)) return 0;
+    ECIES_STAGE_END(ECIES_STAGE_ECDH, t);
+
+    memcpy(s->header, header, ECIES_HEADER_SIZE);
+    int ok = ecies_stream_setup(s, shared_x, chunk_size, 1);
+    memset(shared_x, 0, sizeof(shared_x));
+    return ok;
+}
+
+void ecies_stream_free(ecies_stream_t *s) {
+    free(s->buf);
+    memset(s, 0, sizeof(*s));
+}
+
+// --- RECORDS ---
+
+// Seal or open one record from src into out (*written bytes). Returns 0, and
+// marks the stream failed, on an authentication failure or counter exhaustion.
+static int ecies_record(ecies_stream_t *s, const uint8_t *src, size_t len, int last, uint8_t *out, size_t *written) {
+    if (s->chunk_index == UINT32_MAX) {
+        s->failed = 1;
+        return 0;
+    }
+
+    uint8_t nonce[AES_GCM_IV_SIZE];
+    memcpy(nonce, s->nonce_prefix, sizeof(s->nonce_prefix));
+    nonce[7] = (uint8_t)(s->chunk_index >> 24);
+    nonce[8] = (uint8_t)(s->chunk_index >> 16);
+    nonce[9] = (uint8_t)(s->chunk_index >> 8);
+    nonce[10] = (uint8_t)s->chunk_index;
+    nonce[11] = (uint8_t)last;
+    s->chunk_index++;
+
+    ECIES_STAGE_BEGIN(t);
+    if (!s->decrypt) {
+        if (out != src) memmove(out, src, len);
+        aes_gcm_encrypt(&s->gcm, nonce, s->header, ECIES_HEADER_SIZE, out, len, out + len);
+        ECIES_STAGE_END(ECIES_STAGE_CIPHER, t);
+        *written = len + ECIES_TAG_SIZE;
+        return 1;
+    }
+
+    size_t clen = len - ECIES_TAG_SIZE;
+    uint8_t tag[ECIES_TAG_SIZE];
+    memcpy(tag, src + clen, ECIES_TAG_SIZE);   // out may overlap src
+    if (out != src) memmove(out, src, clen);
+    int ok = aes_gcm_decrypt(&s->gcm, nonce, s->header, ECIES_HEADER_SIZE, out, clen, tag);
+    ECIES_STAGE_END(ECIES_STAGE_CIPHER, t);
+    if (!ok) {
+        s->failed = 1;
+        return 0;
+    }
+    *written = clen;
+    return 1;
+}
+
+size_t ecies_update_bound(const ecies_stream_t *s, size_t len) {
+    size_t records = (s->buffered + len) / s->record_size + 1;
+    return records * (s->chunk_size + ECIES_TAG_SIZE);
+}
+
+// Shared by both directions. A full record is only processed once more input
+// follows it, since the last record is sealed differently. Records are taken
+// straight from `in` when nothing is buffered; only the held-back tail is copied.
+static int ecies_update(ecies_stream_t *s, const uint8_t *in, size_t len, uint8_t *out, size_t *out_len) {
+    size_t rec = s->record_size, written = 0;
+    *out_len = 0;
+    if (s->failed) return 0;
+
+    while (len > 0) {
+        size_t n;
+        if (s->buffered == 0 && len > rec) {
+            if (!ecies_record(s, in, rec, 0, out + written, &n)) break;
+            in += rec;
+            len -= rec;
+        } else if (s->buffered == rec) {
+            if (!ecies_record(s, s->buf, rec, 0, out + written, &n)) break;
+            s->buffered = 0;
+        } else {
+            size_t take = rec - s->buffered < len ? rec - s->buffered : len;
+            memcpy(s->buf + s->buffered, in, take);
+            s->buffered += take;
+            in += take;
+            len -= take;
+            continue;
+        }
+        written += n;
+    }
+
+    // Records sealed or opened before a failure still count
+    *out_len = written;
+    return !s->failed;
+}
+
+int ecies_encrypt_update(ecies_stream_t *s, const uint8_t *in, size_t len, uint8_t *out, size_t *out_len) {
+    if (s->decrypt) {
+        *out_len = 0;
+        return 0;
+    }
+    return ecies_update(s, in, len, out, out_len);
+}
+
+int ecies_encrypt_final(ecies_stream_t *s, uint8_t *out, size_t *out_len) {
+    *out_len = 0;
+    if (s->decrypt || s->failed) return 0;
+    int ok = ecies_record(s, s->buf, s->buffered, 1, out, out_len);
+    s->buffered = 0;
+    s->failed = 1;   // Nothing may follow the last record
+    return ok;
+}
+
+int ecies_decrypt_update(ecies_stream_t *s, const uint8_t *in, size_t len, uint8_t *out, size_t *out_len) {
+    if (!s->decrypt) {
+        *out_len = 0;
+        return 0;
+    }
+    return ecies_update(s, in, len, out, out_len);
+}
+
+int ecies_decrypt_final(ecies_stream_t *s, uint8_t *out, size_t *out_len) {
+    *out_len = 0;
+    if (!s->decrypt || s->failed || s->buffered < ECIES_TAG_SIZE) return 0;
+    int ok = ecies_record(s, s->buf, s->buffered, 1, out, out_len);
+    s->buffered = 0;
+    s->failed = 1;   // Nothing may follow the last record
+    return ok;
+}
+
+// --- BATCH DECRYPT ---
+
+// Shared x for m decoded points (failed decodes are infinity), good[j] = 0 on failure.
+// With AVX2 four points go through ecdh_shared_x4 at once; a lone leftover is
+// cheaper on the ladder. Without AVX2 every point takes the ladder. Either way
+// the static key only ever sees constant-time code.
+static void ecies_batch_ecdh(uint8_t (*shared)[32], int *good, const bigint256_t *priv, const ec_point_t *pts, size_t m) {
+    size_t j = 0;
+#ifdef FE4_AVAILABLE
+    if (cpu_has(CPU_AVX2)) {
+        for (; j + 1 < m; j += 4) {
+            size_t lanes = m - j < 4 ? m - j : 4;
+            ec_point_t p[4];
+            uint8_t out[4][32];
+            int ok[4];
+            // Spare lanes get G; undecodable points fail in their own lane
+            for (size_t l = 0; l < 4; l++) {
+                if (l < lanes) p[l] = pts[j + l];
+                else ec_init_g(&p[l]);
+            }
+            ecdh_shared_x4(out, ok, priv, p);
+            for (size_t l = 0; l < lanes; l++) {
+                good[j + l] = ok[l];
+                memcpy(shared[j + l], out[l], 32);
+            }
+            memset(out, 0, sizeof(out));
+        }
+    }
+#endif
+    // A failed point still needs defined bytes, since the batch HKDF hashes every lane
+    for (; j < m; j++) {
+        good[j] = !pts[j].is_infinity && ecdh_shared_x(shared[j], priv, &pts[j]);
+        if (!good[j]) memset(shared[j], 0, 32);
+    }
+}
+
+// Open every record of one message whose keys are already derived
+static int ecies_open_message(ecies_stream_t *s, const ecies_msg_t *msg, ecies_out_t *out) {
+    const uint8_t *p = msg->data + ECIES_HEADER_SIZE;
+    size_t left = msg->len - ECIES_HEADER_SIZE, rec = s->record_size, pos = 0, n;
+
+    // Every record but the last is full; the last may be full too (but never absent)
+    for (; left > rec; p += rec, left -= rec, pos += n) {
+        if (!ecies_record(s, p, rec, 0, out->data + pos, &n)) goto fail;
+    }
+    if (!ecies_record(s, p, left, 1, out->data + pos, &n)) goto fail;
+    out->len = pos + n;
+    out->ok = 1;
+    return 1;
+
+fail:
+    memset(out->data, 0, pos);   // Records before the failure authenticated, but the message did not
+    return 0;
+}
+
+// Decrypt up to ECIES_BATCH_GROUP messages on this thread, each step batched
+static void ecies_decrypt_group(const bigint256_t *priv, const ecies_msg_t *msgs, ecies_out_t *out, size_t n) {
+    uint8_t enc[ECIES_BATCH_GROUP][EC_POINT_COMPRESSED_SIZE];
+    uint8_t shared[ECIES_BATCH_GROUP][32], okm[ECIES_BATCH_GROUP][ECIES_OKM_SIZE];
+    const uint8_t *salt[ECIES_BATCH_GROUP], *ikm[ECIES_BATCH_GROUP];
+    size_t idx[ECIES_BATCH_GROUP], chunk[ECIES_BATCH_GROUP], m = 0;
+    ec_point_t pts[ECIES_BATCH_GROUP];
+    int good[ECIES_BATCH_GROUP];
+
+    // Framing checks; the survivors' R encodings go side by side for one batch decode
+    for (size_t i = 0; i < n; i++) {
+        uint64_t plain_len;
+        out[i].len = 0;
+        out[i].ok = 0;
+        if (msgs[i].len < ECIES_HEADER_SIZE + ECIES_TAG_SIZE || !ecies_header_chunk(&chunk[m], msgs[i].data) ||
+            !ecies_plaintext_size(&plain_len, msgs[i].len, chunk[m]))
+            continue;
+        memcpy(enc[m], msgs[i].data + 8, EC_POINT_COMPRESSED_SIZE);
+        salt[m] = msgs[i].data;
+        ikm[m] = shared[m];
+        idx[m++] = i;
+    }
+    if (m == 0) return;
+
+    ec_point_decode_batch(pts, enc[0], EC_POINT_COMPRESSED_SIZE, m);
+    ecies_batch_ecdh(shared, good, priv, pts, m);
+
+    // One HKDF pass for the group; its salts are the headers, as in ecies_stream_setup
+    if (!hkdf_sha256_batch_salts(okm[0], ECIES_OKM_SIZE, salt, ECIES_HEADER_SIZE, ikm, m, 32,
+                                 ecies_kdf_info, sizeof(ecies_kdf_info) - 1)) {
+        for (size_t j = 0; j < m; j++)
+            hkdf_sha256(okm[j], ECIES_OKM_SIZE, salt[j], ECIES_HEADER_SIZE, shared[j], 32, ecies_kdf_info, sizeof(ecies_kdf_info) - 1);
+    }
+
+    ecies_stream_t s;
+    memset(&s, 0, sizeof(s));
+    s.decrypt = 1;
+    for (size_t j = 0; j < m; j++) {
+        if (!good[j]) continue;
+        memcpy(s.header, salt[j], ECIES_HEADER_SIZE);
+        ecies_stream_keys(&s, okm[j]);
+        s.chunk_index = 0;
+        s.chunk_size = chunk[j];
+        s.record_size = chunk[j] + ECIES_TAG_SIZE;
+        s.failed = 0;
+        ecies_open_message(&s, &msgs[idx[j]], &out[idx[j]]);
+    }
+
+    memset(&s, 0, sizeof(s));
+    memset(shared, 0, sizeof(shared));
+    memset(okm, 0, sizeof(okm));
+}
+
+typedef struct {
+    const bigint256_t *priv;
+    const ecies_msg_t *msgs;
+    ecies_out_t *out;
+    size_t n;
+} ecies_batch_job_t;
+
+static void ecies_batch_chunk(void *arg, size_t index) {
+    const ecies_batch_job_t *job = arg;
+    size_t base = index * ECIES_BATCH_GROUP;
+    size_t cnt = job->n - base < ECIES_BATCH_GROUP ? job->n - base : ECIES_BATCH_GROUP;
+    ecies_decrypt_group(job->priv, job->msgs + base, job->out + base, cnt);
+}
+
+size_t ecies_decrypt_batch(const bigint256_t *priv, const ecies_msg_t *msgs, size_t n, ecies_out_t *out, threadpool_t *pool) {
+    ecies_batch_job_t job = { priv, msgs, out, n };
+    threadpool_parallel_for(pool, (n + ECIES_BATCH_GROUP - 1) / ECIES_BATCH_GROUP, ecies_batch_chunk, &job);
+
+    size_t ok = 0;
+    for (size_t i = 0; i < n; i++) ok += (size_t)out[i].ok;
+    return ok;
+}
+
+// --- DECRYPT SERVICE ---
+
+typedef struct {
+    ecies_msg_t msg;
+    ecies_out_t out;
+    ecies_done_fn done;
+    void *user;
+} ecies_request_t;
+
+struct ecies_service {
+    bigint256_t priv;
+    threadpool_t *pool;
+    pthread_mutex_t lock;
+    pthread_cond_t not_full;    // Submitters wait here while the queue is full
+    pthread_cond_t idle;        // ecies_service_wait waits here
+    ecies_request_t *queue;     // Ring of cap requests
+    size_t cap, head, count;
+    size_t in_flight;           // Queued or being decrypted
+    size_t drainers;            // Drain tasks queued or running on the pool
+    size_t max_drainers;
+};
+
+// Pool task: take up to a group of queued requests at a time until none are left
+static void ecies_service_drain(void *arg) {
+    ecies_service_t *svc = arg;
+    ecies_request_t req[ECIES_BATCH_GROUP];
+    ecies_msg_t msgs[ECIES_BATCH_GROUP];
+    ecies_out_t outs[ECIES_BATCH_GROUP];
+
+    pthread_mutex_lock(&svc->lock);
+    while (svc->count > 0) {
+        size_t m = svc->count < ECIES_BATCH_GROUP ? svc->count : ECIES_BATCH_GROUP;
+        for (size_t j = 0; j < m; j++) {
+            req[j] = svc->queue[svc->head];
+            svc->head = (svc->head + 1) % svc->cap;
+        }
+        svc->count -= m;
+        pthread_cond_broadcast(&svc->not_full);
+        pthread_mutex_unlock(&svc->lock);
+
+        for (size_t j = 0; j < m; j++) {
+            msgs[j] = req[j].msg;
+            outs[j] = req[j].out;
+        }
+        ecies_decrypt_group(&svc->priv, msgs, outs, m);
+        for (size_t j = 0; j < m; j++) req[j].done(req[j].user, &outs[j]);
+
+        pthread_mutex_lock(&svc->lock);
+        svc->in_flight -= m;
+        if (svc->in_flight == 0) pthread_cond_broadcast(&svc->idle);
+    }
+    if (--svc->drainers == 0) pthread_cond_broadcast(&svc->idle);
+    pthread_mutex_unlock(&svc->lock);
+}
+
+ecies_service_t *ecies_service_new(const bigint256_t *priv, threadpool_t *pool, size_t queue_cap) {
+    if (queue_cap == 0) queue_cap = ECIES_SERVICE_QUEUE_DEFAULT;
+
+    ecies_service_t *svc = calloc(1, sizeof(*svc));
+    if (!svc) return NULL;
+    svc->queue = calloc(queue_cap, sizeof(ecies_request_t));
+    if (!svc->queue) {
+        free(svc);
+        return NULL;
+    }
+    svc->priv = *priv;
+    svc->pool = pool;
+    svc->cap = queue_cap;
+
+    // Drain tasks run on workers only; without any they run inside submit
+    size_t workers = threadpool_size(pool) - 1;
+    svc->max_drainers = workers > 0 ? workers : 1;
+
+    pthread_mutex_init(&svc->lock, NULL);
+    pthread_cond_init(&svc->not_full, NULL);
+    pthread_cond_init(&svc->idle, NULL);
+    return svc;
+}
+
+int ecies_service_submit(ecies_service_t *svc, const uint8_t *msg, size_t len, uint8_t *out, ecies_done_fn done, void *user) {
+    pthread_mutex_lock(&svc->lock);
+    while (svc->count == svc->cap) pthread_cond_wait(&svc->not_full, &svc->lock);
+
+    ecies_request_t *req = &svc->queue[(svc->head + svc->count) % svc->cap];
+    req->msg.data = msg;
+    req->msg.len = len;
+    req->out.data = out;
+    req->out.len = 0;
+    req->out.ok = 0;
+    req->done = done;
+    req->user = user;
+    svc->count++;
+    svc->in_flight++;
+
+    // One drainer per group of backlog, up to one per worker, so a light load
+    // still gathers requests into groups and a heavy one spreads over every core
+    int spawn = svc->drainers < svc->max_drainers &&
+                (svc->drainers == 0 || svc->count > svc->drainers * ECIES_BATCH_GROUP);
+    if (spawn) svc->drainers++;
+    pthread_mutex_unlock(&svc->lock);
+
+    if (spawn && !threadpool_submit(svc->pool, ecies_service_drain, svc)) ecies_service_drain(svc);
+    return 1;
+}
+
+void ecies_service_wait(ecies_service_t *svc) {
+    pthread_mutex_lock(&svc->lock);
+    while (svc->in_flight > 0 || svc->drainers > 0) pthread_cond_wait(&svc->idle, &svc->lock);
+    pthread_mutex_unlock(&svc->lock);
+}
+
+void ecies_service_free(ecies_service_t *svc) {
+    if (!svc) return;
+    ecies_service_wait(svc);
+    pthread_mutex_destroy(&svc->lock);
+    pthread_cond_destroy(&svc->not_full);
+    pthread_cond_destroy(&svc->idle);
+    free(svc->queue);
+    memset(svc, 0, sizeof(*svc));
+    free(svc);
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "ecies_stats.h"
+#include <stddef.h>
+#include <string.h>
+
+static const char *const STAT_NAMES[ECIES_STAT_COUNT] = {
+    "fe_mul", "fe_sqr", "inv", "point_add", "point_double", "aes_block", "sha256_block",
+};
+
+static const char *const STAGE_NAMES[ECIES_STAGE_COUNT] = {
+    "keygen", "ecdh", "kdf", "cipher",
+};
+
+const char *ecies_stat_name(ecies_stat_t stat) {
+    return (unsigned)stat < ECIES_STAT_COUNT ? STAT_NAMES[stat] : "unknown";
+}
+
+const char *ecies_stage_name(ecies_stage_t stage) {
+    return (unsigned)stage < ECIES_STAGE_COUNT ? STAGE_NAMES[stage] : "unknown";
+}
+
+uint64_t ecies_stats_percentile(const ecies_stage_stats_t *stage, double pct) {
+    if (stage->count == 0) return 0;
+    uint64_t rank = (uint64_t)(pct / 100.0 * (double)stage->count + 0.999999);
+    if (rank < 1) rank = 1;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < ECIES_STATS_BUCKETS; i++) {
+        seen += stage->hist[i];
+        if (seen >= rank) return i + 1 < 64 ? (2ull << i) - 1 : UINT64_MAX;
+    }
+    return stage->max_ticks;
+}
+
+#ifdef ECIES_STATS
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define STATS_TSC 1
+#endif
+
+// --- REGISTRY ---
+// Every thread's counters hang off one list so snapshots can sum them.
+// When a thread exits its totals fold into `retired` and its block is freed.
+
+typedef struct stats_node {
+    ecies_stats_t stats;         // First, so a stats pointer is a node pointer
+    struct stats_node *next;
+} stats_node_t;
+
+_Thread_local ecies_stats_t *ecies_stats_tls;
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t stats_once = PTHREAD_ONCE_INIT;
+static pthread_key_t stats_key;
+static stats_node_t *stats_threads;
+static ecies_stats_t retired;
+static uint64_t origin_ticks, origin_ns;   // Calibrates ticks against the clock
+
+static uint64_t stats_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t ecies_stats_ticks(void) {
+#ifdef STATS_TSC
+    return __rdtsc();
+#else
+    return stats_now_ns();
+#endif
+}
+
+static uint64_t load(const uint64_t *p) {
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+}
+
+static void store(uint64_t *p, uint64_t v) {
+    __atomic_store_n(p, v, __ATOMIC_RELAXED);
+}
+
+// Every field of an ecies_stats_t except ticks_per_ns is a uint64_t counter
+#define STATS_WORDS (offsetof(ecies_stats_t, ticks_per_ns) / sizeof(uint64_t))
+
+// Word positions of each stage's max_ticks, which merge by max rather than sum
+#define STAGES_WORD (offsetof(ecies_stats_t, stages) / sizeof(uint64_t))
+#define STAGE_WORDS (sizeof(ecies_stage_stats_t) / sizeof(uint64_t))
+#define MAX_WORD (offsetof(ecies_stage_stats_t, max_ticks) / sizeof(uint64_t))
+
+static int stats_is_max_word(size_t i) {
+    return i >= STAGES_WORD && (i - STAGES_WORD) % STAGE_WORDS == MAX_WORD;
+}
+
+// Each word of src is loaded once, so a max raised concurrently never skews the sum
+static void stats_accumulate(ecies_stats_t *dst, const ecies_stats_t *src) {
+    uint64_t *d = (uint64_t *)dst;
+    const uint64_t *s = (const uint64_t *)src;
+    for (size_t i = 0; i < STATS_WORDS; i++) {
+        uint64_t v = load(&s[i]);
+        if (!stats_is_max_word(i)) d[i] += v;
+        else if (v > d[i]) d[i] = v;
+    }
+}
+
+static void stats_thread_exit(void *p) {
+    stats_node_t *node = p;
+    pthread_mutex_lock(&stats_lock);
+    for (stats_node_t **it = &stats_threads; *it; it = &(*it)->next) {
+        if (*it == node) {
+            *it = node->next;
+            break;
+        }
+    }
+    stats_accumulate(&retired, &node->stats);
+    pthread_mutex_unlock(&stats_lock);
+    free(node);
+}
+
+static void stats_init(void) {
+    pthread_key_create(&stats_key, stats_thread_exit);
+    origin_ns = stats_now_ns();
+    origin_ticks = ecies_stats_ticks();
+}
+
+ecies_stats_t *ecies_stats_register(void) {
+    pthread_once(&stats_once, stats_init);
+    stats_node_t *node = calloc(1, sizeof(*node));
+    if (!node) abort();
+
+    pthread_mutex_lock(&stats_lock);
+    node->next = stats_threads;
+    stats_threads = node;
+    pthread_mutex_unlock(&stats_lock);
+
+    pthread_setspecific(stats_key, node);
+    ecies_stats_tls = &node->stats;
+    return ecies_stats_tls;
+}
+
+void ecies_stats_stage(ecies_stage_t stage, uint64_t ticks) {
+    ecies_stage_stats_t *s = &ecies_stats_local()->stages[stage];
+    int bucket = ticks ? 63 - __builtin_clzll(ticks) : 0;
+    if (bucket >= ECIES_STATS_BUCKETS) bucket = ECIES_STATS_BUCKETS - 1;
+
+    store(&s->count, load(&s->count) + 1);
+    store(&s->total_ticks, load(&s->total_ticks) + ticks);
+    if (ticks > load(&s->max_ticks)) store(&s->max_ticks, ticks);
+    store(&s->hist[bucket], load(&s->hist[bucket]) + 1);
+}
+
+// --- SNAPSHOT ---
+
+void ecies_stats_snapshot(ecies_stats_t *out) {
+    pthread_once(&stats_once, stats_init);
+    memset(out, 0, sizeof(*out));
+
+    pthread_mutex_lock(&stats_lock);
+    stats_accumulate(out, &retired);
+    for (stats_node_t *n = stats_threads; n; n = n->next) stats_accumulate(out, &n->stats);
+    pthread_mutex_unlock(&stats_lock);
+
+#ifdef STATS_TSC
+    // Measure the TSC rate over everything since init (at least 10 ms)
+    uint64_t ns;
+    while ((ns = stats_now_ns()) - origin_ns < 10000000ull) {}
+    out->ticks_per_ns = (double)(ecies_stats_ticks() - origin_ticks) / (double)(ns - origin_ns);
+#else
+    out->ticks_per_ns = 1.0;
+#endif
+}
+
+void ecies_stats_reset(void) {
+    pthread_once(&stats_once, stats_init);
+    pthread_mutex_lock(&stats_lock);
+    memset(&retired, 0, sizeof(retired));
+    for (stats_node_t *n = stats_threads; n; n = n->next) {
+        uint64_t *w = (uint64_t *)&n->stats;
+        for (size_t i = 0; i < STATS_WORDS; i++) store(&w[i], 0);
+    }
+    pthread_mutex_unlock(&stats_lock);
+}
+
+#else
+
+void ecies_stats_snapshot(ecies_stats_t *out) {
+    memset(out, 0, sizeof(*out));
+}
+
+void ecies_stats_reset(void) {
+}
+
+#endif // ECIES_STATS
\ No newline at end of file
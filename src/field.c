@@ -0,0 +1,282 @@
+#include "field.h"
+#include "ecies_stats.h"
+
+// --- CONSTANTS ---
+#define FE_M 0xFFFFFFFFFFFFFULL        // 52-bit limb mask
+#define FE_R 0x1000003D10ULL           // 2^260 mod p (one limb position past the top)
+#define FE_K 0x1000003D1ULL            // 2^256 mod p
+
+// p in 5x52 form
+static const uint64_t FE_P[5] = {
+    0xFFFFEFFFFFC2FULL, 0xFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFULL, 0x0FFFFFFFFFFFFULL
+};
+
+// --- CONVERSION ---
+
+void fe_set_int(fe_t *r, uint64_t v) {
+    r->n[0] = v & FE_M;
+    r->n[1] = v >> 52;
+    r->n[2] = r->n[3] = r->n[4] = 0;
+}
+
+void fe_set_bigint(fe_t *r, const bigint256_t *a) {
+    const limb_t *l = a->limbs;
+    r->n[0] = l[0] & FE_M;
+    r->n[1] = ((l[0] >> 52) | (l[1] << 12)) & FE_M;
+    r->n[2] = ((l[1] >> 40) | (l[2] << 24)) & FE_M;
+    r->n[3] = ((l[2] >> 28) | (l[3] << 36)) & FE_M;
+    r->n[4] = l[3] >> 16;
+}
+
+void fe_get_bigint(bigint256_t *r, const fe_t *a) {
+    const uint64_t *n = a->n;
+    r->limbs[0] = n[0] | (n[1] << 52);
+    r->limbs[1] = (n[1] >> 12) | (n[2] << 40);
+    r->limbs[2] = (n[2] >> 24) | (n[3] << 28);
+    r->limbs[3] = (n[3] >> 36) | (n[4] << 16);
+}
+
+// --- REDUCTION ---
+
+void fe_normalize_weak(fe_t *r) {
+    uint64_t t0 = r->n[0], t1 = r->n[1], t2 = r->n[2], t3 = r->n[3], t4 = r->n[4];
+
+    // Fold everything above bit 256 back in, then propagate carries
+    uint64_t x = t4 >> 48; t4 &= FE_M >> 4;
+    t0 += x * FE_K;
+    t1 += t0 >> 52; t0 &= FE_M;
+    t2 += t1 >> 52; t1 &= FE_M;
+    t3 += t2 >> 52; t2 &= FE_M;
+    t4 += t3 >> 52; t3 &= FE_M;
+
+    r->n[0] = t0; r->n[1] = t1; r->n[2] = t2; r->n[3] = t3; r->n[4] = t4;
+}
+
+void fe_normalize(fe_t *r) {
+    uint64_t t0 = r->n[0], t1 = r->n[1], t2 = r->n[2], t3 = r->n[3], t4 = r->n[4];
+
+    uint64_t x = t4 >> 48; t4 &= FE_M >> 4;
+    t0 += x * FE_K;
+    t1 += t0 >> 52; t0 &= FE_M;
+    t2 += t1 >> 52; t1 &= FE_M; uint64_t m = t1;
+    t3 += t2 >> 52; t2 &= FE_M; m &= t2;
+    t4 += t3 >> 52; t3 &= FE_M; m &= t3;
+
+    // Now < 2p: one more conditional subtraction (as an add of 2^256 - p), without branches
+    x = (t4 >> 48) | ((t4 == (FE_M >> 4)) & (m == FE_M) & (t0 >= FE_P[0]));
+    t0 += x * FE_K;
+    t1 += t0 >> 52; t0 &= FE_M;
+    t2 += t1 >> 52; t1 &= FE_M;
+    t3 += t2 >> 52; t2 &= FE_M;
+    t4 += t3 >> 52; t3 &= FE_M;
+    t4 &= FE_M >> 4;
+
+    r->n[0] = t0; r->n[1] = t1; r->n[2] = t2; r->n[3] = t3; r->n[4] = t4;
+}
+
+int fe_normalizes_to_zero(const fe_t *a) {
+    fe_t t = *a;
+    fe_normalize(&t);
+    return fe_is_zero(&t);
+}
+
+// --- PREDICATES ---
+
+int fe_is_zero(const fe_t *a) {
+    return (a->n[0] | a->n[1] | a->n[2] | a->n[3] | a->n[4]) == 0;
+}
+
+int fe_is_odd(const fe_t *a) {
+    return a->n[0] & 1;
+}
+
+int fe_equal(const fe_t *a, const fe_t *b) {
+    return ((a->n[0] ^ b->n[0]) | (a->n[1] ^ b->n[1]) | (a->n[2] ^ b->n[2]) |
+            (a->n[3] ^ b->n[3]) | (a->n[4] ^ b->n[4])) == 0;
+}
+
+// --- ARITHMETIC ---
+
+void fe_add(fe_t *r, const fe_t *a) {
+    r->n[0] += a->n[0]; r->n[1] += a->n[1]; r->n[2] += a->n[2];
+    r->n[3] += a->n[3]; r->n[4] += a->n[4];
+}
+
+void fe_mul_int(fe_t *r, uint64_t k) {
+    r->n[0] *= k; r->n[1] *= k; r->n[2] *= k; r->n[3] *= k; r->n[4] *= k;
+}
+
+void fe_negate(fe_t *r, const fe_t *a, int m) {
+    // 2*(m+1)*p - a keeps every limb non-negative
+    uint64_t f = 2 * (uint64_t)(m + 1);
+    r->n[0] = FE_P[0] * f - a->n[0];
+    r->n[1] = FE_P[1] * f - a->n[1];
+    r->n[2] = FE_P[2] * f - a->n[2];
+    r->n[3] = FE_P[3] * f - a->n[3];
+    r->n[4] = FE_P[4] * f - a->n[4];
+}
+
+// Reduce a 10-limb (52-bit) product: limb i+5 sits at 2^260 * 2^(52i) = FE_R * 2^(52i)
+static inline void fe_reduce_wide(fe_t *r, const uint64_t t[10]) {
+    dlimb_t c;
+    c  = (dlimb_t)t[5] * FE_R + t[0]; r->n[0] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)t[6] * FE_R + t[1]; r->n[1] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)t[7] * FE_R + t[2]; r->n[2] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)t[8] * FE_R + t[3]; r->n[3] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)t[9] * FE_R + t[4]; r->n[4] = (uint64_t)c & (FE_M >> 4); c >>= 48;
+
+    // Whatever is left sits at 2^256: fold once more (small, lands in limbs 0/1)
+    c = c * FE_K + r->n[0];
+    r->n[0] = (uint64_t)c & FE_M;
+    r->n[1] += (uint64_t)(c >> 52);
+}
+
+void fe_mul(fe_t *r, const fe_t *a, const fe_t *b) {
+    const uint64_t a0 = a->n[0], a1 = a->n[1], a2 = a->n[2], a3 = a->n[3], a4 = a->n[4];
+    const uint64_t b0 = b->n[0], b1 = b->n[1], b2 = b->n[2], b3 = b->n[3], b4 = b->n[4];
+    uint64_t t[10];
+    dlimb_t c;
+
+    // Column-wise schoolbook product with carry into 52-bit limbs
+    c  = (dlimb_t)a0 * b0;
+    t[0] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a0 * b1 + (dlimb_t)a1 * b0;
+    t[1] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a0 * b2 + (dlimb_t)a1 * b1 + (dlimb_t)a2 * b0;
+    t[2] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a0 * b3 + (dlimb_t)a1 * b2 + (dlimb_t)a2 * b1 + (dlimb_t)a3 * b0;
+    t[3] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a0 * b4 + (dlimb_t)a1 * b3 + (dlimb_t)a2 * b2 + (dlimb_t)a3 * b1 + (dlimb_t)a4 * b0;
+    t[4] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a1 * b4 + (dlimb_t)a2 * b3 + (dlimb_t)a3 * b2 + (dlimb_t)a4 * b1;
+    t[5] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a2 * b4 + (dlimb_t)a3 * b3 + (dlimb_t)a4 * b2;
+    t[6] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a3 * b4 + (dlimb_t)a4 * b3;
+    t[7] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a4 * b4;
+    t[8] = (uint64_t)c & FE_M; c >>= 52;
+    t[9] = (uint64_t)c;
+
+    fe_reduce_wide(r, t);
+    ECIES_STAT_INC(ECIES_STAT_FE_MUL);
+}
+
+void fe_sqr(fe_t *r, const fe_t *a) {
+    const uint64_t a0 = a->n[0], a1 = a->n[1], a2 = a->n[2], a3 = a->n[3], a4 = a->n[4];
+    const uint64_t d0 = a0 * 2, d1 = a1 * 2, d2 = a2 * 2, d3 = a3 * 2;
+    uint64_t t[10];
+    dlimb_t c;
+
+    // Cross products appear twice: use the doubled limbs
+    c  = (dlimb_t)a0 * a0;
+    t[0] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)d0 * a1;
+    t[1] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)d0 * a2 + (dlimb_t)a1 * a1;
+    t[2] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)d0 * a3 + (dlimb_t)d1 * a2;
+    t[3] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)d0 * a4 + (dlimb_t)d1 * a3 + (dlimb_t)a2 * a2;
+    t[4] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)d1 * a4 + (dlimb_t)d2 * a3;
+    t[5] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)d2 * a4 + (dlimb_t)a3 * a3;
+    t[6] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)d3 * a4;
+    t[7] = (uint64_t)c & FE_M; c >>= 52;
+    c += (dlimb_t)a4 * a4;
+    t[8] = (uint64_t)c & FE_M; c >>= 52;
+    t[9] = (uint64_t)c;
+
+    fe_reduce_wide(r, t);
+    ECIES_STAT_INC(ECIES_STAT_FE_SQR);
+}
+
+void fe_inv(fe_t *r, const fe_t *a) {
+    fe_t t = *a;
+    bigint256_t b;
+    fe_normalize(&t);
+    fe_get_bigint(&b, &t);
+    bigint_inv_mod_p(&b, &b);
+    fe_set_bigint(r, &b);
+}
+
+// Square root via a^((p+1)/4), valid since p = 3 mod 4. The exponent's binary
+// form is runs of ones of lengths 223, 22 and 2 (with gaps), so build x^(2^k - 1)
+// for those run lengths and stitch them together: 253 squarings, 13 multiplies.
+int fe_sqrt(fe_t *r, const fe_t *a) {
+    fe_t x2, x3, x6, x9, x11, x22, x44, x88, x176, x220, x223, t;
+    fe_t check = *a;   // r may alias a
+    int j;
+
+    fe_sqr(&x2, a);
+    fe_mul(&x2, &x2, a);
+
+    fe_sqr(&x3, &x2);
+    fe_mul(&x3, &x3, a);
+
+    x6 = x3;
+    for (j = 0; j < 3; j++) fe_sqr(&x6, &x6);
+    fe_mul(&x6, &x6, &x3);
+
+    x9 = x6;
+    for (j = 0; j < 3; j++) fe_sqr(&x9, &x9);
+    fe_mul(&x9, &x9, &x3);
+
+    x11 = x9;
+    for (j = 0; j < 2; j++) fe_sqr(&x11, &x11);
+    fe_mul(&x11, &x11, &x2);
+
+    x22 = x11;
+    for (j = 0; j < 11; j++) fe_sqr(&x22, &x22);
+    fe_mul(&x22, &x22, &x11);
+
+    x44 = x22;
+    for (j = 0; j < 22; j++) fe_sqr(&x44, &x44);
+    fe_mul(&x44, &x44, &x22);
+
+    x88 = x44;
+    for (j = 0; j < 44; j++) fe_sqr(&x88, &x88);
+    fe_mul(&x88, &x88, &x44);
+
+    x176 = x88;
+    for (j = 0; j < 88; j++) fe_sqr(&x176, &x176);
+    fe_mul(&x176, &x176, &x88);
+
+    x220 = x176;
+    for (j = 0; j < 44; j++) fe_sqr(&x220, &x220);
+    fe_mul(&x220, &x220, &x44);
+
+    x223 = x220;
+    for (j = 0; j < 3; j++) fe_sqr(&x223, &x223);
+    fe_mul(&x223, &x223, &x3);
+
+    t = x223;
+    for (j = 0; j < 23; j++) fe_sqr(&t, &t);
+    fe_mul(&t, &t, &x22);
+    for (j = 0; j < 6; j++) fe_sqr(&t, &t);
+    fe_mul(&t, &t, &x2);
+    fe_sqr(&t, &t);
+    fe_sqr(r, &t);
+
+    // Only a quadratic residue squares back to a
+    fe_sqr(&t, r);
+    fe_normalize(&t);
+    fe_normalize(&check);
+    return fe_equal(&t, &check);
+}
+
+void fe_cmov(fe_t *r, const fe_t *a, int flag) {
+    uint64_t mask = (uint64_t)0 - (uint64_t)(flag != 0);
+    for (int i = 0; i < 5; i++) r->n[i] = (r->n[i] & ~mask) | (a->n[i] & mask);
+}
+
+void fe_cswap(fe_t *a, fe_t *b, int flag) {
+    uint64_t mask = (uint64_t)0 - (uint64_t)(flag != 0);
+    for (int i = 0; i < 5; i++) {
+        uint64_t t = (a->n[i] ^ b->n[i]) & mask;
+        a->n[i] ^= t;
+        b->n[i] ^= t;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "field_x4.h"
+#include "ecies_stats.h"
+
+#ifdef FE4_AVAILABLE
+
+// --- CONSTANTS ---
+#define FE4_M26 0x3FFFFFFULL   // 26-bit limb mask
+#define FE4_M22 0x3FFFFFULL    // Top limb holds bits 234..255
+#define FE4_R0  0x3D10ULL      // 2^260 mod p = 0x3D10 + 0x400 * 2^26
+#define FE4_K0  0x3D1ULL       // 2^256 mod p = 0x3D1 + 0x40 * 2^26
+
+// Limb loops must be fully unrolled so the limbs live in registers, not arrays
+#define FE4_UNROLL _Pragma("GCC unroll 20")
+
+// p in 10x26 form
+static const uint32_t FE4_P[10] = {
+    0x3FFFC2F, 0x3FFFFBF, 0x3FFFFFF, 0x3FFFFFF, 0x3FFFFFF,
+    0x3FFFFFF, 0x3FFFFFF, 0x3FFFFFF, 0x3FFFFFF, 0x3FFFFF
+};
+
+// --- CONVERSION ---
+
+FE4_TARGET void fe4_set(fe4_t *r, const fe_t a[4]) {
+    FE4_UNROLL for (int i = 0; i < 5; i++) {
+        r->n[2 * i] = _mm256_set_epi64x(
+            (long long)(a[3].n[i] & FE4_M26), (long long)(a[2].n[i] & FE4_M26),
+            (long long)(a[1].n[i] & FE4_M26), (long long)(a[0].n[i] & FE4_M26));
+        r->n[2 * i + 1] = _mm256_set_epi64x(
+            (long long)(a[3].n[i] >> 26), (long long)(a[2].n[i] >> 26),
+            (long long)(a[1].n[i] >> 26), (long long)(a[0].n[i] >> 26));
+    }
+}
+
+FE4_TARGET void fe4_get(fe_t r[4], const fe4_t *a) {
+    fe4_t t = *a;
+    uint64_t lo[4], hi[4];
+    fe4_normalize_weak(&t);
+    FE4_UNROLL for (int i = 0; i < 5; i++) {
+        _mm256_storeu_si256((__m256i *)lo, t.n[2 * i]);
+        _mm256_storeu_si256((__m256i *)hi, t.n[2 * i + 1]);
+        FE4_UNROLL for (int j = 0; j < 4; j++) r[j].n[i] = lo[j] + (hi[j] << 26);
+    }
+}
+
+FE4_TARGET void fe4_set_int(fe4_t *r, uint32_t v) {
+    r->n[0] = _mm256_set1_epi64x(v & FE4_M26);
+    r->n[1] = _mm256_set1_epi64x(v >> 26);
+    FE4_UNROLL for (int i = 2; i < 10; i++) r->n[i] = _mm256_setzero_si256();
+}
+
+// --- REDUCTION ---
+
+// One carry pass over 10 limbs, all limbs at once: each limb keeps 26 bits and
+// hands the rest up, and bits >= 2^256 (above 22 bits of the top limb) fold
+// back to the bottom. Shrinks limbs of up to 2^42 to 26 bits plus ~2^16, so
+// two passes reach magnitude 1 without a limb-by-limb carry chain.
+static FE4_TARGET inline void fe4_carry_pass(__m256i *r) {
+    const __m256i m26 = _mm256_set1_epi64x(FE4_M26);
+    const __m256i m22 = _mm256_set1_epi64x(FE4_M22);
+    const __m256i k0 = _mm256_set1_epi64x(FE4_K0);
+    __m256i c[10];
+
+    FE4_UNROLL for (int i = 0; i < 9; i++) c[i] = _mm256_srli_epi64(r[i], 26);
+    c[9] = _mm256_srli_epi64(r[9], 22);
+    FE4_UNROLL for (int i = 0; i < 9; i++) r[i] = _mm256_and_si256(r[i], m26);
+    r[9] = _mm256_and_si256(r[9], m22);
+
+    FE4_UNROLL for (int i = 1; i < 10; i++) r[i] = _mm256_add_epi64(r[i], c[i - 1]);
+    r[0] = _mm256_add_epi64(r[0], _mm256_mul_epu32(c[9], k0));
+    r[1] = _mm256_add_epi64(r[1], _mm256_slli_epi64(c[9], 6));
+}
+
+FE4_TARGET void fe4_normalize_weak(fe4_t *r) {
+    fe4_carry_pass(r->n);
+    fe4_carry_pass(r->n);
+}
+
+// Reduce 20 limbs (t[0..18] 26-bit, t[19] the spill off the top) to 10 of magnitude 1
+static FE4_TARGET inline void fe4_reduce_wide(fe4_t *r, const __m256i *t) {
+    const __m256i m26 = _mm256_set1_epi64x(FE4_M26);
+    const __m256i r0 = _mm256_set1_epi64x(FE4_R0);
+
+    // Limb i+10 sits at 2^260 * 2^(26i): fold as 0x3D10 into limb i and 0x400 into limb i+1
+    FE4_UNROLL for (int i = 0; i < 10; i++) r->n[i] = _mm256_add_epi64(t[i], _mm256_mul_epu32(t[i + 10], r0));
+    FE4_UNROLL for (int i = 0; i < 9; i++) r->n[i + 1] = _mm256_add_epi64(r->n[i + 1], _mm256_slli_epi64(t[i + 10], 10));
+
+    // t[19] * 0x400 lands at limb 10 and may exceed 32 bits: fold it in two 26-bit halves
+    __m256i u = _mm256_slli_epi64(t[19], 10);
+    r->n[0] = _mm256_add_epi64(r->n[0], _mm256_mul_epu32(_mm256_and_si256(u, m26), r0));
+    r->n[1] = _mm256_add_epi64(r->n[1], _mm256_mul_epu32(_mm256_srli_epi64(u, 26), r0));
+    r->n[1] = _mm256_add_epi64(r->n[1], _mm256_slli_epi64(u, 10));
+
+    fe4_carry_pass(r->n);
+    fe4_carry_pass(r->n);
+}
+
+// --- ARITHMETIC ---
+
+FE4_TARGET void fe4_add(fe4_t *r, const fe4_t *a) {
+    FE4_UNROLL for (int i = 0; i < 10; i++) r->n[i] = _mm256_add_epi64(r->n[i], a->n[i]);
+}
+
+FE4_TARGET void fe4_mul_int(fe4_t *r, uint32_t k) {
+    const __m256i kv = _mm256_set1_epi64x(k);
+    FE4_UNROLL for (int i = 0; i < 10; i++) r->n[i] = _mm256_mul_epu32(r->n[i], kv);
+}
+
+FE4_TARGET void fe4_negate(fe4_t *r, const fe4_t *a, int m) {
+    // 2*(m+1)*p - a keeps every limb non-negative
+    uint64_t f = 2 * (uint64_t)(m + 1);
+    FE4_UNROLL for (int i = 0; i < 10; i++) {
+        r->n[i] = _mm256_sub_epi64(_mm256_set1_epi64x((long long)(FE4_P[i] * f)), a->n[i]);
+    }
+}
+
+FE4_TARGET void fe4_mul(fe4_t *r, const fe4_t *a, const fe4_t *b) {
+    ECIES_STAT_ADD(ECIES_STAT_FE_MUL, 4);
+    const __m256i m26 = _mm256_set1_epi64x(FE4_M26);
+    __m256i t[20], c = _mm256_setzero_si256();
+
+    // Column-wise schoolbook (100 lane products, at most 10 per column < 2^62),
+    // carrying each column into 26 bits as soon as it is complete. Two partial
+    // sums per column keep the add chain short.
+    FE4_UNROLL for (int k = 0; k < 19; k++) {
+        const int lo = k < 10 ? 0 : k - 9, hi = k < 10 ? k : 9;
+        __m256i e = _mm256_setzero_si256();
+        FE4_UNROLL for (int i = lo; i + 1 <= hi; i += 2) {
+            c = _mm256_add_epi64(c, _mm256_mul_epu32(a->n[i], b->n[k - i]));
+            e = _mm256_add_epi64(e, _mm256_mul_epu32(a->n[i + 1], b->n[k - i - 1]));
+        }
+        if (((hi - lo) & 1) == 0) c = _mm256_add_epi64(c, _mm256_mul_epu32(a->n[hi], b->n[k - hi]));
+        c = _mm256_add_epi64(c, e);
+        t[k] = _mm256_and_si256(c, m26);
+        c = _mm256_srli_epi64(c, 26);
+    }
+    t[19] = c;
+
+    fe4_reduce_wide(r, t);
+}
+
+FE4_TARGET void fe4_sqr(fe4_t *r, const fe4_t *a) {
+    ECIES_STAT_ADD(ECIES_STAT_FE_SQR, 4);
+    const __m256i m26 = _mm256_set1_epi64x(FE4_M26);
+    __m256i t[20], d[10], c = _mm256_setzero_si256();
+    FE4_UNROLL for (int i = 0; i < 10; i++) d[i] = _mm256_add_epi64(a->n[i], a->n[i]);
+
+    // Cross products appear twice: use the doubled limbs (55 lane products)
+    FE4_UNROLL for (int k = 0; k < 19; k++) {
+        const int lo = k < 10 ? 0 : k - 9;
+        FE4_UNROLL for (int i = lo; 2 * i < k; i++) c = _mm256_add_epi64(c, _mm256_mul_epu32(d[i], a->n[k - i]));
+        if ((k & 1) == 0) c = _mm256_add_epi64(c, _mm256_mul_epu32(a->n[k / 2], a->n[k / 2]));
+        t[k] = _mm256_and_si256(c, m26);
+        c = _mm256_srli_epi64(c, 26);
+    }
+    t[19] = c;
+
+    fe4_reduce_wide(r, t);
+}
+
+FE4_TARGET void fe4_cmov(fe4_t *r, const fe4_t *a, __m256i mask) {
+    FE4_UNROLL for (int i = 0; i < 10; i++) r->n[i] = _mm256_blendv_epi8(r->n[i], a->n[i], mask);
+}
+
+FE4_TARGET void fe4_cswap(fe4_t *a, fe4_t *b, __m256i mask) {
+    FE4_UNROLL for (int i = 0; i < 10; i++) {
+        __m256i t = _mm256_and_si256(_mm256_xor_si256(a->n[i], b->n[i]), mask);
+        a->n[i] = _mm256_xor_si256(a->n[i], t);
+        b->n[i] = _mm256_xor_si256(b->n[i], t);
+    }
+}
+
+#endif // FE4_AVAILABLE
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include "kdf.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Secrets per batch pass; bounds the scratch buffers
+#define KDF_BATCH_CHUNK 64
+
+// --- HMAC-SHA256 ---
+
+void hmac_sha256_key_init(hmac_sha256_key_t *key, const uint8_t *k, size_t k_len) {
+    uint8_t block[64] = {0};
+
+    // Keys longer than a block are hashed first
+    if (k_len > 64) {
+        sha256_ctx_t ctx;
+        sha256_init(&ctx);
+        sha256_update(&ctx, k, k_len);
+        sha256_final(&ctx, block);
+    } else if (k_len > 0) {
+        memcpy(block, k, k_len);
+    }
+
+    for (int i = 0; i < 64; i++) block[i] ^= 0x36;
+    sha256_init(&key->inner);
+    sha256_update(&key->inner, block, 64);
+
+    for (int i = 0; i < 64; i++) block[i] ^= 0x36 ^ 0x5c;
+    sha256_init(&key->outer);
+    sha256_update(&key->outer, block, 64);
+}
+
+void hmac_sha256_init(hmac_sha256_ctx_t *ctx, const hmac_sha256_key_t *key) {
+    ctx->inner = key->inner;
+    ctx->key = key;
+}
+
+void hmac_sha256_update(hmac_sha256_ctx_t *ctx, const uint8_t *data, size_t len) {
+    sha256_update(&ctx->inner, data, len);
+}
+
+void hmac_sha256_final(hmac_sha256_ctx_t *ctx, uint8_t mac[32]) {
+    uint8_t ihash[32];
+    sha256_final(&ctx->inner, ihash);
+
+    sha256_ctx_t outer = ctx->key->outer;
+    sha256_update(&outer, ihash, 32);
+    sha256_final(&outer, mac);
+}
+
+void hmac_sha256(uint8_t mac[32], const hmac_sha256_key_t *key, const uint8_t *data, size_t len) {
+    hmac_sha256_ctx_t ctx;
+    hmac_sha256_init(&ctx, key);
+    hmac_sha256_update(&ctx, data, len);
+    hmac_sha256_final(&ctx, mac);
+}
+
+// --- HKDF ---
+
+void hkdf_sha256_extract(uint8_t prk[32], const hmac_sha256_key_t *salt, const uint8_t *ikm, size_t ikm_len) {
+    hmac_sha256(prk, salt, ikm, ikm_len);
+}
+
+int hkdf_sha256_expand(uint8_t *okm, size_t okm_len, const uint8_t prk[32], const uint8_t *info, size_t info_len) {
+    if (okm_len > HKDF_SHA256_MAX_OKM) return 0;
+
+    // One prepared PRK key serves every T(i)
+    hmac_sha256_key_t key;
+    hmac_sha256_key_init(&key, prk, 32);
+
+    uint8_t t[32];
+    for (uint8_t i = 1; okm_len > 0; i++) {
+        hmac_sha256_ctx_t ctx;
+        hmac_sha256_init(&ctx, &key);
+        if (i > 1) hmac_sha256_update(&ctx, t, 32);
+        hmac_sha256_update(&ctx, info, info_len);
+        hmac_sha256_update(&ctx, &i, 1);
+        hmac_sha256_final(&ctx, t);
+
+        size_t n = okm_len < 32 ? okm_len : 32;
+        memcpy(okm, t, n);
+        okm += n;
+        okm_len -= n;
+    }
+    return 1;
+}
+
+int hkdf_sha256(uint8_t *okm, size_t okm_len, const uint8_t *salt, size_t salt_len,
+                const uint8_t *ikm, size_t ikm_len, const uint8_t *info, size_t info_len) {
+    hmac_sha256_key_t salt_key;
+    uint8_t prk[32];
+    hmac_sha256_key_init(&salt_key, salt, salt_len);
+    hkdf_sha256_extract(prk, &salt_key, ikm, ikm_len);
+    return hkdf_sha256_expand(okm, okm_len, prk, info, info_len);
+}
+
+// HMAC over equal-length messages, each under its own key of key_len <= 64 bytes:
+// SHA256(K^opad || SHA256(K^ipad || msg)), both layers batched
+static void hkdf_batch_hmac(uint8_t (*mac)[32], const uint8_t *const *keys, size_t key_len, const uint8_t *const *msg,
+                            size_t n, size_t msg_len, uint8_t *scratch, const uint8_t **ptrs) {
+    size_t inner_len = 64 + msg_len;
+    for (size_t j = 0; j < n; j++) {
+        uint8_t *m = scratch + j * inner_len;
+        memset(m, 0x36, 64);
+        for (size_t i = 0; i < key_len; i++) m[i] ^= keys[j][i];
+        memcpy(m + 64, msg[j], msg_len);
+        ptrs[j] = m;
+    }
+    sha256_batch(mac, NULL, ptrs, n, inner_len);
+
+    for (size_t j = 0; j < n; j++) {
+        uint8_t *m = scratch + j * 96;
+        memset(m, 0x5c, 64);
+        for (size_t i = 0; i < key_len; i++) m[i] ^= keys[j][i];
+        memcpy(m + 64, mac[j], 32);
+        ptrs[j] = m;
+    }
+    sha256_batch(mac, NULL, ptrs, n, 96);
+}
+
+// Shared driver: extract under one prepared salt, or under salts[i] when salt is NULL
+static int hkdf_batch(uint8_t *okm, size_t okm_len, const hmac_sha256_key_t *salt, const uint8_t *const *salts,
+                      size_t salt_len, const uint8_t *const *ikm, size_t n, size_t ikm_len, const uint8_t *info, size_t info_len) {
+    if (okm_len > HKDF_SHA256_MAX_OKM) return 0;
+
+    // T(i) input per secret: T(i-1) || info || i; extract may also hash ikm behind a pad
+    size_t msg_max = 32 + info_len + 1;
+    size_t inner_max = 64 + (msg_max > 32 ? msg_max : 32);
+    if (!salt && 64 + ikm_len > inner_max) inner_max = 64 + ikm_len;
+    uint8_t *scratch = malloc(KDF_BATCH_CHUNK * (inner_max + msg_max));
+    if (!scratch) return 0;
+    uint8_t *msgs = scratch + KDF_BATCH_CHUNK * inner_max;
+
+    uint8_t prk[KDF_BATCH_CHUNK][32], t[KDF_BATCH_CHUNK][32], tmp[KDF_BATCH_CHUNK][32];
+    const uint8_t *ptrs[KDF_BATCH_CHUNK], *mp[KDF_BATCH_CHUNK], *kp[KDF_BATCH_CHUNK];
+
+    for (size_t base = 0; base < n; base += KDF_BATCH_CHUNK) {
+        size_t cnt = n - base < KDF_BATCH_CHUNK ? n - base : KDF_BATCH_CHUNK;
+
+        if (salt) {
+            // Extract: the salt's pad midstates are shared by every secret
+            sha256_batch(tmp, &salt->inner, ikm + base, cnt, ikm_len);
+            for (size_t j = 0; j < cnt; j++) ptrs[j] = tmp[j];
+            sha256_batch(prk, &salt->outer, ptrs, cnt, 32);
+        } else {
+            hkdf_batch_hmac(prk, salts + base, salt_len, ikm + base, cnt, ikm_len, scratch, ptrs);
+        }
+        for (size_t j = 0; j < cnt; j++) kp[j] = prk[j];
+
+        // Expand: every secret's T(i) has the same length, so each round batches
+        size_t done = 0;
+        for (uint8_t i = 1; done < okm_len; i++) {
+            size_t msg_len = (i > 1 ? 32 : 0) + info_len + 1;
+            for (size_t j = 0; j < cnt; j++) {
+                uint8_t *m = msgs + j * msg_max;
+                if (i > 1) memcpy(m, t[j], 32);
+                if (info_len > 0) memcpy(m + (i > 1 ? 32 : 0), info, info_len);
+                m[msg_len - 1] = i;
+                mp[j] = m;
+            }
+            hkdf_batch_hmac(t, kp, 32, mp, cnt, msg_len, scratch, ptrs);
+
+            size_t take = okm_len - done < 32 ? okm_len - done : 32;
+            for (size_t j = 0; j < cnt; j++) memcpy(okm + (base + j) * okm_len + done, t[j], take);
+            done += take;
+        }
+    }
+
+    free(scratch);
+    return 1;
+}
+
+int hkdf_sha256_batch(uint8_t *okm, size_t okm_len, const hmac_sha256_key_t *salt,
+                      const uint8_t *const *ikm, size_t n, size_t ikm_len, const uint8_t *info, size_t info_len) {
+    return hkdf_batch(okm, okm_len, salt, NULL, 0, ikm, n, ikm_len, info, info_len);
+}
+
+int hkdf_sha256_batch_salts(uint8_t *okm, size_t okm_len, const uint8_t *const *salt, size_t salt_len,
+                            const uint8_t *const *ikm, size_t n, size_t ikm_len, const uint8_t *info, size_t info_len) {
+    if (salt_len > 64) return 0;
+    return hkdf_batch(okm, okm_len, NULL, salt, salt_len, ikm, n, ikm_len, info, info_len);
+}
+
+// --- X9.63 ---
+
+void x963_kdf_sha256(uint8_t *out, size_t out_len, const uint8_t *z, size_t z_len, const uint8_t *shared_info, size_t info_len) {
+    // Z is absorbed once; each counter block continues from that state
+    sha256_ctx_t zctx;
+    sha256_init(&zctx);
+    sha256_update(&zctx, z, z_len);
+
+    uint8_t block[32];
+    for (uint32_t counter = 1; out_len > 0; counter++) {
+        uint8_t c[4] = { (uint8_t)(counter >> 24), (uint8_t)(counter >> 16), (uint8_t)(counter >> 8), (uint8_t)counter };
+        sha256_ctx_t ctx = zctx;
+        sha256_update(&ctx, c, 4);
+        sha256_update(&ctx, shared_info, info_len);
+        sha256_final(&ctx, block);
+
+        size_t n = out_len < 32 ? out_len : 32;
+        memcpy(out, block, n);
+        out += n;
+        out_len -= n;
+    }
+}
\ No newline at end of file
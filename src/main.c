@@ -2,20 +2,17 @@
 #include <string.h>
 #include "bigint.h"
 #include "ec.h"
-#include "sha256.h"
+#include "kdf.h"
 #include "aes.h"
 
 int main() {
     printf("=== ECIES Full Encryption Demo ===\n");
 
-    ec_point_t G;
-    ec_init_g(&G);
-
     // --- SETUP: BOB'S STATIC KEY ---
     bigint256_t bob_priv;
     bigint_set_hex(&bob_priv, "B0B5ECA123456789B0B5ECA123456789B0B5ECA123456789B0B5ECA123456789"); 
     ec_point_t bob_pub;
-    ec_mul(&bob_pub, &bob_priv, &G);
+    ec_mul_g(&bob_pub, &bob_priv);
     printf("[Setup] Bob's Public Key is ready.\n");
 
     // ALICE: SENDER
@@ -26,28 +23,25 @@ int main() {
     bigint256_t alice_priv;
     bigint_set_hex(&alice_priv, "A11CECA123456789A11CECA123456789A11CECA123456789A11CECA123456789");
     ec_point_t R; // Public Ephemeral Key
-    ec_mul(&R, &alice_priv, &G);
+    ec_mul_g(&R, &alice_priv);
 
-    // 2. Derive Shared Secret S
-    ec_point_t S_alice;
-    ec_mul(&S_alice, &alice_priv, &bob_pub);
+    // R travels compressed: 33 bytes instead of 64
+    uint8_t R_wire[EC_POINT_COMPRESSED_SIZE];
+    ec_point_encode(R_wire, &R, 1);
 
-    // 3. Derive AES Key (Hash S.x)
+    // 2. Derive Shared Secret S.x
     uint8_t shared_bytes[32];
-    for(int i=0; i<4; i++) {
-        uint64_t limb = S_alice.x.limbs[3-i];
-        for(int j=0; j<8; j++) shared_bytes[i*8 + j] = (limb >> (56 - j*8)) & 0xFF;
-    }
+    ecdh_shared_x(shared_bytes, &alice_priv, &bob_pub);
+
+    // 3. Derive AES Key: HKDF over S.x, salted with R so the key is bound to this exchange
+    static const uint8_t kdf_info[] = "ECIES AES-256-CTR";
     uint8_t aes_key[32];
-    sha256_ctx_t sha;
-    sha256_init(&sha);
-    sha256_update(&sha, shared_bytes, 32);
-    sha256_final(&sha, aes_key);
+    hkdf_sha256(aes_key, sizeof(aes_key), R_wire, sizeof(R_wire), shared_bytes, 32, kdf_info, sizeof(kdf_info) - 1);
 
-    // 4. Encrypt using AES-128-CTR
-    // Use the first 16 bytes of the hash for the AES-128 key
+    // 4. Encrypt using AES-256-CTR
+    // The whole 32-byte HKDF output is the AES-256 key
     aes_ctx_t aes_alice;
-    aes_init(&aes_alice, aes_key); 
+    aes_setkey(&aes_alice, aes_key, sizeof(aes_key));
 
     // Prepare Nonce (random 12 bytes, usually)
     uint8_t nonce[12] = {0,1,2,3,4,5,6,7,8,9,10,11};
@@ -66,25 +60,23 @@ int main() {
     // BOB: RECEIVER
     printf("\n--- Transmitting (R, Ciphertext) to Bob ---\n");
 
-    // 1. Bob receives R. Derives S.
-    ec_point_t S_bob;
-    ec_mul(&S_bob, &bob_priv, &R);
-
-    // 2. Derive AES Key
+    // 1. Bob receives R. Derives S.x (R comes off the wire, so it is validated)
+    ec_point_t R_bob;
     uint8_t shared_bytes_bob[32];
-    for(int i=0; i<4; i++) {
-        uint64_t limb = S_bob.x.limbs[3-i];
-        for(int j=0; j<8; j++) shared_bytes_bob[i*8 + j] = (limb >> (56 - j*8)) & 0xFF;
+    if (!ec_point_decode(&R_bob, R_wire, sizeof(R_wire)) ||
+        !ecdh_shared_x(shared_bytes_bob, &bob_priv, &R_bob)) {
+        printf("Invalid ephemeral key R\n");
+        return 1;
     }
+
+    // 2. Derive AES Key (same HKDF inputs as Alice)
     uint8_t aes_key_bob[32];
-    sha256_init(&sha);
-    sha256_update(&sha, shared_bytes_bob, 32);
-    sha256_final(&sha, aes_key_bob);
+    hkdf_sha256(aes_key_bob, sizeof(aes_key_bob), R_wire, sizeof(R_wire), shared_bytes_bob, 32, kdf_info, sizeof(kdf_info) - 1);
 
     // 3. Decrypt
     // AES-CTR decryption is identical to encryption (XOR again)
     aes_ctx_t aes_bob;
-    aes_init(&aes_bob, aes_key_bob);
+    aes_setkey(&aes_bob, aes_key_bob, sizeof(aes_key_bob));
     
     uint8_t decrypted[100];
     memcpy(decrypted, ciphertext, msg_len);
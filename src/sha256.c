@@ -1,26 +1,12 @@
 #include "sha256.h"
+#include "cpu.h"
+#include "ecies_stats.h"
 #include <string.h>
 
 #define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32-(b))))
 
-void sha256_transform(sha256_ctx_t *ctx, const uint8_t data[]) {
-    uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
-
-    for (i = 0, j = 0; i < 16; ++i, j += 4)
-        m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-    for ( ; i < 64; ++i)
-        m[i] = (ROTRIGHT(m[i-15],7) ^ ROTRIGHT(m[i-15],18) ^ (m[i-15] >> 3)) + m[i-7] + (ROTRIGHT(m[i-2],17) ^ ROTRIGHT(m[i-2],19) ^ (m[i-2] >> 10)) + m[i-16];
-
-    a = ctx->state[0]; b = ctx->state[1]; c = ctx->state[2]; d = ctx->state[3];
-    e = ctx->state[4]; f = ctx->state[5]; g = ctx->state[6]; h = ctx->state[7];
-
-    for (i = 0; i < 64; ++i) {
-        t1 = h + (ROTRIGHT(e,6) ^ ROTRIGHT(e,11) ^ ROTRIGHT(e,25)) + ((e & f) ^ (~e & g)) + 0x428a2f98 + m[i];
-    }
-}
-
 // --- STANDARD SHA256 CONSTANTS ---
-static const uint32_t K[64] = {
+const uint32_t sha256_k[64] = {
     0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
     0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
     0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
@@ -31,26 +17,28 @@ static const uint32_t K[64] = {
     0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
 };
 
-void sha256_transform_correct(sha256_ctx_t *ctx, const uint8_t data[]) {
+void sha256_blocks_scalar(uint32_t state[8], const uint8_t *data, size_t nblocks) {
     uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
-    for (i = 0, j = 0; i < 16; ++i, j += 4)
-        m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-    for ( ; i < 64; ++i)
-        m[i] = (ROTRIGHT(m[i-15],7) ^ ROTRIGHT(m[i-15],18) ^ (m[i-15] >> 3)) + m[i-7] + (ROTRIGHT(m[i-2],17) ^ ROTRIGHT(m[i-2],19) ^ (m[i-2] >> 10)) + m[i-16];
+    for (; nblocks > 0; nblocks--, data += 64) {
+        for (i = 0, j = 0; i < 16; ++i, j += 4)
+            m[i] = ((uint32_t)data[j] << 24) | ((uint32_t)data[j + 1] << 16) | ((uint32_t)data[j + 2] << 8) | (data[j + 3]);
+        for ( ; i < 64; ++i)
+            m[i] = (ROTRIGHT(m[i-15],7) ^ ROTRIGHT(m[i-15],18) ^ (m[i-15] >> 3)) + m[i-7] + (ROTRIGHT(m[i-2],17) ^ ROTRIGHT(m[i-2],19) ^ (m[i-2] >> 10)) + m[i-16];
 
-    a = ctx->state[0]; b = ctx->state[1]; c = ctx->state[2]; d = ctx->state[3];
-    e = ctx->state[4]; f = ctx->state[5]; g = ctx->state[6]; h = ctx->state[7];
+        a = state[0]; b = state[1]; c = state[2]; d = state[3];
+        e = state[4]; f = state[5]; g = state[6]; h = state[7];
 
-    for (i = 0; i < 64; ++i) {
-        t1 = h + (ROTRIGHT(e,6) ^ ROTRIGHT(e,11) ^ ROTRIGHT(e,25)) + ((e & f) ^ (~e & g)) + K[i] + m[i];
-        t2 = (ROTRIGHT(a,2) ^ ROTRIGHT(a,13) ^ ROTRIGHT(a,22)) + ((a & b) ^ (a & c) ^ (b & c));
-        h = g; g = f; f = e; e = d + t1;
-        d = c; c = b; b = a; a = t1 + t2;
-    }
+        for (i = 0; i < 64; ++i) {
+            t1 = h + (ROTRIGHT(e,6) ^ ROTRIGHT(e,11) ^ ROTRIGHT(e,25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + m[i];
+            t2 = (ROTRIGHT(a,2) ^ ROTRIGHT(a,13) ^ ROTRIGHT(a,22)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
 
-    ctx->state[0] += a; ctx->state[1] += b; ctx->state[2] += c; ctx->state[3] += d;
-    ctx->state[4] += e; ctx->state[5] += f; ctx->state[6] += g; ctx->state[7] += h;
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
 }
 
 void sha256_init(sha256_ctx_t *ctx) {
@@ -58,18 +46,73 @@ void sha256_init(sha256_ctx_t *ctx) {
     ctx->bitlen = 0;
     ctx->state[0] = 0x6a09e667; ctx->state[1] = 0xbb67ae85; ctx->state[2] = 0x3c6ef372; ctx->state[3] = 0xa54ff53a;
     ctx->state[4] = 0x510e527f; ctx->state[5] = 0x9b05688c; ctx->state[6] = 0x1f83d9ab; ctx->state[7] = 0x5be0cd19;
+    ctx->impl = SHA256_IMPL_AUTO;
+}
+
+int sha256_set_impl(sha256_ctx_t *ctx, sha256_impl_t impl) {
+#ifdef SHA256_X86_AVAILABLE
+    if (impl == SHA256_IMPL_SSSE3 && !cpu_has(CPU_SSSE3)) return 0;
+    if (impl == SHA256_IMPL_AVX2 && !cpu_has(CPU_AVX2 | CPU_BMI2)) return 0;
+    if (impl == SHA256_IMPL_SHANI && !cpu_has(CPU_SHA | CPU_SSE41)) return 0;
+#else
+    if (impl != SHA256_IMPL_AUTO && impl != SHA256_IMPL_SCALAR) return 0;
+#endif
+    ctx->impl = impl;
+    return 1;
+}
+
+void sha256_transform_blocks(sha256_ctx_t *ctx, const uint8_t *data, size_t nblocks) {
+    sha256_impl_t impl = ctx->impl;
+    if (impl == SHA256_IMPL_AUTO) {
+#ifdef SHA256_X86_AVAILABLE
+        if (cpu_has(CPU_SHA | CPU_SSE41)) impl = SHA256_IMPL_SHANI;
+        else if (cpu_has(CPU_AVX2 | CPU_BMI2)) impl = SHA256_IMPL_AVX2;
+        else if (cpu_has(CPU_SSSE3)) impl = SHA256_IMPL_SSSE3;
+        else impl = SHA256_IMPL_SCALAR;
+#else
+        impl = SHA256_IMPL_SCALAR;
+#endif
+    }
+
+    ECIES_STAT_ADD(ECIES_STAT_SHA256_BLOCK, nblocks);
+    switch (impl) {
+#ifdef SHA256_X86_AVAILABLE
+    case SHA256_IMPL_SHANI: sha256_blocks_shani(ctx->state, data, nblocks); break;
+    case SHA256_IMPL_AVX2:  sha256_blocks_avx2(ctx->state, data, nblocks); break;
+    case SHA256_IMPL_SSSE3: sha256_blocks_ssse3(ctx->state, data, nblocks); break;
+#endif
+    default:                sha256_blocks_scalar(ctx->state, data, nblocks); break;
+    }
 }
 
 void sha256_update(sha256_ctx_t *ctx, const uint8_t *data, size_t len) {
-    for (size_t i = 0; i < len; ++i) {
-        ctx->data[ctx->datalen] = data[i];
-        ctx->datalen++;
-        if (ctx->datalen == 64) {
-            sha256_transform_correct(ctx, ctx->data);
-            ctx->bitlen += 512;
-            ctx->datalen = 0;
-        }
+    if (len == 0) return;
+
+    // Top up a partially filled block first
+    if (ctx->datalen > 0) {
+        size_t n = 64 - ctx->datalen;
+        if (n > len) n = len;
+        memcpy(ctx->data + ctx->datalen, data, n);
+        ctx->datalen += (uint32_t)n;
+        data += n;
+        len -= n;
+        if (ctx->datalen < 64) return;
+        sha256_transform_blocks(ctx, ctx->data, 1);
+        ctx->bitlen += 512;
+        ctx->datalen = 0;
     }
+
+    // Whole blocks are hashed straight from the caller's buffer
+    size_t nblocks = len / 64;
+    if (nblocks > 0) {
+        sha256_transform_blocks(ctx, data, nblocks);
+        ctx->bitlen += (uint64_t)nblocks * 512;
+        data += nblocks * 64;
+        len -= nblocks * 64;
+    }
+
+    if (len > 0) memcpy(ctx->data, data, len);
+    ctx->datalen = (uint32_t)len;
 }
 
 void sha256_final(sha256_ctx_t *ctx, uint8_t hash[32]) {
@@ -81,7 +124,7 @@ void sha256_final(sha256_ctx_t *ctx, uint8_t hash[32]) {
     } else {
         ctx->data[i++] = 0x80;
         while (i < 64) ctx->data[i++] = 0x00;
-        sha256_transform_correct(ctx, ctx->data);
+        sha256_transform_blocks(ctx, ctx->data, 1);
         memset(ctx->data, 0, 56);
     }
 
@@ -94,7 +137,7 @@ void sha256_final(sha256_ctx_t *ctx, uint8_t hash[32]) {
     ctx->data[58] = ctx->bitlen >> 40;
     ctx->data[57] = ctx->bitlen >> 48;
     ctx->data[56] = ctx->bitlen >> 56;
-    sha256_transform_correct(ctx, ctx->data);
+    sha256_transform_blocks(ctx, ctx->data, 1);
 
     for (i = 0; i < 4; ++i) {
         hash[i]      = (ctx->state[0] >> (24 - i * 8)) & 0x000000ff;
@@ -0,0 +1,162 @@
+#include "sha256.h"
+#include "cpu.h"
+#include "ecies_stats.h"
+#include <string.h>
+
+// Multi-buffer SHA-256: lane i of every vector belongs to message i, so the
+// rounds run unchanged on whole vectors. The kernel is written once over GCC
+// vector types and instantiated 4 wide (SSE2 / NEON registers) and 8 wide (AVX2).
+
+typedef uint32_t sha256_v4_t __attribute__((vector_size(16)));
+typedef uint32_t sha256_v8_t __attribute__((vector_size(32)));
+
+#define SHA256_MB_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+// Compress nblocks blocks of each lane's message into state[word][lane]
+#define SHA256_MB_KERNEL(NAME, VEC, LANES, TARGET) \
+static TARGET void NAME(uint32_t state[8][LANES], const uint8_t *const *p, size_t nblocks) { \
+    VEC s[8]; \
+    memcpy(s, state, sizeof(s)); \
+    for (size_t blk = 0; blk < nblocks; blk++) { \
+        VEC w[16]; \
+        for (int t = 0; t < 16; t++) { \
+            for (int l = 0; l < LANES; l++) { \
+                uint32_t v; \
+                memcpy(&v, p[l] + 64 * blk + 4 * t, 4); \
+                w[t][l] = __builtin_bswap32(v); \
+            } \
+        } \
+        VEC a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7]; \
+        _Pragma("GCC unroll 64") for (int t = 0; t < 64; t++) { \
+            if (t >= 16) { \
+                VEC w15 = w[(t - 15) & 15], w2 = w[(t - 2) & 15]; \
+                w[t & 15] += (SHA256_MB_ROTR(w15, 7) ^ SHA256_MB_ROTR(w15, 18) ^ (w15 >> 3)) + w[(t - 7) & 15] + \
+                             (SHA256_MB_ROTR(w2, 17) ^ SHA256_MB_ROTR(w2, 19) ^ (w2 >> 10)); \
+            } \
+            VEC t1 = h + (SHA256_MB_ROTR(e, 6) ^ SHA256_MB_ROTR(e, 11) ^ SHA256_MB_ROTR(e, 25)) + \
+                     (((f ^ g) & e) ^ g) + sha256_k[t] + w[t & 15]; \
+            VEC t2 = (SHA256_MB_ROTR(a, 2) ^ SHA256_MB_ROTR(a, 13) ^ SHA256_MB_ROTR(a, 22)) + (((a | b) & c) | (a & b)); \
+            h = g; g = f; f = e; e = d + t1; \
+            d = c; c = b; b = a; a = t1 + t2; \
+        } \
+        s[0] += a; s[1] += b; s[2] += c; s[3] += d; \
+        s[4] += e; s[5] += f; s[6] += g; s[7] += h; \
+    } \
+    memcpy(state, s, sizeof(s)); \
+}
+
+SHA256_MB_KERNEL(sha256_mb_blocks4, sha256_v4_t, 4, )
+#ifdef SHA256_X86_AVAILABLE
+SHA256_MB_KERNEL(sha256_mb_blocks8, sha256_v8_t, 8, __attribute__((target("avx2"))))
+#endif
+
+static const uint32_t sha256_iv[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// Padded tail of each lane: the last partial block plus padding, one or two
+// blocks (the same count in every lane, since the lengths are equal).
+// prefix is the byte count already compressed into the starting state.
+static size_t sha256_mb_pad(uint8_t tail[][128], const uint8_t **tp, const uint8_t *const *in, size_t len, uint64_t prefix, int lanes) {
+    size_t full = len / 64, rem = len % 64;
+    size_t tail_blocks = rem < 56 ? 1 : 2;
+    uint64_t bitlen = (prefix + len) * 8;
+
+    for (int l = 0; l < lanes; l++) {
+        memset(tail[l], 0, 128);
+        memcpy(tail[l], in[l] + full * 64, rem);
+        tail[l][rem] = 0x80;
+        for (int i = 0; i < 8; i++) tail[l][tail_blocks * 64 - 1 - i] = (uint8_t)(bitlen >> (8 * i));
+        tp[l] = tail[l];
+    }
+    return tail_blocks;
+}
+
+// state is [8][lanes], word-major
+static void sha256_mb_digest(uint8_t (*out)[32], const uint32_t *state, int lanes) {
+    for (int l = 0; l < lanes; l++) {
+        for (int i = 0; i < 8; i++) {
+            uint32_t v = state[i * lanes + l];
+            out[l][4 * i] = (uint8_t)(v >> 24);
+            out[l][4 * i + 1] = (uint8_t)(v >> 16);
+            out[l][4 * i + 2] = (uint8_t)(v >> 8);
+            out[l][4 * i + 3] = (uint8_t)v;
+        }
+    }
+}
+
+static void sha256_mb_x4(uint8_t out[4][32], const uint32_t init[8], uint64_t prefix, const uint8_t *const in[4], size_t len) {
+    uint32_t state[8][4];
+    uint8_t tail[4][128];
+    const uint8_t *tp[4];
+    size_t tail_blocks = sha256_mb_pad(tail, tp, in, len, prefix, 4);
+
+    for (int i = 0; i < 8; i++) for (int l = 0; l < 4; l++) state[i][l] = init[i];
+    sha256_mb_blocks4(state, in, len / 64);
+    sha256_mb_blocks4(state, tp, tail_blocks);
+    ECIES_STAT_ADD(ECIES_STAT_SHA256_BLOCK, 4 * (len / 64 + tail_blocks));
+    sha256_mb_digest(out, &state[0][0], 4);
+}
+
+static void sha256_mb_x8(uint8_t out[8][32], const uint32_t init[8], uint64_t prefix, const uint8_t *const in[8], size_t len) {
+#ifdef SHA256_X86_AVAILABLE
+    if (cpu_has(CPU_AVX2)) {
+        uint32_t state[8][8];
+        uint8_t tail[8][128];
+        const uint8_t *tp[8];
+        size_t tail_blocks = sha256_mb_pad(tail, tp, in, len, prefix, 8);
+
+        for (int i = 0; i < 8; i++) for (int l = 0; l < 8; l++) state[i][l] = init[i];
+        sha256_mb_blocks8(state, in, len / 64);
+        sha256_mb_blocks8(state, tp, tail_blocks);
+        ECIES_STAT_ADD(ECIES_STAT_SHA256_BLOCK, 8 * (len / 64 + tail_blocks));
+        sha256_mb_digest(out, &state[0][0], 8);
+        return;
+    }
+#endif
+    sha256_mb_x4(out, init, prefix, in, len);
+    sha256_mb_x4(out + 4, init, prefix, in + 4, len);
+}
+
+void sha256_x4(uint8_t out[4][32], const uint8_t *const in[4], size_t len) {
+    sha256_mb_x4(out, sha256_iv, 0, in, len);
+}
+
+void sha256_x8(uint8_t out[8][32], const uint8_t *const in[8], size_t len) {
+    sha256_mb_x8(out, sha256_iv, 0, in, len);
+}
+
+void sha256_batch(uint8_t (*out)[32], const sha256_ctx_t *mid, const uint8_t *const *in, size_t n, size_t len) {
+    sha256_ctx_t start;
+    if (mid) start = *mid;
+    else sha256_init(&start);
+
+#ifdef SHA256_X86_AVAILABLE
+    // SHA-NI hashes one message faster than eight AVX2 lanes do
+    if (cpu_has(CPU_SHA | CPU_SSE41)) {
+        for (size_t i = 0; i < n; i++) {
+            sha256_ctx_t ctx = start;
+            sha256_update(&ctx, in[i], len);
+            sha256_final(&ctx, out[i]);
+        }
+        return;
+    }
+#endif
+    uint64_t prefix = start.bitlen / 8;
+
+    while (n >= 8) {
+        sha256_mb_x8(out, start.state, prefix, in, len);
+        out += 8;
+        in += 8;
+        n -= 8;
+    }
+    if (n == 0) return;
+
+    // Short group: fill the spare lanes with the first message, keep only real digests
+    uint8_t tmp[8][32];
+    const uint8_t *p[8];
+    for (size_t i = 0; i < 8; i++) p[i] = in[i < n ? i : 0];
+    if (n <= 4) sha256_mb_x4(tmp, start.state, prefix, p, len);
+    else sha256_mb_x8(tmp, start.state, prefix, p, len);
+    memcpy(out, tmp, n * 32);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "sha256.h"
+
+#ifdef SHA256_X86_AVAILABLE
+#include <immintrin.h>
+
+#define SHA256_NI_TARGET __attribute__((target("sha,sse4.1")))
+
+// Groups of four rounds; unrolled, the message array lives in four registers
+#define SHA256_NI_UNROLL _Pragma("GCC unroll 16")
+
+SHA256_NI_TARGET void sha256_blocks_shani(uint32_t state[8], const uint8_t *data, size_t nblocks) {
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1, tmp;
+
+    // sha256rnds2 wants the state as ABEF / CDGH
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xB1);   // CDAB
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1B); // EFGH
+    state0 = _mm_alignr_epi8(tmp, state1, 8);                                       // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);                                    // CDGH
+
+    for (; nblocks > 0; nblocks--, data += 64) {
+        __m128i abef = state0, cdgh = state1;
+        __m128i m[4];
+
+        SHA256_NI_UNROLL for (int g = 0; g < 16; g++) {
+            int cur = g & 3;
+            if (g < 4) m[cur] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * g)), bswap);
+
+            __m128i wk = _mm_add_epi32(m[cur], _mm_loadu_si128((const __m128i *)&sha256_k[4 * g]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+
+            // Finish the schedule words for the next group: W[t-7] terms, then sigma1
+            if (g >= 3 && g < 15) {
+                int next = (g + 1) & 3;
+                tmp = _mm_alignr_epi8(m[cur], m[(g + 3) & 3], 4);
+                m[next] = _mm_sha256msg2_epu32(_mm_add_epi32(m[next], tmp), m[cur]);
+            }
+
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(wk, 0x0E));
+
+            // Start the schedule for three groups ahead (sigma0)
+            if (g >= 1 && g < 13) m[(g + 3) & 3] = _mm_sha256msg1_epu32(m[(g + 3) & 3], m[cur]);
+        }
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);          // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);       // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);    // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);       // ABEF
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+#endif // SHA256_X86_AVAILABLE
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "sha256.h"
+
+#ifdef SHA256_X86_AVAILABLE
+#include <immintrin.h>
+
+// SHA-256 with a vectorized message schedule: W[t] + K[t] for four t at a
+// time in SIMD, then the 64 rounds in scalar code reading those sums. The
+// AVX2 variant runs two blocks' schedules side by side, one per 128-bit lane
+// (every shuffle and alignr used here stays within a lane).
+
+#define SHA256_SSSE3_TARGET __attribute__((target("ssse3")))
+#define SHA256_AVX2_TARGET  __attribute__((target("avx2,bmi2")))
+
+#define SHA256_SIMD_UNROLL _Pragma("GCC unroll 16")
+
+#define ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+// 64 rounds over precomputed W + K (inlined into each target, so BMI2 gets rorx)
+static inline void sha256_simd_rounds(uint32_t state[8], const uint32_t wk[64]) {
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    _Pragma("GCC unroll 64") for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ROTR32(e, 6) ^ ROTR32(e, 11) ^ ROTR32(e, 25)) + (((f ^ g) & e) ^ g) + wk[i];
+        uint32_t t2 = (ROTR32(a, 2) ^ ROTR32(a, 13) ^ ROTR32(a, 22)) + (((a | b) & c) | (a & b));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+// --- SSSE3 ---
+
+static SHA256_SSSE3_TARGET inline __m128i sha256_sigma0_x4(__m128i x) {
+    return _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi32(x, 7), _mm_slli_epi32(x, 25)),
+                                       _mm_or_si128(_mm_srli_epi32(x, 18), _mm_slli_epi32(x, 14))),
+                         _mm_srli_epi32(x, 3));
+}
+
+static SHA256_SSSE3_TARGET inline __m128i sha256_sigma1_x4(__m128i x) {
+    return _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi32(x, 17), _mm_slli_epi32(x, 15)),
+                                       _mm_or_si128(_mm_srli_epi32(x, 19), _mm_slli_epi32(x, 13))),
+                         _mm_srli_epi32(x, 10));
+}
+
+// W[t..t+3] from x0..x3 = W[t-16..t-1]. W[t+2] and W[t+3] depend on W[t]
+// and W[t+1], so sigma1 is applied to the low and high pairs in turn.
+static SHA256_SSSE3_TARGET inline __m128i sha256_schedule_x4(__m128i x0, __m128i x1, __m128i x2, __m128i x3) {
+    const __m128i lo = _mm_set_epi32(0, 0, -1, -1);
+    __m128i w = _mm_add_epi32(_mm_add_epi32(x0, _mm_alignr_epi8(x3, x2, 4)), sha256_sigma0_x4(_mm_alignr_epi8(x1, x0, 4)));
+    w = _mm_add_epi32(w, _mm_and_si128(sha256_sigma1_x4(_mm_shuffle_epi32(x3, 0xFE)), lo));
+    return _mm_add_epi32(w, _mm_andnot_si128(lo, sha256_sigma1_x4(_mm_shuffle_epi32(w, 0x40))));
+}
+
+SHA256_SSSE3_TARGET void sha256_blocks_ssse3(uint32_t state[8], const uint8_t *data, size_t nblocks) {
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    uint32_t wk[64] __attribute__((aligned(16)));
+
+    for (; nblocks > 0; nblocks--, data += 64) {
+        __m128i x[4];
+        for (int i = 0; i < 4; i++) {
+            x[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), bswap);
+            _mm_store_si128((__m128i *)&wk[4 * i], _mm_add_epi32(x[i], _mm_loadu_si128((const __m128i *)&sha256_k[4 * i])));
+        }
+        SHA256_SIMD_UNROLL for (int t = 16; t < 64; t += 4) {
+            __m128i w = sha256_schedule_x4(x[0], x[1], x[2], x[3]);
+            x[0] = x[1]; x[1] = x[2]; x[2] = x[3]; x[3] = w;
+            _mm_store_si128((__m128i *)&wk[t], _mm_add_epi32(w, _mm_loadu_si128((const __m128i *)&sha256_k[t])));
+        }
+        sha256_simd_rounds(state, wk);
+    }
+}
+
+// --- AVX2 ---
+
+static SHA256_AVX2_TARGET inline __m256i sha256_sigma0_x8(__m256i x) {
+    return _mm256_xor_si256(_mm256_xor_si256(_mm256_or_si256(_mm256_srli_epi32(x, 7), _mm256_slli_epi32(x, 25)),
+                                             _mm256_or_si256(_mm256_srli_epi32(x, 18), _mm256_slli_epi32(x, 14))),
+                            _mm256_srli_epi32(x, 3));
+}
+
+static SHA256_AVX2_TARGET inline __m256i sha256_sigma1_x8(__m256i x) {
+    return _mm256_xor_si256(_mm256_xor_si256(_mm256_or_si256(_mm256_srli_epi32(x, 17), _mm256_slli_epi32(x, 15)),
+                                             _mm256_or_si256(_mm256_srli_epi32(x, 19), _mm256_slli_epi32(x, 13))),
+                            _mm256_srli_epi32(x, 10));
+}
+
+static SHA256_AVX2_TARGET inline __m256i sha256_schedule_x8(__m256i x0, __m256i x1, __m256i x2, __m256i x3) {
+    const __m256i lo = _mm256_set_epi32(0, 0, -1, -1, 0, 0, -1, -1);
+    __m256i w = _mm256_add_epi32(_mm256_add_epi32(x0, _mm256_alignr_epi8(x3, x2, 4)), sha256_sigma0_x8(_mm256_alignr_epi8(x1, x0, 4)));
+    w = _mm256_add_epi32(w, _mm256_and_si256(sha256_sigma1_x8(_mm256_shuffle_epi32(x3, 0xFE)), lo));
+    return _mm256_add_epi32(w, _mm256_andnot_si256(lo, sha256_sigma1_x8(_mm256_shuffle_epi32(w, 0x40))));
+}
+
+SHA256_AVX2_TARGET void sha256_blocks_avx2(uint32_t state[8], const uint8_t *data, size_t nblocks) {
+    const __m256i bswap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+                                            0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    uint32_t wk0[64] __attribute__((aligned(16)));
+    uint32_t wk1[64] __attribute__((aligned(16)));
+
+    // Block pairs: the first block in the low lanes, the second in the high lanes
+    for (; nblocks >= 2; nblocks -= 2, data += 128) {
+        __m256i x[4];
+        for (int i = 0; i < 4; i++) {
+            __m256i m = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(data + 16 * i))),
+                                                _mm_loadu_si128((const __m128i *)(data + 64 + 16 * i)), 1);
+            x[i] = _mm256_shuffle_epi8(m, bswap);
+            __m256i k = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&sha256_k[4 * i]));
+            __m256i w = _mm256_add_epi32(x[i], k);
+            _mm_store_si128((__m128i *)&wk0[4 * i], _mm256_castsi256_si128(w));
+            _mm_store_si128((__m128i *)&wk1[4 * i], _mm256_extracti128_si256(w, 1));
+        }
+        SHA256_SIMD_UNROLL for (int t = 16; t < 64; t += 4) {
+            __m256i w = sha256_schedule_x8(x[0], x[1], x[2], x[3]);
+            x[0] = x[1]; x[1] = x[2]; x[2] = x[3]; x[3] = w;
+            w = _mm256_add_epi32(w, _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&sha256_k[t])));
+            _mm_store_si128((__m128i *)&wk0[t], _mm256_castsi256_si128(w));
+            _mm_store_si128((__m128i *)&wk1[t], _mm256_extracti128_si256(w, 1));
+        }
+        sha256_simd_rounds(state, wk0);
+        sha256_simd_rounds(state, wk1);
+    }
+
+    if (nblocks > 0) sha256_blocks_ssse3(state, data, nblocks);
+}
+
+#endif // SHA256_X86_AVAILABLE
\ No newline at end of file
@@ -0,0 +1,246 @@
+#include "threadpool.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// One participant's share of the current loop: the owner pops from begin,
+// thieves split off the top half. Padded so neighbours never share a line.
+typedef struct {
+    pthread_mutex_t lock;
+    size_t begin, end;
+} __attribute__((aligned(64))) threadpool_slot_t;
+
+typedef struct threadpool_task {
+    threadpool_task_fn fn;
+    void *arg;
+    struct threadpool_task *next;
+} threadpool_task_t;
+
+struct threadpool {
+    pthread_mutex_t lock;
+    pthread_cond_t work;        // Workers wait here for a loop, a task or shutdown
+    pthread_cond_t done;        // The caller waits here for the loop to drain
+    pthread_t *threads;
+    size_t nthreads;            // Worker threads, not counting the caller
+
+    // Current loop. Set up under lock; slots are then guarded by their own locks.
+    threadpool_slot_t *slots;   // nthreads + 1; slot 0 is the caller's
+    threadpool_fn fn;
+    void *arg;
+    size_t remaining;           // Indices not yet finished (atomic)
+    size_t active;              // Workers inside the loop, guarded by lock
+    unsigned long generation;   // Bumped for every loop so workers notice it
+    int loop_open;              // Cleared once the loop has fully drained
+
+    // Queued tasks, guarded by lock
+    threadpool_task_t *head, *tail;
+    int shutdown;
+};
+
+// --- LOOPS ---
+
+// Take the next index from our own slot, or steal half of someone else's
+static int threadpool_next(threadpool_t *pool, size_t self, size_t *index) {
+    threadpool_slot_t *own = &pool->slots[self];
+    size_t nslots = pool->nthreads + 1;
+
+    pthread_mutex_lock(&own->lock);
+    if (own->begin < own->end) {
+        *index = own->begin++;
+        pthread_mutex_unlock(&own->lock);
+        return 1;
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    for (size_t k = 1; k < nslots; k++) {
+        threadpool_slot_t *victim = &pool->slots[(self + k) % nslots];
+        pthread_mutex_lock(&victim->lock);
+        size_t left = victim->end - victim->begin;
+        if (victim->begin >= victim->end) {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+        size_t mid = victim->begin + left / 2;
+        size_t end = victim->end;
+        victim->end = mid;
+        pthread_mutex_unlock(&victim->lock);
+
+        // Run the first stolen index now, keep the rest where others can steal it
+        pthread_mutex_lock(&own->lock);
+        own->begin = mid + 1;
+        own->end = end;
+        pthread_mutex_unlock(&own->lock);
+        *index = mid;
+        return 1;
+    }
+    return 0;
+}
+
+static void threadpool_run(threadpool_t *pool, size_t self, threadpool_fn fn, void *arg) {
+    size_t i;
+    while (threadpool_next(pool, self, &i)) {
+        fn(arg, i);
+        __atomic_sub_fetch(&pool->remaining, 1, __ATOMIC_ACQ_REL);
+    }
+}
+
+static void *threadpool_worker(void *p) {
+    threadpool_t *pool = p;
+    size_t self;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (self = 0; self < pool->nthreads && !pthread_equal(pool->threads[self], pthread_self()); self++) {}
+    self++;   // Slot 0 belongs to the caller
+
+    for (;;) {
+        while (!pool->shutdown && !pool->head && !(pool->loop_open && pool->generation != seen))
+            pthread_cond_wait(&pool->work, &pool->lock);
+
+        if (pool->loop_open && pool->generation != seen) {
+            threadpool_fn fn = pool->fn;
+            void *arg = pool->arg;
+            seen = pool->generation;
+            pool->active++;
+            pthread_mutex_unlock(&pool->lock);
+
+            threadpool_run(pool, self, fn, arg);
+
+            pthread_mutex_lock(&pool->lock);
+            if (--pool->active == 0) pthread_cond_signal(&pool->done);
+            continue;
+        }
+
+        if (pool->head) {
+            threadpool_task_t *task = pool->head;
+            pool->head = task->next;
+            if (!pool->head) pool->tail = NULL;
+            pthread_mutex_unlock(&pool->lock);
+
+            task->fn(task->arg);
+            free(task);
+
+            pthread_mutex_lock(&pool->lock);
+            continue;
+        }
+
+        break;   // Shut down with nothing left to run
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+threadpool_t *threadpool_new(size_t nthreads) {
+    if (nthreads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = cpus > 0 ? (size_t)cpus : 1;
+    }
+
+    threadpool_t *pool = calloc(1, sizeof(*pool));
+    if (!pool) return NULL;
+    pool->threads = calloc(nthreads, sizeof(pthread_t));
+    if (!pool->threads || posix_memalign((void **)&pool->slots, 64, (nthreads + 1) * sizeof(threadpool_slot_t)) != 0) {
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+    for (size_t i = 0; i <= nthreads; i++) {
+        pthread_mutex_init(&pool->slots[i].lock, NULL);
+        pool->slots[i].begin = pool->slots[i].end = 0;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    // The caller is one of the threads, so start one fewer worker. Workers find
+    // their slot through threads[], so hold them off until it is filled in.
+    pthread_mutex_lock(&pool->lock);
+    for (size_t i = 0; i + 1 < nthreads; i++) {
+        if (pthread_create(&pool->threads[i], NULL, threadpool_worker, pool) != 0) break;
+        pool->nthreads++;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return pool;
+}
+
+void threadpool_free(threadpool_t *pool) {
+    if (!pool) return;
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < pool->nthreads; i++) pthread_join(pool->threads[i], NULL);
+    for (size_t i = 0; i <= pool->nthreads; i++) pthread_mutex_destroy(&pool->slots[i].lock);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work);
+    pthread_cond_destroy(&pool->done);
+    free(pool->slots);
+    free(pool->threads);
+    free(pool);
+}
+
+size_t threadpool_size(const threadpool_t *pool) {
+    return pool ? pool->nthreads + 1 : 1;
+}
+
+void threadpool_parallel_for(threadpool_t *pool, size_t n, threadpool_fn fn, void *arg) {
+    if (!pool || pool->nthreads == 0 || n <= 1) {
+        for (size_t i = 0; i < n; i++) fn(arg, i);
+        return;
+    }
+
+    // Even contiguous shares to start with; stealing evens out the rest
+    size_t nslots = pool->nthreads + 1;
+    pthread_mutex_lock(&pool->lock);
+    for (size_t s = 0; s < nslots; s++) {
+        pthread_mutex_lock(&pool->slots[s].lock);
+        pool->slots[s].begin = n * s / nslots;
+        pool->slots[s].end = n * (s + 1) / nslots;
+        pthread_mutex_unlock(&pool->slots[s].lock);
+    }
+    pool->fn = fn;
+    pool->arg = arg;
+    pool->remaining = n;
+    pool->loop_open = 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    threadpool_run(pool, 0, fn, arg);
+
+    // Every index is handed out; wait for the last bodies and for workers to leave
+    pthread_mutex_lock(&pool->lock);
+    while (__atomic_load_n(&pool->remaining, __ATOMIC_ACQUIRE) > 0 || pool->active > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pool->loop_open = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// --- TASKS ---
+
+int threadpool_submit(threadpool_t *pool, threadpool_task_fn fn, void *arg) {
+    if (!pool || pool->nthreads == 0) {
+        fn(arg);
+        return 1;
+    }
+
+    threadpool_task_t *task = malloc(sizeof(*task));
+    if (!task) return 0;
+    task->fn = fn;
+    task->arg = arg;
+    task->next = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->shutdown) {
+        pthread_mutex_unlock(&pool->lock);
+        free(task);
+        return 0;
+    }
+    if (pool->tail) pool->tail->next = task;
+    else pool->head = task;
+    pool->tail = task;
+    pthread_cond_signal(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+    return 1;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Minimal harness: every CHECK that fails is reported, and main returns
+// test_report() so ctest sees a nonzero exit status.
+static int test_failures;
+static int test_checks;
+
+#define CHECK(cond) do { \
+    test_checks++; \
+    if (!(cond)) { \
+        test_failures++; \
+        fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+} while (0)
+
+// Compare len bytes against a hex string, printing both on a mismatch
+#define CHECK_HEX(got, hex, len) do { \
+    test_checks++; \
+    if (!test_hex_equal((got), (hex), (len))) { \
+        test_failures++; \
+        fprintf(stderr, "%s:%d: %s != %s\n", __FILE__, __LINE__, #got, hex); \
+        test_print_hex("  got     ", (got), (len)); \
+        fprintf(stderr, "  expected %s\n", hex); \
+    } \
+} while (0)
+
+// Decode a hex string into out and return its length in bytes
+static inline size_t test_unhex(uint8_t *out, const char *hex) {
+    size_t n = 0;
+    for (; hex[0] && hex[1]; hex += 2) {
+        unsigned v;
+        sscanf(hex, "%2x", &v);
+        out[n++] = (uint8_t)v;
+    }
+    return n;
+}
+
+static inline void test_print_hex(const char *label, const uint8_t *p, size_t len) {
+    fprintf(stderr, "%s", label);
+    for (size_t i = 0; i < len; i++) fprintf(stderr, "%02x", p[i]);
+    fprintf(stderr, "\n");
+}
+
+static inline int test_hex_equal(const uint8_t *got, const char *hex, size_t len) {
+    uint8_t want[1024];
+    if (strlen(hex) != 2 * len || len > sizeof(want)) return 0;
+    test_unhex(want, hex);
+    return memcmp(got, want, len) == 0;
+}
+
+static inline int test_report(const char *name) {
+    if (test_failures) fprintf(stderr, "%s: %d of %d checks failed\n", name, test_failures, test_checks);
+    else printf("%s: %d checks passed\n", name, test_checks);
+    return test_failures != 0;
+}
+
+#endif
@@ -0,0 +1,232 @@
+#include <stdlib.h>
+#include "test.h"
+#include "aes.h"
+
+// --- FIPS-197 (Appendices B and C) ---
+static void test_block(void) {
+    static const struct { const char *key, *pt, *ct; } v[] = {
+        { "2b7e151628aed2a6abf7158809cf4f3c",
+          "3243f6a8885a308d313198a2e0370734", "3925841d02dc09fbdc118597196a0b32" },
+        { "000102030405060708090a0b0c0d0e0f",
+          "00112233445566778899aabbccddeeff", "69c4e0d86a7b0430d8cdb78070b4c55a" },
+        { "000102030405060708090a0b0c0d0e0f1011121314151617",
+          "00112233445566778899aabbccddeeff", "dda97ca4864cdfe06eaf70a0ec0d7191" },
+        { "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+          "00112233445566778899aabbccddeeff", "8ea2b7ca516745bfeafc49904b496089" },
+    };
+    for (size_t i = 0; i < sizeof(v) / sizeof(v[0]); i++) {
+        uint8_t key[32], pt[16], ct[16];
+        size_t key_len = test_unhex(key, v[i].key);
+        test_unhex(pt, v[i].pt);
+
+        aes_ctx_t ctx;
+        CHECK(aes_setkey(&ctx, key, key_len));
+        CHECK(ctx.nr == (int)key_len / 4 + 6);
+        aes_encrypt_block(&ctx, pt, ct);
+        CHECK_HEX(ct, v[i].ct, 16);
+    }
+
+    aes_ctx_t ctx;
+    uint8_t key[32] = {0};
+    CHECK(!aes_setkey(&ctx, key, 20));
+}
+
+// --- SP 800-38A F.5 (CTR) ---
+// The initial counter block f0..ff is nonce f0..fb with block counter
+// 0xfcfdfeff, which aes_ctr_xor reaches through the byte offset.
+static const char *ctr_pt =
+    "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+    "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+
+static const struct { const char *key, *ct; } ctr_vectors[] = {
+    { "2b7e151628aed2a6abf7158809cf4f3c",
+      "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+      "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee" },
+    { "8e73b0f7da0e6452c810f32b809079e562f8ead2522c6b7b",
+      "1abc932417521ca24f2b0459fe7e6e0b090339ec0aa6faefd5ccc2c6f4ce8e94"
+      "1e36b26bd1ebc670d1bd1d665620abf74f78a7f6d29809585a97daec58c6b050" },
+    { "603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4",
+      "601ec313775789a5b7a7f504bbf3d228f443e3ca4d62b59aca84e990cacaf5c5"
+      "2b0930daa23de94ce87017ba2d84988ddfc9c58db67aada613c2dd08457941a6" },
+};
+
+static void test_ctr(aes_impl_t impl) {
+    uint8_t nonce[12];
+    test_unhex(nonce, "f0f1f2f3f4f5f6f7f8f9fafb");
+    uint64_t offset = (uint64_t)0xfcfdfeff * 16;
+
+    for (size_t i = 0; i < sizeof(ctr_vectors) / sizeof(ctr_vectors[0]); i++) {
+        uint8_t key[32], buf[64];
+        size_t key_len = test_unhex(key, ctr_vectors[i].key);
+        aes_ctx_t ctx;
+        aes_setkey(&ctx, key, key_len);
+        aes_set_impl(&ctx, impl);
+
+        test_unhex(buf, ctr_pt);
+        aes_ctr_xor(&ctx, nonce, offset, buf, sizeof(buf));
+        CHECK_HEX(buf, ctr_vectors[i].ct, 64);
+
+        // Any split point gives the same stream, including mid-block starts
+        for (size_t cut = 1; cut < sizeof(buf); cut += 7) {
+            test_unhex(buf, ctr_pt);
+            aes_ctr_xor(&ctx, nonce, offset, buf, cut);
+            aes_ctr_xor(&ctx, nonce, offset + cut, buf + cut, sizeof(buf) - cut);
+            CHECK_HEX(buf, ctr_vectors[i].ct, 64);
+        }
+    }
+}
+
+// Parallel CTR on a real pool matches the serial stream, from mid-block
+// offsets and over lengths around the chunk size
+static void test_ctr_parallel(void) {
+    static const uint64_t offsets[] = { 0, 5, 16 * 1000 + 7, (uint64_t)0xfcfdfeff * 16 + 9 };
+    static const size_t lens[] = { 0, 1, AES_CTR_MIN_CHUNK - 1, AES_CTR_MIN_CHUNK, AES_CTR_MIN_CHUNK + 1,
+                                   2 * AES_CTR_MIN_CHUNK + 15, 3 * AES_CTR_MIN_CHUNK + 13 };
+    const size_t max = 3 * AES_CTR_MIN_CHUNK + 13;
+    uint8_t *ref = malloc(max), *buf = malloc(max);
+    uint8_t key[32], nonce[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    for (size_t i = 0; i < sizeof(key); i++) key[i] = (uint8_t)(i * 5 + 3);
+
+    aes_ctx_t ctx;
+    aes_setkey(&ctx, key, 32);
+    threadpool_t *pool = threadpool_new(3);
+    CHECK(pool != NULL && threadpool_size(pool) >= 2);
+
+    for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++) {
+        for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+            size_t len = lens[l];
+            for (size_t i = 0; i < len; i++) ref[i] = (uint8_t)(i * 31 + o);
+            memcpy(buf, ref, len);
+            aes_ctr_xor(&ctx, nonce, offsets[o], ref, len);
+            aes_ctr_xor_parallel(&ctx, nonce, offsets[o], buf, len, pool);
+            CHECK(memcmp(buf, ref, len) == 0);
+        }
+    }
+    threadpool_free(pool);
+    free(ref);
+    free(buf);
+}
+
+// --- SP 800-38D (GCM spec test cases 2-4 and 14-16, 96-bit IVs) ---
+static const char *gcm_pt =
+    "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+    "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255";
+
+static const struct { const char *key, *iv, *aad, *pt, *ct, *tag; } gcm_vectors[] = {
+    { "00000000000000000000000000000000", "000000000000000000000000", "",
+      "00000000000000000000000000000000", "0388dace60b6a392f328c2b971b2fe78",
+      "ab6e47d42cec13bdf53a67b21257bddf" },
+    { "feffe9928665731c6d6a8f9467308308", "cafebabefacedbaddecaf888", "", NULL,
+      "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+      "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985",
+      "4d5c2af327cd64a62cf35abd2ba6fab4" },
+    { "feffe9928665731c6d6a8f9467308308", "cafebabefacedbaddecaf888",
+      "feedfacedeadbeeffeedfacedeadbeefabaddad2", NULL,
+      "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+      "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+      "5bc94fbc3221a5db94fae95ae7121a47" },
+    { "0000000000000000000000000000000000000000000000000000000000000000", "000000000000000000000000", "",
+      "00000000000000000000000000000000", "cea7403d4d606b6e074ec5d3baf39d18",
+      "d0d1c8a799996bf0265b98b5d48ab919" },
+    { "feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308", "cafebabefacedbaddecaf888", "", NULL,
+      "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+      "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662898015ad",
+      "b094dac5d93471bdec1a502270e3cc6c" },
+    { "feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308", "cafebabefacedbaddecaf888",
+      "feedfacedeadbeeffeedfacedeadbeefabaddad2", NULL,
+      "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+      "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662",
+      "76fc6ece0f4e1768cddf8853bb2d551b" },
+};
+
+static void test_gcm(aes_impl_t impl) {
+    for (size_t i = 0; i < sizeof(gcm_vectors) / sizeof(gcm_vectors[0]); i++) {
+        uint8_t key[32], iv[12], aad[32], pt[64], buf[64], tag[16];
+        size_t key_len = test_unhex(key, gcm_vectors[i].key);
+        test_unhex(iv, gcm_vectors[i].iv);
+        size_t aad_len = test_unhex(aad, gcm_vectors[i].aad);
+        size_t len = strlen(gcm_vectors[i].ct) / 2;   // Cases 4 and 16 use the first 60 bytes
+        test_unhex(pt, gcm_vectors[i].pt ? gcm_vectors[i].pt : gcm_pt);
+        memcpy(buf, pt, len);
+
+        aes_ctx_t aes;
+        aes_gcm_ctx_t gcm;
+        aes_setkey(&aes, key, key_len);
+        aes_set_impl(&aes, impl);
+        aes_gcm_init(&gcm, &aes);
+
+        aes_gcm_encrypt(&gcm, iv, aad, aad_len, buf, len, tag);
+        CHECK_HEX(buf, gcm_vectors[i].ct, len);
+        CHECK_HEX(tag, gcm_vectors[i].tag, 16);
+
+        CHECK(aes_gcm_decrypt(&gcm, iv, aad, aad_len, buf, len, tag));
+        CHECK(memcmp(buf, pt, len) == 0);
+
+        // A flipped tag bit fails and wipes the buffer
+        aes_gcm_encrypt(&gcm, iv, aad, aad_len, buf, len, tag);
+        tag[15] ^= 1;
+        CHECK(!aes_gcm_decrypt(&gcm, iv, aad, aad_len, buf, len, tag));
+        for (size_t j = 0; j < len; j++) CHECK(buf[j] == 0);
+    }
+}
+
+// Long messages take the 8-block paths; every backend must agree with the table one
+static void test_backends_agree(void) {
+    static const size_t lens[] = { 0, 1, 15, 16, 17, 127, 128, 129, 1000, 4099 };
+    const size_t max = 4099;
+    uint8_t *ref = malloc(max), *buf = malloc(max);
+    uint8_t key[32], iv[12] = {9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1, 2}, aad[20];
+    for (size_t i = 0; i < sizeof(key); i++) key[i] = (uint8_t)(i * 7 + 1);
+    for (size_t i = 0; i < sizeof(aad); i++) aad[i] = (uint8_t)(i * 3);
+
+    static const aes_impl_t impls[] = { AES_IMPL_BITSLICED, AES_IMPL_AESNI, AES_IMPL_AUTO };
+    for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        size_t len = lens[l];
+        uint8_t ref_tag[16], tag[16];
+        aes_ctx_t aes;
+        aes_gcm_ctx_t gcm;
+
+        for (size_t i = 0; i < len; i++) ref[i] = (uint8_t)(i * 13 + len);
+        aes_setkey(&aes, key, 32);
+        aes_set_impl(&aes, AES_IMPL_TABLE);
+        aes_gcm_init(&gcm, &aes);
+        aes_gcm_encrypt(&gcm, iv, aad, sizeof(aad), ref, len, ref_tag);
+
+        for (size_t k = 0; k < sizeof(impls) / sizeof(impls[0]); k++) {
+            aes_setkey(&aes, key, 32);
+            if (!aes_set_impl(&aes, impls[k])) continue;
+            aes_gcm_init(&gcm, &aes);
+            for (size_t i = 0; i < len; i++) buf[i] = (uint8_t)(i * 13 + len);
+            aes_gcm_encrypt(&gcm, iv, aad, sizeof(aad), buf, len, tag);
+            CHECK(memcmp(buf, ref, len) == 0);
+            CHECK(memcmp(tag, ref_tag, 16) == 0);
+        }
+    }
+    free(ref);
+    free(buf);
+}
+
+int main(void) {
+    static const struct { aes_impl_t impl; const char *name; } impls[] = {
+        { AES_IMPL_TABLE, "table" },
+        { AES_IMPL_BITSLICED, "bitsliced" },
+        { AES_IMPL_AESNI, "aesni" },
+        { AES_IMPL_AUTO, "auto" },
+    };
+
+    test_block();
+    for (size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); i++) {
+        aes_ctx_t probe;
+        uint8_t key[16] = {0};
+        aes_setkey(&probe, key, 16);
+        if (!aes_set_impl(&probe, impls[i].impl)) {
+            printf("test_aes: %s backend not available, skipped\n", impls[i].name);
+            continue;
+        }
+        test_ctr(impls[i].impl);
+        test_gcm(impls[i].impl);
+    }
+    test_backends_agree();
+    test_ctr_parallel();
+    return test_report("test_aes");
+}
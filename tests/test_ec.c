@@ -0,0 +1,305 @@
+#include "test.h"
+#include "ec.h"
+
+// Affine point as uncompressed SEC1 bytes, for comparing against vectors
+#define CHECK_POINT(p, hex) do { \
+    uint8_t enc_[EC_POINT_UNCOMPRESSED_SIZE]; \
+    CHECK(!(p)->is_infinity); \
+    ec_point_encode(enc_, (p), 0); \
+    CHECK_HEX(enc_, hex, EC_POINT_UNCOMPRESSED_SIZE); \
+} while (0)
+
+static int point_equal(const ec_point_t *a, const ec_point_t *b) {
+    if (a->is_infinity || b->is_infinity) return a->is_infinity == b->is_infinity;
+    return memcmp(&a->x, &b->x, sizeof(a->x)) == 0 && memcmp(&a->y, &b->y, sizeof(a->y)) == 0;
+}
+
+static const char *g_hex =
+    "0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"
+    "483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8";
+
+// k * G; the last three were computed with OpenSSL's secp256k1
+static const struct { const char *k, *point; } mul_vectors[] = {
+    { "0000000000000000000000000000000000000000000000000000000000000001", NULL },
+    { "0000000000000000000000000000000000000000000000000000000000000002",
+      "04c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5"
+      "1ae168fea63dc339a3c58419466ceaeef7f632653266d0e1236431a950cfe52a" },
+    { "0000000000000000000000000000000000000000000000000000000000000003",
+      "04f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9"
+      "388f7b0f632de8140fe337e62a37f3566500a99934c2231b6cb9fd7584b8e672" },
+    { "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140",
+      "0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"
+      "b7c52588d95c3b9aa25b0403f1eef75702e84bb7597aabe663b82f6f04ef2777" },
+    { "e32868331fa8ef0138de0de85478346aec5e3912b6029ae71691c384237a3eeb",
+      "0486b1aa5120f079594348c67647679e7ac4c365b2c01330db782b0ba611c1d677"
+      "5f4376a23eed633657a90f385ba21068ed7e29859a7fab09e953cc5b3e89beba" },
+    { "cef147652aa90162e1fff9cf07f2605ea05529ca215a04350a98ecc24aa34342",
+      "044034127647bb7fdab7f1526c7d10be8b28174e2bba35b06ffd8a26fc2c20134a"
+      "09e773199edc1ea792b150270ea3317689286c9fe239dd5b9c5cfd9e81b4b632" },
+};
+#define NUM_MUL_VECTORS (sizeof(mul_vectors) / sizeof(mul_vectors[0]))
+
+static void test_mul_g(void) {
+    ec_point_t g, r;
+    ec_init_g(&g);
+    CHECK_POINT(&g, g_hex);
+    CHECK(ec_is_on_curve(&g));
+
+    for (size_t i = 0; i < NUM_MUL_VECTORS; i++) {
+        bigint256_t k;
+        const char *want = mul_vectors[i].point ? mul_vectors[i].point : g_hex;
+        bigint_set_hex(&k, mul_vectors[i].k);
+
+        ec_mul_g(&r, &k);
+        CHECK_POINT(&r, want);
+        ec_mul(&r, &k, &g);
+        CHECK_POINT(&r, want);
+    }
+
+    // 0 * G and n * G are infinity
+    bigint256_t zero = {{0}}, n;
+    bigint_set_hex(&n, "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141");
+    ec_mul_g(&r, &zero);
+    CHECK(r.is_infinity);
+    ec_mul_g(&r, &n);
+    CHECK(r.is_infinity);
+    ec_mul(&r, &n, &g);
+    CHECK(r.is_infinity);
+}
+
+// Variable-base paths against each other: (a * b) * G = a * (b * G)
+static void test_mul_consistency(void) {
+    bigint256_t k[4];
+    ec_point_t p[4], want[4], got[4];
+    for (size_t j = 0; j < 4; j++) {
+        bigint256_t a, b;
+        bigint_set_hex(&a, mul_vectors[2 + j % 4].k);
+        bigint_set_hex(&b, mul_vectors[(5 - j) % NUM_MUL_VECTORS].k);
+        bigint_mul_mod_n(&k[j], &a, &b);
+        ec_mul_g(&p[j], &b);
+        ec_mul_g(&want[j], &k[j]);
+        bigint_set_hex(&k[j], mul_vectors[2 + j % 4].k);
+
+        ec_mul(&got[j], &k[j], &p[j]);
+        CHECK(point_equal(&got[j], &want[j]));
+        ec_prepared_t *pp = ec_prepare(&p[j]);
+        CHECK(pp != NULL);
+        if (pp) {
+            ec_mul_prepared(&got[j], &k[j], pp);
+            CHECK(point_equal(&got[j], &want[j]));
+            ec_prepared_free(pp);
+        }
+    }
+
+    ec_mul_x4(got, k, p);
+    for (size_t j = 0; j < 4; j++) CHECK(point_equal(&got[j], &want[j]));
+
+    // sum k_j * P_j
+    ec_point_t sum = want[0], msm;
+    for (size_t j = 1; j < 4; j++) ec_add(&sum, &sum, &want[j]);
+    CHECK(ec_multi_mul(&msm, k, p, 4));
+    CHECK(point_equal(&msm, &sum));
+}
+
+// A two-entry cache over a working set of four points: hits by coordinates,
+// least recently used eviction, and re-preparation after eviction
+static void test_prepared_cache(void) {
+    ec_point_t p[4], copy, got, want;
+    bigint256_t k;
+    bigint_set_hex(&k, mul_vectors[4].k);
+    for (size_t j = 0; j < 4; j++) {
+        bigint256_t s;
+        bigint_set_hex(&s, mul_vectors[2 + j].k);
+        ec_mul_g(&p[j], &s);
+    }
+
+    ec_prepared_cache_t *cache = ec_prepared_cache_new(2);
+    CHECK(cache != NULL);
+    if (!cache) return;
+
+    // A separate copy of the same coordinates hits the same entry
+    const ec_prepared_t *p0 = ec_prepared_cache_get(cache, &p[0]);
+    CHECK(p0 != NULL);
+    copy = p[0];
+    CHECK(ec_prepared_cache_get(cache, &copy) == p0);
+
+    // p[0] is used again after p[1], so p[2] evicts p[1]
+    CHECK(ec_prepared_cache_get(cache, &p[1]) != NULL);
+    CHECK(ec_prepared_cache_get(cache, &p[0]) == p0);
+    CHECK(ec_prepared_cache_get(cache, &p[2]) != NULL);
+    CHECK(ec_prepared_cache_contains(cache, &p[0]));
+    CHECK(!ec_prepared_cache_contains(cache, &p[1]));
+    CHECK(ec_prepared_cache_contains(cache, &p[2]));
+
+    // contains does not count as a use: p[1] comes back and evicts p[0]
+    CHECK(ec_prepared_cache_contains(cache, &p[0]));
+    CHECK(ec_prepared_cache_get(cache, &p[1]) != NULL);
+    CHECK(!ec_prepared_cache_contains(cache, &p[0]));
+    CHECK(ec_prepared_cache_contains(cache, &p[2]));
+
+    // Cycling through all four keeps missing; every product is still right
+    for (size_t i = 0; i < 12; i++) {
+        const ec_point_t *q = &p[(i * 3) % 4];
+        ec_prepared_cache_mul(cache, &got, &k, q);
+        ec_mul(&want, &k, q);
+        CHECK(point_equal(&got, &want));
+    }
+
+    // Off-curve points are never prepared; the cache falls back to ec_mul
+    ec_point_t bad = p[3];
+    bad.y.limbs[0] ^= 1;
+    CHECK(ec_prepare(&bad) == NULL);
+    CHECK(ec_prepared_cache_get(cache, &bad) == NULL);
+    CHECK(ec_prepared_cache_contains(cache, &bad));
+    ec_prepared_cache_free(cache);
+}
+
+// ec_multi_mul past the Strauss cutoff, against a sum of single multiplications.
+// Only five distinct points (one of them -G), so most repeat; every seventh scalar is zero.
+static void test_multi_mul(void) {
+    enum { MAX_N = 80 };
+    bigint256_t k[MAX_N], a, b;
+    ec_point_t p[MAX_N], base[5], sum, term, msm;
+    uint8_t raw[EC_POINT_UNCOMPRESSED_SIZE];
+    ec_init_g(&base[0]);
+    for (size_t j = 1; j < 5; j++) {
+        test_unhex(raw, mul_vectors[j].point);
+        ec_point_decode(&base[j], raw, EC_POINT_UNCOMPRESSED_SIZE);
+    }
+    bigint_set_hex(&a, mul_vectors[4].k);
+    bigint_set_hex(&b, mul_vectors[5].k);
+    for (size_t i = 0; i < MAX_N; i++) {
+        if (i == 0) k[i] = a;
+        else bigint_mul_mod_n(&k[i], &k[i - 1], &b);
+        p[i] = base[i % 5];
+    }
+    for (size_t i = 3; i < MAX_N; i += 7) memset(&k[i], 0, sizeof(k[i]));
+
+    static const size_t ns[] = { 17, 64, MAX_N };
+    for (size_t t = 0; t < sizeof(ns) / sizeof(ns[0]); t++) {
+        size_t n = ns[t];
+        sum.is_infinity = 1;
+        for (size_t i = 0; i < n; i++) {
+            ec_mul(&term, &k[i], &p[i]);
+            ec_add(&sum, &sum, &term);
+        }
+        CHECK(ec_multi_mul(&msm, k, p, n));
+        CHECK(point_equal(&msm, &sum));
+    }
+
+    // k and -k on the same point cancel, leaving infinity
+    for (size_t i = 0; i < 64; i += 2) {
+        bigint_neg_mod_n(&k[i + 1], &k[i]);
+        p[i + 1] = p[i];
+    }
+    CHECK(ec_multi_mul(&msm, k, p, 64));
+    CHECK(msm.is_infinity);
+}
+
+// --- ECDH (x-coordinate of a * B, checked against OpenSSL's derive) ---
+static void test_ecdh(void) {
+    bigint256_t a, b;
+    ec_point_t pa, pb;
+    uint8_t s1[32], s2[32];
+    bigint_set_hex(&a, mul_vectors[4].k);
+    bigint_set_hex(&b, mul_vectors[5].k);
+    ec_mul_g(&pa, &a);
+    ec_mul_g(&pb, &b);
+
+    CHECK(ecdh_shared_x(s1, &a, &pb));
+    CHECK(ecdh_shared_x(s2, &b, &pa));
+    CHECK_HEX(s1, "3e2ffbc3aa8a2836c1689e55cd169ba638b58a3a18803fcf7de153525b28c3cd", 32);
+    CHECK(memcmp(s1, s2, 32) == 0);
+
+    // Off-curve points and a zero key are rejected, with the output zeroed
+    ec_point_t bad = pb;
+    bad.y.limbs[0] ^= 1;
+    memset(s1, 0xff, sizeof(s1));
+    CHECK(!ecdh_shared_x(s1, &a, &bad));
+    for (size_t i = 0; i < 32; i++) CHECK(s1[i] == 0);
+    bigint256_t zero = {{0}};
+    CHECK(!ecdh_shared_x(s1, &zero, &pb));
+
+    // Four at once matches the ladder lane by lane, with the bad point failing alone
+    ec_point_t pubs[4];
+    uint8_t out[4][32];
+    int ok[4];
+    pubs[0] = pb;
+    pubs[1] = bad;
+    pubs[2] = pa;
+    ec_init_g(&pubs[3]);
+    CHECK(!ecdh_shared_x4(out, ok, &a, pubs));
+    for (int j = 0; j < 4; j++) {
+        CHECK(ok[j] == (j != 1));
+        CHECK(ecdh_shared_x(s2, &a, &pubs[j]) == ok[j]);
+        CHECK(memcmp(out[j], s2, 32) == 0);
+    }
+    pubs[1] = pb;
+    CHECK(ecdh_shared_x4(out, ok, &b, pubs));
+    CHECK_HEX(out[2], "3e2ffbc3aa8a2836c1689e55cd169ba638b58a3a18803fcf7de153525b28c3cd", 32);
+
+    // A zero key makes every lane infinity, which the ladder then rejects
+    CHECK(!ecdh_shared_x4(out, ok, &zero, pubs));
+    for (int j = 0; j < 4; j++) CHECK(!ok[j]);
+}
+
+// --- SEC1 ---
+static void test_sec1(void) {
+    ec_point_t g, r;
+    uint8_t enc[EC_POINT_UNCOMPRESSED_SIZE], raw[EC_POINT_UNCOMPRESSED_SIZE];
+    ec_init_g(&g);
+
+    CHECK(ec_point_encode(enc, &g, 1) == EC_POINT_COMPRESSED_SIZE);
+    CHECK_HEX(enc, "0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798", EC_POINT_COMPRESSED_SIZE);
+    CHECK(ec_point_encode(enc, &g, 0) == EC_POINT_UNCOMPRESSED_SIZE);
+    CHECK_HEX(enc, g_hex, EC_POINT_UNCOMPRESSED_SIZE);
+
+    // Both parities decompress to the right y
+    for (size_t i = 1; i < NUM_MUL_VECTORS; i++) {
+        test_unhex(raw, mul_vectors[i].point);
+        CHECK(ec_point_decode(&r, raw, EC_POINT_UNCOMPRESSED_SIZE));
+        size_t len = ec_point_encode(enc, &r, 1);
+        CHECK(enc[0] == (raw[EC_POINT_UNCOMPRESSED_SIZE - 1] & 1 ? 0x03 : 0x02));
+        ec_point_t back;
+        CHECK(ec_point_decode(&back, enc, len));
+        CHECK(point_equal(&back, &r));
+    }
+
+    // Infinity is a single zero byte
+    ec_point_t inf = g;
+    inf.is_infinity = 1;
+    CHECK(ec_point_encode(enc, &inf, 1) == 1 && enc[0] == 0);
+
+    // Malformed encodings
+    test_unhex(raw, g_hex);
+    CHECK(!ec_point_decode(&r, raw, 64));                       // Wrong length
+    raw[0] = 0x05;
+    CHECK(!ec_point_decode(&r, raw, EC_POINT_UNCOMPRESSED_SIZE)); // Unknown prefix
+    test_unhex(raw, g_hex);
+    raw[64] ^= 1;
+    CHECK(!ec_point_decode(&r, raw, EC_POINT_UNCOMPRESSED_SIZE)); // Off the curve
+    memset(raw + 1, 0xff, 32);
+    raw[0] = 0x02;
+    CHECK(!ec_point_decode(&r, raw, EC_POINT_COMPRESSED_SIZE));   // x >= p
+    test_unhex(raw, "020000000000000000000000000000000000000000000000000000000000000005");
+    CHECK(!ec_point_decode(&r, raw, EC_POINT_COMPRESSED_SIZE));   // x^3 + 7 = 132 is not a square mod p
+
+    // Batch decoding marks the bad entry and still decodes the rest
+    uint8_t many[3 * EC_POINT_COMPRESSED_SIZE];
+    ec_point_t out[3];
+    ec_point_encode(many, &g, 1);
+    memcpy(many + EC_POINT_COMPRESSED_SIZE, raw, EC_POINT_COMPRESSED_SIZE);
+    ec_point_encode(many + 2 * EC_POINT_COMPRESSED_SIZE, &g, 1);
+    CHECK(!ec_point_decode_batch(out, many, EC_POINT_COMPRESSED_SIZE, 3));
+    CHECK(point_equal(&out[0], &g) && out[1].is_infinity && point_equal(&out[2], &g));
+}
+
+int main(void) {
+    test_mul_g();
+    test_mul_consistency();
+    test_prepared_cache();
+    test_multi_mul();
+    test_ecdh();
+    test_sec1();
+    return test_report("test_ec");
+}
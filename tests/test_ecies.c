@@ -0,0 +1,318 @@
+#include <stdlib.h>
+#include "test.h"
+#include "ecies.h"
+
+// Encrypt a whole message, handing it to update in pieces of `piece` bytes
+static uint8_t *encrypt_all(const ec_point_t *pub, const uint8_t *plain, size_t len, size_t chunk, size_t piece, size_t *cipher_len) {
+    ecies_stream_t s;
+    uint8_t header[ECIES_HEADER_SIZE];
+    if (!ecies_encrypt_init(&s, pub, chunk, header)) return NULL;
+
+    size_t cap = (size_t)ecies_ciphertext_size(len, s.chunk_size);
+    uint8_t *out = malloc(cap), *p = out;
+    memcpy(p, header, sizeof(header));
+    p += sizeof(header);
+    int ok = 1;
+    for (size_t off = 0; ok && off < len; off += piece) {
+        size_t n;
+        ok = ecies_encrypt_update(&s, plain + off, len - off < piece ? len - off : piece, p, &n);
+        p += n;
+    }
+    if (ok) {
+        size_t n;
+        ok = ecies_encrypt_final(&s, p, &n);
+        p += n;
+    }
+    ecies_stream_free(&s);
+    if (!ok) {
+        free(out);
+        return NULL;
+    }
+
+    *cipher_len = (size_t)(p - out);
+    return out;
+}
+
+// Decrypt a whole stream the same way; returns 0 if any step fails
+static int decrypt_all(const bigint256_t *priv, const uint8_t *cipher, size_t cipher_len, size_t piece, uint8_t *out, size_t *plain_len) {
+    ecies_stream_t s;
+    *plain_len = 0;
+    if (cipher_len < ECIES_HEADER_SIZE || !ecies_decrypt_init(&s, priv, cipher)) return 0;
+
+    uint8_t *tmp = malloc(ecies_update_bound(&s, piece) + s.chunk_size);
+    int ok = tmp != NULL;
+    for (size_t off = ECIES_HEADER_SIZE; ok && off < cipher_len; off += piece) {
+        size_t n;
+        ok = ecies_decrypt_update(&s, cipher + off, cipher_len - off < piece ? cipher_len - off : piece, tmp, &n);
+        memcpy(out + *plain_len, tmp, n);
+        *plain_len += n;
+    }
+    if (ok) {
+        size_t n;
+        ok = ecies_decrypt_final(&s, tmp, &n);
+        memcpy(out + *plain_len, tmp, n);
+        *plain_len += n;
+    }
+    free(tmp);
+    ecies_stream_free(&s);
+    return ok;
+}
+
+static bigint256_t priv, other_priv;
+static ec_point_t pub;
+
+// --- ROUND TRIPS ---
+static void test_round_trip(void) {
+    static const size_t chunks[] = { 16, 100, 4096 };
+    static const size_t lens[] = { 0, 1, 15, 16, 17, 99, 100, 101, 4096, 10000 };
+    static const size_t pieces[] = { 1, 7, 4096, 1 << 20 };
+    uint8_t *plain = malloc(10000), *back = malloc(10000);
+    for (size_t i = 0; i < 10000; i++) plain[i] = (uint8_t)(i * 7 + 3);
+
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+        for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+            size_t len = lens[l], cipher_len, plain_len;
+            uint8_t *cipher = encrypt_all(&pub, plain, len, chunks[c], 13, &cipher_len);
+            CHECK(cipher != NULL);
+            if (!cipher) continue;
+            CHECK(cipher_len == ecies_ciphertext_size(len, chunks[c]));
+            uint64_t sized;
+            CHECK(ecies_plaintext_size(&sized, cipher_len, chunks[c]) && sized == len);
+
+            for (size_t p = 0; p < sizeof(pieces) / sizeof(pieces[0]); p++) {
+                // Byte-at-a-time decryption of the long messages adds nothing
+                if (pieces[p] == 1 && len > 200) continue;
+                CHECK(decrypt_all(&priv, cipher, cipher_len, pieces[p], back, &plain_len));
+                CHECK(plain_len == len && memcmp(back, plain, len) == 0);
+            }
+            CHECK(!decrypt_all(&other_priv, cipher, cipher_len, 4096, back, &plain_len));
+            free(cipher);
+        }
+    }
+    free(plain);
+    free(back);
+}
+
+// --- TAMPERING AND TRUNCATION ---
+static void test_tamper(void) {
+    enum { LEN = 250, CHUNK = 64 };
+    uint8_t plain[LEN], back[LEN + CHUNK];
+    size_t cipher_len, plain_len;
+    for (size_t i = 0; i < LEN; i++) plain[i] = (uint8_t)i;
+    uint8_t *cipher = encrypt_all(&pub, plain, LEN, CHUNK, LEN, &cipher_len);
+    uint8_t *bad = malloc(cipher_len + CHUNK + ECIES_TAG_SIZE);
+
+    // Any flipped bit fails: magic, chunk size, R, ciphertext and tags
+    for (size_t i = 0; i < cipher_len; i++) {
+        memcpy(bad, cipher, cipher_len);
+        bad[i] ^= 0x10;
+        CHECK(!decrypt_all(&priv, bad, cipher_len, 1000, back, &plain_len));
+    }
+
+    // Every shorter stream fails, including ones that end on a record boundary
+    for (size_t len = 0; len < cipher_len; len++)
+        CHECK(!decrypt_all(&priv, cipher, len, 1000, back, &plain_len));
+
+    // Trailing bytes, or a whole extra record, fail
+    memcpy(bad, cipher, cipher_len);
+    memset(bad + cipher_len, 0, CHUNK + ECIES_TAG_SIZE);
+    CHECK(!decrypt_all(&priv, bad, cipher_len + 1, 1000, back, &plain_len));
+    CHECK(!decrypt_all(&priv, bad, cipher_len + CHUNK + ECIES_TAG_SIZE, 1000, back, &plain_len));
+
+    // Swapping the first two records fails
+    size_t rec = CHUNK + ECIES_TAG_SIZE;
+    memcpy(bad, cipher, cipher_len);
+    memcpy(bad + ECIES_HEADER_SIZE, cipher + ECIES_HEADER_SIZE + rec, rec);
+    memcpy(bad + ECIES_HEADER_SIZE + rec, cipher + ECIES_HEADER_SIZE, rec);
+    CHECK(!decrypt_all(&priv, bad, cipher_len, 1000, back, &plain_len));
+
+    CHECK(decrypt_all(&priv, cipher, cipher_len, 1000, back, &plain_len));
+    CHECK(plain_len == LEN && memcmp(back, plain, LEN) == 0);
+    free(bad);
+    free(cipher);
+}
+
+// The encrypt side reports a failed stream, keeping what it sealed before the failure
+static void test_encrypt_failure(void) {
+    enum { CHUNK = 64 };
+    uint8_t plain[3 * CHUNK + 1] = {0}, header[ECIES_HEADER_SIZE];
+    uint8_t out[4 * (CHUNK + ECIES_TAG_SIZE)];
+    size_t n;
+    ecies_stream_t s;
+
+    // Two records left on the counter: one full record goes out, the next fails
+    CHECK(ecies_encrypt_init(&s, &pub, CHUNK, header));
+    s.chunk_index = UINT32_MAX - 1;
+    CHECK(!ecies_encrypt_update(&s, plain, sizeof(plain), out, &n));
+    CHECK(n == CHUNK + ECIES_TAG_SIZE);
+    CHECK(!ecies_encrypt_update(&s, plain, 1, out, &n) && n == 0);
+    CHECK(!ecies_encrypt_final(&s, out, &n) && n == 0);
+    ecies_stream_free(&s);
+
+    // Nothing may follow final
+    CHECK(ecies_encrypt_init(&s, &pub, CHUNK, header));
+    CHECK(ecies_encrypt_update(&s, plain, CHUNK, out, &n) && n == 0);
+    CHECK(ecies_encrypt_final(&s, out, &n) && n == CHUNK + ECIES_TAG_SIZE);
+    CHECK(!ecies_encrypt_update(&s, plain, 1, out, &n) && n == 0);
+    CHECK(!ecies_encrypt_final(&s, out, &n) && n == 0);
+    ecies_stream_free(&s);
+}
+
+// A prepared recipient produces streams the ordinary decrypt path opens
+static void test_prepared_recipient(void) {
+    enum { LEN = 300, CHUNK = 64 };
+    uint8_t plain[LEN], back[LEN + CHUNK];
+    uint8_t cipher[ECIES_HEADER_SIZE + LEN + 5 * ECIES_TAG_SIZE];
+    for (size_t i = 0; i < LEN; i++) plain[i] = (uint8_t)(i * 3);
+
+    ec_prepared_cache_t *cache = ec_prepared_cache_new(1);
+    CHECK(cache != NULL);
+    if (!cache) return;
+    for (int round = 0; round < 3; round++) {
+        const ec_prepared_t *prep = ec_prepared_cache_get(cache, &pub);
+        CHECK(prep != NULL);
+        if (!prep) break;
+
+        ecies_stream_t s;
+        size_t a, b, plain_len;
+        CHECK(ecies_encrypt_init_prepared(&s, prep, CHUNK, cipher));
+        CHECK(ecies_encrypt_update(&s, plain, LEN, cipher + ECIES_HEADER_SIZE, &a));
+        CHECK(ecies_encrypt_final(&s, cipher + ECIES_HEADER_SIZE + a, &b));
+        ecies_stream_free(&s);
+        size_t cipher_len = ECIES_HEADER_SIZE + a + b;
+        CHECK(cipher_len == ecies_ciphertext_size(LEN, CHUNK));
+
+        CHECK(decrypt_all(&priv, cipher, cipher_len, 1000, back, &plain_len));
+        CHECK(plain_len == LEN && memcmp(back, plain, LEN) == 0);
+        CHECK(!decrypt_all(&other_priv, cipher, cipher_len, 1000, back, &plain_len));
+    }
+    ec_prepared_cache_free(cache);
+}
+
+// --- BATCH ---
+// Good and corrupt messages mixed, over counts that leave partial groups
+static void test_batch(void) {
+    enum { N = 2 * ECIES_BATCH_GROUP + 5 };
+    ecies_msg_t msgs[N];
+    ecies_out_t out[N];
+    uint8_t *cipher[N];
+    uint8_t plain[300];
+    for (size_t i = 0; i < sizeof(plain); i++) plain[i] = (uint8_t)(i * 11);
+
+    for (size_t i = 0; i < N; i++) {
+        size_t len = (i * 37) % sizeof(plain), cipher_len;
+        cipher[i] = encrypt_all(&pub, plain, len, 64, len + 1, &cipher_len);
+        if (i % 5 == 3) cipher[i][cipher_len - 1] ^= 1;       // Bad tag
+        if (i % 7 == 6) cipher[i][ECIES_HEADER_SIZE - 1] ^= 1; // Bad R
+        msgs[i].data = cipher[i];
+        msgs[i].len = cipher_len;
+        out[i].data = malloc(cipher_len);
+    }
+
+    threadpool_t *pool = threadpool_new(3);
+    for (int use_pool = 0; use_pool < 2; use_pool++) {
+        for (size_t n = 0; n <= N; n += 6) {
+            size_t want = 0;
+            for (size_t i = 0; i < n; i++) want += i % 5 != 3 && i % 7 != 6;
+            CHECK(ecies_decrypt_batch(&priv, msgs, n, out, use_pool ? pool : NULL) == want);
+            for (size_t i = 0; i < n; i++) {
+                int good = i % 5 != 3 && i % 7 != 6;
+                size_t len = (i * 37) % sizeof(plain);
+                CHECK(out[i].ok == good);
+                if (good) CHECK(out[i].len == len && memcmp(out[i].data, plain, len) == 0);
+                else CHECK(out[i].len == 0);
+            }
+        }
+    }
+    threadpool_free(pool);
+    for (size_t i = 0; i < N; i++) {
+        free(cipher[i]);
+        free(out[i].data);
+    }
+}
+
+// --- SERVICE ---
+typedef struct {
+    const uint8_t *data;
+    int ok, calls;
+    size_t len;
+} service_result_t;
+
+static void service_done(void *user, const ecies_out_t *out) {
+    service_result_t *r = user;
+    r->data = out->data;
+    r->ok = out->ok;
+    r->len = out->len;
+    __atomic_fetch_add(&r->calls, 1, __ATOMIC_RELAXED);
+}
+
+// More messages than the queue holds, through pools of 0, 1 and 4 workers
+static void test_service(void) {
+    enum { N = 3 * ECIES_BATCH_GROUP + 5, QUEUE = 4 };
+    uint8_t *cipher[N], *out[N];
+    size_t cipher_len[N];
+    service_result_t res[N];
+    uint8_t plain[300];
+    for (size_t i = 0; i < sizeof(plain); i++) plain[i] = (uint8_t)(i * 5 + 1);
+
+    for (size_t i = 0; i < N; i++) {
+        size_t len = (i * 41) % sizeof(plain);
+        cipher[i] = encrypt_all(&pub, plain, len, 64, len + 1, &cipher_len[i]);
+        if (i % 5 == 3) cipher[i][cipher_len[i] - 1] ^= 1;       // Bad tag
+        if (i % 7 == 6) cipher[i][ECIES_HEADER_SIZE - 1] ^= 1;   // Bad R
+        out[i] = malloc(cipher_len[i]);
+    }
+
+    static const size_t threads[] = { 1, 2, 5 };
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        threadpool_t *pool = threadpool_new(threads[t]);
+        ecies_service_t *svc = ecies_service_new(&priv, pool, QUEUE);
+        CHECK(svc != NULL);
+        if (!svc) {
+            threadpool_free(pool);
+            continue;
+        }
+        memset(res, 0, sizeof(res));
+        for (size_t i = 0; i < N; i++) {
+            memset(out[i], 0xee, cipher_len[i]);
+            CHECK(ecies_service_submit(svc, cipher[i], cipher_len[i], out[i], service_done, &res[i]));
+        }
+        ecies_service_wait(svc);
+
+        for (size_t i = 0; i < N; i++) {
+            int good = i % 5 != 3 && i % 7 != 6;
+            size_t len = (i * 41) % sizeof(plain);
+            CHECK(__atomic_load_n(&res[i].calls, __ATOMIC_RELAXED) == 1);
+            CHECK(res[i].data == out[i] && res[i].ok == good);
+            if (good) CHECK(res[i].len == len && memcmp(out[i], plain, len) == 0);
+            else CHECK(res[i].len == 0);
+        }
+
+        // A second round on the same service after it went idle
+        memset(res, 0, sizeof(res));
+        for (size_t i = 0; i < N; i += 3)
+            CHECK(ecies_service_submit(svc, cipher[i], cipher_len[i], out[i], service_done, &res[i]));
+        ecies_service_free(svc);
+        for (size_t i = 0; i < N; i++) CHECK(res[i].calls == (i % 3 == 0));
+        threadpool_free(pool);
+    }
+
+    for (size_t i = 0; i < N; i++) {
+        free(cipher[i]);
+        free(out[i]);
+    }
+}
+
+int main(void) {
+    ec_point_t other_pub;
+    CHECK(ecies_keygen(&priv, &pub));
+    CHECK(ecies_keygen(&other_priv, &other_pub));
+
+    test_round_trip();
+    test_tamper();
+    test_encrypt_failure();
+    test_prepared_recipient();
+    test_batch();
+    test_service();
+    return test_report("test_ecies");
+}
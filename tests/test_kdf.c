@@ -0,0 +1,135 @@
+#include "test.h"
+#include "kdf.h"
+
+// --- HMAC-SHA256 (RFC 4231 test cases 1, 2 and 6) ---
+static void test_hmac(void) {
+    static const struct { const char *key, *data, *mac; } v[] = {
+        { "0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b", "4869205468657265",
+          "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7" },
+        { "4a656665", "7768617420646f2079612077616e7420666f72206e6f7468696e673f",
+          "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843" },
+        { NULL, "54657374205573696e67204c6172676572205468616e20426c6f636b2d53697a65204b6579202d2048617368204b6579204669727374",
+          "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" },
+    };
+    for (size_t i = 0; i < sizeof(v) / sizeof(v[0]); i++) {
+        uint8_t key[131], data[128], mac[32];
+        size_t key_len = sizeof(key);
+        if (v[i].key) key_len = test_unhex(key, v[i].key);
+        else memset(key, 0xaa, sizeof(key));   // Case 6: longer than a block, hashed first
+        size_t data_len = test_unhex(data, v[i].data);
+
+        hmac_sha256_key_t k;
+        hmac_sha256_key_init(&k, key, key_len);
+        hmac_sha256(mac, &k, data, data_len);
+        CHECK_HEX(mac, v[i].mac, 32);
+
+        // Streaming in two pieces gives the same MAC
+        hmac_sha256_ctx_t ctx;
+        hmac_sha256_init(&ctx, &k);
+        hmac_sha256_update(&ctx, data, data_len / 2);
+        hmac_sha256_update(&ctx, data + data_len / 2, data_len - data_len / 2);
+        hmac_sha256_final(&ctx, mac);
+        CHECK_HEX(mac, v[i].mac, 32);
+    }
+}
+
+// --- HKDF-SHA256 (RFC 5869 test cases 1-3) ---
+static const struct { const char *ikm, *salt, *info, *prk, *okm; } hkdf_vectors[] = {
+    { "0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b", "000102030405060708090a0b0c", "f0f1f2f3f4f5f6f7f8f9",
+      "077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5",
+      "3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865" },
+    { "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+      "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f",
+      "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+      "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9fa0a1a2a3a4a5a6a7a8a9aaabacadaeaf",
+      "b0b1b2b3b4b5b6b7b8b9babbbcbdbebfc0c1c2c3c4c5c6c7c8c9cacbcccdcecf"
+      "d0d1d2d3d4d5d6d7d8d9dadbdcdddedfe0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+      "06a6b88c5853361a06104c9ceb35b45cef760014904671014a193f40c15fc244",
+      "b11e398dc80327a1c8e7f78c596a49344f012eda2d4efad8a050cc4c19afa97c59045a99cac7827271cb41c65e590e09"
+      "da3275600c2f09b8367793a9aca3db71cc30c58179ec3e87c14c01d5c1f3434f1d87" },
+    { "0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b", "", "",
+      "19ef24a32c717b167f33a91d6f648bdf96596776afdb6377ac434c1c293ccb04",
+      "8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d9d201395faa4b61a96c8" },
+};
+
+static void test_hkdf(void) {
+    for (size_t i = 0; i < sizeof(hkdf_vectors) / sizeof(hkdf_vectors[0]); i++) {
+        uint8_t ikm[80], salt[80], info[80], prk[32], okm[82];
+        size_t ikm_len = test_unhex(ikm, hkdf_vectors[i].ikm);
+        size_t salt_len = test_unhex(salt, hkdf_vectors[i].salt);
+        size_t info_len = test_unhex(info, hkdf_vectors[i].info);
+        size_t okm_len = strlen(hkdf_vectors[i].okm) / 2;
+
+        hmac_sha256_key_t salt_key;
+        hmac_sha256_key_init(&salt_key, salt, salt_len);
+        hkdf_sha256_extract(prk, &salt_key, ikm, ikm_len);
+        CHECK_HEX(prk, hkdf_vectors[i].prk, 32);
+        CHECK(hkdf_sha256_expand(okm, okm_len, prk, info, info_len));
+        CHECK_HEX(okm, hkdf_vectors[i].okm, okm_len);
+
+        memset(okm, 0, sizeof(okm));
+        CHECK(hkdf_sha256(okm, okm_len, salt, salt_len, ikm, ikm_len, info, info_len));
+        CHECK_HEX(okm, hkdf_vectors[i].okm, okm_len);
+    }
+
+    uint8_t prk[32] = {0}, okm[1];
+    CHECK(!hkdf_sha256_expand(okm, HKDF_SHA256_MAX_OKM + 1, prk, NULL, 0));
+}
+
+// Both batch forms against one hkdf_sha256 call per secret, over partial groups
+static void test_hkdf_batch(void) {
+    enum { MAX_N = 19, IKM_LEN = 32, OKM_LEN = 44, SALT_LEN = 33 };
+    static const uint8_t info[] = "batch info";
+    uint8_t ikm[MAX_N][IKM_LEN], salts[MAX_N][SALT_LEN], okm[MAX_N][OKM_LEN], want[OKM_LEN];
+    const uint8_t *ikm_p[MAX_N], *salt_p[MAX_N];
+    for (size_t j = 0; j < MAX_N; j++) {
+        for (size_t i = 0; i < IKM_LEN; i++) ikm[j][i] = (uint8_t)(j * 31 + i);
+        for (size_t i = 0; i < SALT_LEN; i++) salts[j][i] = (uint8_t)(j * 5 + i * 3);
+        ikm_p[j] = ikm[j];
+        salt_p[j] = salts[j];
+    }
+
+    hmac_sha256_key_t salt_key;
+    hmac_sha256_key_init(&salt_key, salts[0], SALT_LEN);
+
+    for (size_t n = 0; n <= MAX_N; n++) {
+        CHECK(hkdf_sha256_batch(okm[0], OKM_LEN, &salt_key, ikm_p, n, IKM_LEN, info, sizeof(info) - 1));
+        for (size_t j = 0; j < n; j++) {
+            hkdf_sha256(want, OKM_LEN, salts[0], SALT_LEN, ikm[j], IKM_LEN, info, sizeof(info) - 1);
+            CHECK(memcmp(okm[j], want, OKM_LEN) == 0);
+        }
+
+        CHECK(hkdf_sha256_batch_salts(okm[0], OKM_LEN, salt_p, SALT_LEN, ikm_p, n, IKM_LEN, info, sizeof(info) - 1));
+        for (size_t j = 0; j < n; j++) {
+            hkdf_sha256(want, OKM_LEN, salts[j], SALT_LEN, ikm[j], IKM_LEN, info, sizeof(info) - 1);
+            CHECK(memcmp(okm[j], want, OKM_LEN) == 0);
+        }
+    }
+}
+
+// --- ANSI X9.63 KDF (NIST CAVS SHA-256 vectors) ---
+static void test_x963(void) {
+    static const struct { const char *z, *info, *out; } v[] = {
+        { "96c05619d56c328ab95fe84b18264b08725b85e33fd34f08", "", "443024c3dae66b95e6f5670601558f71" },
+        { "22518b10e70f2a3f243810ae3254139efbee04aa57c7af7d", "75eef81aa3041e33b80971203d2c0c52",
+          "c498af77161cc59f2962b9a713e2b215152d139766ce34a776df11866a69bf2e52a13d9c7c6fc878c50c5ea0bc7b00e0"
+          "da2447cfd874f6cf92f30d0097111485500c90c3af8b487872d04685d14c8d1dc8d7fa08beb0ce0ababc11f0bd496269"
+          "142d43525a78e5bc79a17f59676a5706dc54d54d4d1f0bd7e386128ec26afc21" },
+    };
+    for (size_t i = 0; i < sizeof(v) / sizeof(v[0]); i++) {
+        uint8_t z[32], info[32], out[128];
+        size_t z_len = test_unhex(z, v[i].z);
+        size_t info_len = test_unhex(info, v[i].info);
+        size_t out_len = strlen(v[i].out) / 2;
+        x963_kdf_sha256(out, out_len, z, z_len, info, info_len);
+        CHECK_HEX(out, v[i].out, out_len);
+    }
+}
+
+int main(void) {
+    test_hmac();
+    test_hkdf();
+    test_hkdf_batch();
+    test_x963();
+    return test_report("test_kdf");
+}
@@ -0,0 +1,139 @@
+#include <stdlib.h>
+#include "test.h"
+#include "sha256.h"
+
+// --- FIPS 180-4 (examples from the NIST CSRC SHA-256 example file) ---
+static const struct { const char *msg; size_t repeat; const char *digest; } vectors[] = {
+    { "", 1, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+    { "abc", 1, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+      "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+    { "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 1,
+      "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" },
+    { "a", 1000000, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" },
+};
+
+// Hash a vector, feeding it in pieces of `step` bytes
+static void hash_vector(uint8_t out[32], sha256_impl_t impl, size_t v, size_t step) {
+    size_t len = strlen(vectors[v].msg);
+    size_t total = len * vectors[v].repeat;
+    uint8_t *msg = malloc(total + 1);
+    for (size_t r = 0; r < vectors[v].repeat; r++) memcpy(msg + r * len, vectors[v].msg, len);
+
+    sha256_ctx_t ctx;
+    sha256_init(&ctx);
+    sha256_set_impl(&ctx, impl);
+    for (size_t off = 0; off < total; off += step)
+        sha256_update(&ctx, msg + off, total - off < step ? total - off : step);
+    sha256_final(&ctx, out);
+    free(msg);
+}
+
+static void test_vectors(sha256_impl_t impl) {
+    static const size_t steps[] = { 1, 3, 63, 64, 65, 1000, (size_t)-1 };
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+        for (size_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++) {
+            // Byte-at-a-time over a million bytes adds nothing the other steps miss
+            if (vectors[v].repeat > 1 && steps[s] < 64) continue;
+            uint8_t digest[32];
+            hash_vector(digest, impl, v, steps[s]);
+            CHECK_HEX(digest, vectors[v].digest, 32);
+        }
+    }
+}
+
+// Reference digest for the multi-buffer checks: the scalar backend in one call
+static void sha256_ref(uint8_t out[32], const uint8_t *msg, size_t len) {
+    sha256_ctx_t ctx;
+    sha256_init(&ctx);
+    sha256_set_impl(&ctx, SHA256_IMPL_SCALAR);
+    sha256_update(&ctx, msg, len);
+    sha256_final(&ctx, out);
+}
+
+// --- MULTI-BUFFER ---
+// Every length around the padding boundaries, with different data in every lane
+static void test_multi_buffer(void) {
+    enum { MAX_LEN = 300, LANES = 8 };
+    uint8_t *data = malloc(LANES * MAX_LEN);
+    for (size_t i = 0; i < LANES * MAX_LEN; i++) data[i] = (uint8_t)(i * 131 + (i >> 8));
+
+    for (size_t len = 0; len <= MAX_LEN; len++) {
+        const uint8_t *in[LANES];
+        uint8_t want[LANES][32], out8[LANES][32], out4[4][32];
+        for (size_t j = 0; j < LANES; j++) {
+            in[j] = data + j * MAX_LEN;
+            sha256_ref(want[j], in[j], len);
+        }
+
+        sha256_x8(out8, in, len);
+        CHECK(memcmp(out8, want, sizeof(want)) == 0);
+        sha256_x4(out4, in, len);
+        CHECK(memcmp(out4, want, sizeof(out4)) == 0);
+    }
+
+    // "abc" in every lane
+    const uint8_t *abc[LANES];
+    uint8_t out[LANES][32];
+    for (size_t j = 0; j < LANES; j++) abc[j] = (const uint8_t *)"abc";
+    sha256_x8(out, abc, 3);
+    for (size_t j = 0; j < LANES; j++) CHECK_HEX(out[j], vectors[1].digest, 32);
+
+    free(data);
+}
+
+// sha256_batch over counts that leave partial groups, fresh and from a midstate
+static void test_batch(void) {
+    enum { MAX_N = 21, LEN = 97 };
+    uint8_t prefix[128], msgs[MAX_N][LEN], cat[128 + LEN];
+    const uint8_t *in[MAX_N];
+    for (size_t i = 0; i < sizeof(prefix); i++) prefix[i] = (uint8_t)(i ^ 0x5c);
+    for (size_t j = 0; j < MAX_N; j++) {
+        for (size_t i = 0; i < LEN; i++) msgs[j][i] = (uint8_t)(j * 7 + i);
+        in[j] = msgs[j];
+    }
+
+    sha256_ctx_t mid;
+    sha256_init(&mid);
+    sha256_update(&mid, prefix, sizeof(prefix));
+
+    for (size_t n = 0; n <= MAX_N; n++) {
+        uint8_t out[MAX_N][32], want[32];
+        sha256_batch(out, NULL, in, n, LEN);
+        for (size_t j = 0; j < n; j++) {
+            sha256_ref(want, msgs[j], LEN);
+            CHECK(memcmp(out[j], want, 32) == 0);
+        }
+
+        sha256_batch(out, &mid, in, n, LEN);
+        for (size_t j = 0; j < n; j++) {
+            memcpy(cat, prefix, sizeof(prefix));
+            memcpy(cat + sizeof(prefix), msgs[j], LEN);
+            sha256_ref(want, cat, sizeof(cat));
+            CHECK(memcmp(out[j], want, 32) == 0);
+        }
+    }
+}
+
+int main(void) {
+    static const struct { sha256_impl_t impl; const char *name; } impls[] = {
+        { SHA256_IMPL_SCALAR, "scalar" },
+        { SHA256_IMPL_SSSE3, "ssse3" },
+        { SHA256_IMPL_AVX2, "avx2" },
+        { SHA256_IMPL_SHANI, "shani" },
+        { SHA256_IMPL_AUTO, "auto" },
+    };
+
+    for (size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); i++) {
+        sha256_ctx_t probe;
+        sha256_init(&probe);
+        if (!sha256_set_impl(&probe, impls[i].impl)) {
+            printf("test_sha256: %s backend not available, skipped\n", impls[i].name);
+            continue;
+        }
+        test_vectors(impls[i].impl);
+    }
+    test_multi_buffer();
+    test_batch();
+    return test_report("test_sha256");
+}
@@ -0,0 +1,393 @@
+// ecies_tool: stream files through the chunked ECIES format in constant memory.
+//
+//   ecies_tool keygen  PRIV_FILE PUB_FILE
+//   ecies_tool encrypt [-c CHUNK_BYTES] PUB_FILE IN OUT
+//   ecies_tool decrypt PRIV_FILE IN OUT
+//
+// Keys are hex text (private scalar, compressed public point). IN / OUT may be
+// "-" for stdin / stdout. Regular files are mmap'd: ciphertext and plaintext
+// are written straight into the output mapping, so no data is copied through
+// intermediate buffers. Pipes fall back to large read / write calls.
+// A regular OUT is written under a temporary name and renamed into place only
+// once the whole stream has succeeded; OUT may not be the same file as IN.
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ecies.h"
+
+#define TOOL_IO_SIZE (4 * 1024 * 1024)    // read() size for pipes
+#define TOOL_WINDOW  (64 * 1024 * 1024)   // Mapped input handed to each update call
+
+// --- FILE HELPERS ---
+
+static int write_all(int fd, const uint8_t *p, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 1;
+}
+
+// Read up to len bytes, stopping early only at end of file
+static ssize_t read_full(int fd, uint8_t *p, size_t len) {
+    size_t got = 0;
+    while (got < len) {
+        ssize_t n = read(fd, p + got, len - got);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (n == 0) break;
+        got += (size_t)n;
+    }
+    return (ssize_t)got;
+}
+
+static int hex_decode(uint8_t *out, size_t out_len, const char *hex) {
+    for (size_t i = 0; i < out_len; i++) {
+        unsigned int v;
+        if (sscanf(hex + 2 * i, "%2x", &v) != 1) return 0;
+        out[i] = (uint8_t)v;
+    }
+    return 1;
+}
+
+static int read_text(const char *path, char *buf, size_t len) {
+    FILE *f = fopen(path, "r");
+    if (!f) return 0;
+    size_t n = fread(buf, 1, len - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+    return 1;
+}
+
+static int load_pub(ec_point_t *pub, const char *path) {
+    char text[256];
+    uint8_t raw[EC_POINT_COMPRESSED_SIZE];
+    return read_text(path, text, sizeof(text)) &&
+           hex_decode(raw, sizeof(raw), text) &&
+           ec_point_decode(pub, raw, sizeof(raw));
+}
+
+static int load_priv(bigint256_t *priv, const char *path) {
+    char text[256];
+    uint8_t raw[32];
+    if (!read_text(path, text, sizeof(text)) || !hex_decode(raw, sizeof(raw), text)) return 0;
+    bigint_set_bytes(priv, raw);
+    return 1;
+}
+
+// --- STREAMS ---
+
+typedef struct {
+    int fd;
+    const uint8_t *map;     // Whole input when it is a regular file, else NULL
+    uint64_t size;
+} tool_in_t;
+
+typedef struct {
+    int fd;
+    const char *path;       // NULL for stdout
+    char *tmp;              // Name written to and renamed to path on success, NULL if path is written directly
+    uint8_t *map;           // Whole output when it could be preallocated, else NULL
+    uint64_t size, pos;
+} tool_out_t;
+
+static int open_in(tool_in_t *in, const char *path) {
+    struct stat st;
+    in->fd = strcmp(path, "-") == 0 ? STDIN_FILENO : open(path, O_RDONLY);
+    in->map = NULL;
+    in->size = 0;
+    if (in->fd < 0 || fstat(in->fd, &st) != 0) return 0;
+
+    if (S_ISREG(st.st_mode) && st.st_size > 0) {
+        void *m = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, in->fd, 0);
+        if (m != MAP_FAILED) {
+            madvise(m, (size_t)st.st_size, MADV_SEQUENTIAL);
+            in->map = m;
+            in->size = (uint64_t)st.st_size;
+        }
+    }
+    return 1;
+}
+
+// Truncating or replacing the input while it is mapped would destroy it
+static int same_file(const tool_in_t *in, const char *out_path) {
+    struct stat in_st, out_st;
+    if (fstat(in->fd, &in_st) != 0) return 0;
+    if (strcmp(out_path, "-") == 0 ? fstat(STDOUT_FILENO, &out_st) != 0 : stat(out_path, &out_st) != 0) return 0;
+    return S_ISREG(in_st.st_mode) && in_st.st_dev == out_st.st_dev && in_st.st_ino == out_st.st_ino;
+}
+
+static int open_out(tool_out_t *out, const char *path) {
+    struct stat st;
+    out->path = strcmp(path, "-") == 0 ? NULL : path;
+    out->tmp = NULL;
+    out->map = NULL;
+    out->size = out->pos = 0;
+    if (!out->path) {
+        out->fd = STDOUT_FILENO;
+        return 1;
+    }
+
+    // Devices and pipes are written directly; files go through a temporary name
+    if (stat(path, &st) == 0 && !S_ISREG(st.st_mode)) {
+        out->fd = open(path, O_WRONLY);
+        return out->fd >= 0;
+    }
+    size_t len = strlen(path);
+    out->tmp = malloc(len + sizeof(".XXXXXX"));
+    if (!out->tmp) return 0;
+    memcpy(out->tmp, path, len);
+    memcpy(out->tmp + len, ".XXXXXX", sizeof(".XXXXXX"));
+    out->fd = mkstemp(out->tmp);
+    if (out->fd < 0) {
+        free(out->tmp);
+        out->tmp = NULL;
+    }
+    return out->fd >= 0;
+}
+
+// Preallocate and map the output when its final size is known
+static void map_out(tool_out_t *out, uint64_t size) {
+    struct stat st;
+    if (size == 0 || fstat(out->fd, &st) != 0 || !S_ISREG(st.st_mode)) return;
+    if (ftruncate(out->fd, (off_t)size) != 0) return;
+
+    void *m = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, out->fd, 0);
+    if (m == MAP_FAILED) return;
+    out->map = m;
+    out->size = size;
+}
+
+// Returns ok, cleared if the output could not be closed or moved into place
+static int close_streams(tool_in_t *in, tool_out_t *out, int ok) {
+    if (in->map) munmap((void *)in->map, (size_t)in->size);
+    if (in->fd > STDIN_FILENO) close(in->fd);
+    if (out->map) munmap(out->map, (size_t)out->size);
+    if (out->path) {
+        if (close(out->fd) != 0) ok = 0;
+    }
+    if (out->tmp) {
+        // Never leave unauthenticated or partial output behind, nor clobber OUT with it
+        if (ok && rename(out->tmp, out->path) != 0) ok = 0;
+        if (!ok) unlink(out->tmp);
+        free(out->tmp);
+    }
+    return ok;
+}
+
+// Push input through update: windows of the mapping, or read() blocks
+static int run_updates(ecies_stream_t *s, tool_in_t *in, uint64_t offset, tool_out_t *out, int decrypt) {
+    uint8_t *inbuf = NULL, *outbuf = NULL;
+    size_t chunk = in->map ? TOOL_WINDOW : TOOL_IO_SIZE;
+    int ok = 1;
+
+    if (!in->map) inbuf = malloc(chunk);
+    if (!out->map) outbuf = malloc(ecies_update_bound(s, chunk));
+    if ((!in->map && !inbuf) || (!out->map && !outbuf)) ok = 0;
+
+    while (ok) {
+        const uint8_t *src;
+        size_t len;
+        if (in->map) {
+            if (offset >= in->size) break;
+            src = in->map + offset;
+            len = in->size - offset < chunk ? (size_t)(in->size - offset) : chunk;
+        } else {
+            ssize_t n = read_full(in->fd, inbuf, chunk);
+            if (n < 0) { ok = 0; break; }
+            if (n == 0) break;
+            src = inbuf;
+            len = (size_t)n;
+        }
+
+        uint8_t *dst = out->map ? out->map + out->pos : outbuf;
+        size_t n;
+        if (decrypt) ok = ecies_decrypt_update(s, src, len, dst, &n);
+        else ok = ecies_encrypt_update(s, src, len, dst, &n);
+        if (ok && !out->map) ok = write_all(out->fd, outbuf, n);
+        out->pos += n;
+
+        // Consumed input pages are no longer needed; keep the resident set flat
+        if (in->map) madvise((void *)((uintptr_t)src & ~(uintptr_t)4095), len, MADV_DONTNEED);
+        offset += len;
+    }
+
+    free(inbuf);
+    free(outbuf);
+    return ok;
+}
+
+// The final record lands in the mapping or goes out through a small buffer
+static int finish(ecies_stream_t *s, tool_out_t *out, int decrypt) {
+    uint8_t *buf = out->map ? out->map + out->pos : malloc(s->chunk_size + ECIES_TAG_SIZE);
+    size_t n = 0;
+    int ok = buf != NULL;
+
+    if (ok) {
+        if (decrypt) ok = ecies_decrypt_final(s, buf, &n);
+        else ok = ecies_encrypt_final(s, buf, &n);
+    }
+    if (ok && !out->map) ok = write_all(out->fd, buf, n);
+    if (!out->map) free(buf);
+    out->pos += n;
+    return ok && (!out->map || out->pos == out->size);
+}
+
+// --- COMMANDS ---
+
+static int cmd_keygen(const char *priv_path, const char *pub_path) {
+    bigint256_t priv;
+    ec_point_t pub;
+    uint8_t raw[32], enc[EC_POINT_COMPRESSED_SIZE];
+    if (!ecies_keygen(&priv, &pub)) return 0;
+    bigint_get_bytes(raw, &priv);
+    ec_point_encode(enc, &pub, 1);
+
+    int fd = open(priv_path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    FILE *f = fd >= 0 ? fdopen(fd, "w") : NULL;
+    if (!f) return 0;
+    for (size_t i = 0; i < sizeof(raw); i++) fprintf(f, "%02x", raw[i]);
+    fprintf(f, "\n");
+    fclose(f);
+    memset(raw, 0, sizeof(raw));
+
+    f = fopen(pub_path, "w");
+    if (!f) return 0;
+    for (size_t i = 0; i < sizeof(enc); i++) fprintf(f, "%02x", enc[i]);
+    fprintf(f, "\n");
+    fclose(f);
+    return 1;
+}
+
+static int cmd_encrypt(const char *pub_path, const char *in_path, const char *out_path, size_t chunk_size) {
+    ec_point_t pub;
+    ecies_stream_t s;
+    tool_in_t in;
+    tool_out_t out;
+    uint8_t header[ECIES_HEADER_SIZE];
+
+    if (!load_pub(&pub, pub_path)) { fprintf(stderr, "bad public key %s\n", pub_path); return 0; }
+    if (!ecies_encrypt_init(&s, &pub, chunk_size, header)) { fprintf(stderr, "encrypt init failed\n"); return 0; }
+    if (!open_in(&in, in_path)) {
+        perror(in_path);
+        ecies_stream_free(&s);
+        return 0;
+    }
+    if (same_file(&in, out_path)) {
+        fprintf(stderr, "%s and %s are the same file\n", in_path, out_path);
+        ecies_stream_free(&s);
+        return 0;
+    }
+    if (!open_out(&out, out_path)) {
+        perror(out_path);
+        ecies_stream_free(&s);
+        return 0;
+    }
+
+    if (in.map) map_out(&out, ecies_ciphertext_size(in.size, s.chunk_size));
+    int ok;
+    if (out.map) {
+        memcpy(out.map, header, sizeof(header));
+        out.pos = sizeof(header);
+        ok = 1;
+    } else {
+        ok = write_all(out.fd, header, sizeof(header));
+        out.pos = sizeof(header);
+    }
+    ok = ok && run_updates(&s, &in, 0, &out, 0) && finish(&s, &out, 0);
+
+    ecies_stream_free(&s);
+    ok = close_streams(&in, &out, ok);
+    if (!ok) fprintf(stderr, "encryption failed\n");
+    return ok;
+}
+
+static int cmd_decrypt(const char *priv_path, const char *in_path, const char *out_path) {
+    bigint256_t priv;
+    ecies_stream_t s;
+    tool_in_t in;
+    tool_out_t out;
+    uint8_t header[ECIES_HEADER_SIZE];
+
+    if (!load_priv(&priv, priv_path)) { fprintf(stderr, "bad private key %s\n", priv_path); return 0; }
+    if (!open_in(&in, in_path)) {
+        perror(in_path);
+        return 0;
+    }
+    if (same_file(&in, out_path)) {
+        fprintf(stderr, "%s and %s are the same file\n", in_path, out_path);
+        return 0;
+    }
+    if (!open_out(&out, out_path)) {
+        perror(out_path);
+        return 0;
+    }
+
+    int ok;
+    if (in.map) {
+        ok = in.size >= sizeof(header);
+        if (ok) memcpy(header, in.map, sizeof(header));
+    } else {
+        ok = read_full(in.fd, header, sizeof(header)) == (ssize_t)sizeof(header);
+    }
+    ok = ok && ecies_decrypt_init(&s, &priv, header);
+    memset(&priv, 0, sizeof(priv));
+    if (!ok) {
+        fprintf(stderr, "not an ECIES stream for this key\n");
+        close_streams(&in, &out, 0);
+        return 0;
+    }
+
+    uint64_t plain_len;
+    if (in.map) {
+        if (!ecies_plaintext_size(&plain_len, in.size, s.chunk_size)) ok = 0;
+        else map_out(&out, plain_len);
+    }
+    ok = ok && run_updates(&s, &in, sizeof(header), &out, 1) && finish(&s, &out, 1);
+
+    ecies_stream_free(&s);
+    ok = close_streams(&in, &out, ok);
+    if (!ok) fprintf(stderr, "decryption failed: ciphertext is corrupt, truncated or not for this key\n");
+    return ok;
+}
+
+static int usage(void) {
+    fprintf(stderr,
+            "usage: ecies_tool keygen PRIV_FILE PUB_FILE\n"
+            "       ecies_tool encrypt [-c CHUNK_BYTES] PUB_FILE IN OUT\n"
+            "       ecies_tool decrypt PRIV_FILE IN OUT\n");
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) return usage();
+
+    if (strcmp(argv[1], "keygen") == 0 && argc == 4) return cmd_keygen(argv[2], argv[3]) ? 0 : 1;
+
+    if (strcmp(argv[1], "encrypt") == 0) {
+        size_t chunk = 0;
+        int a = 2;
+        if (argc >= 4 && strcmp(argv[2], "-c") == 0) {
+            chunk = strtoul(argv[3], NULL, 0);
+            a = 4;
+        }
+        if (argc - a != 3) return usage();
+        return cmd_encrypt(argv[a], argv[a + 1], argv[a + 2], chunk) ? 0 : 1;
+    }
+
+    if (strcmp(argv[1], "decrypt") == 0 && argc == 5) return cmd_decrypt(argv[2], argv[3], argv[4]) ? 0 : 1;
+
+    return usage();
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+// Generates src/ec_gen_table.c, the fixed-base table behind ec_mul_g.
+//
+//   table[i][j] = j * 16^i * G + offset_i
+//
+// The offsets are multiples of a point U with unknown discrete log (hashed
+// from a fixed string) and sum to zero over all windows. That way no table
+// entry is infinity and the running sum in ec_mul_g never hits a special
+// case, so every window costs one mixed addition and nothing else.
+//
+// Usage: gen_ec_table [output.c]   (writes to stdout by default)
+
+#include <stdio.h>
+#include <string.h>
+#include "ec.h"
+#include "sha256.h"
+
+static const char *OFFSET_SEED = "ECIES ec_mul_g offset point";
+
+static void fe_pow(fe_t *r, const fe_t *a, const bigint256_t *e) {
+    fe_t acc;
+    fe_set_int(&acc, 1);
+    for (int i = 255; i >= 0; i--) {
+        fe_sqr(&acc, &acc);
+        if ((e->limbs[i / 64] >> (i % 64)) & 1) fe_mul(&acc, &acc, a);
+    }
+    *r = acc;
+}
+
+// Hash-and-increment onto the curve: x = SHA256(seed || ctr), y = sqrt(x^3 + 7)
+static void offset_point(ec_apoint_t *u) {
+    bigint256_t sqrt_exp; // (p + 1) / 4
+    bigint_set_hex(&sqrt_exp, "3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFBFFFFF0C");
+
+    for (uint8_t ctr = 0; ; ctr++) {
+        uint8_t hash[32];
+        sha256_ctx_t sha;
+        sha256_init(&sha);
+        sha256_update(&sha, (const uint8_t *)OFFSET_SEED, strlen(OFFSET_SEED));
+        sha256_update(&sha, &ctr, 1);
+        sha256_final(&sha, hash);
+
+        bigint256_t x;
+        for (int i = 0; i < 4; i++) {
+            x.limbs[3 - i] = 0;
+            for (int j = 0; j < 8; j++) x.limbs[3 - i] = (x.limbs[3 - i] << 8) | hash[i * 8 + j];
+        }
+        if (x.limbs[3] == 0xFFFFFFFFFFFFFFFFULL) continue; // Keep x < p
+
+        fe_t fx, rhs, seven, y, y2;
+        fe_set_bigint(&fx, &x);
+        fe_sqr(&rhs, &fx);
+        fe_mul(&rhs, &rhs, &fx);
+        fe_set_int(&seven, 7);
+        fe_add(&rhs, &seven);
+        fe_normalize(&rhs);
+
+        fe_pow(&y, &rhs, &sqrt_exp);
+        fe_sqr(&y2, &y);
+        fe_normalize(&y2);
+        if (!fe_equal(&y2, &rhs)) continue;
+
+        fe_normalize(&y);
+        u->x = fx;
+        u->y = y;
+        u->is_infinity = 0;
+        return;
+    }
+}
+
+static ec_jpoint_t table[EC_GEN_WINDOWS * EC_GEN_WINDOW_SIZE];
+static ec_apoint_t table_affine[EC_GEN_WINDOWS * EC_GEN_WINDOW_SIZE];
+
+int main(int argc, char **argv) {
+    FILE *out = stdout;
+    if (argc > 1) {
+        out = fopen(argv[1], "w");
+        if (!out) { perror(argv[1]); return 1; }
+    }
+
+    ec_point_t g;
+    ec_apoint_t base, offset, u;
+    ec_jpoint_t base_j, u_j, offset_sum;
+
+    ec_init_g(&g);
+    ec_apoint_set(&base, &g);
+    offset_point(&u);
+    ec_jacobian_from_affine(&u_j, &u);
+    offset_sum.is_infinity = 1;
+
+    for (int i = 0; i < EC_GEN_WINDOWS; i++) {
+        // offset_i = 2^i * U, except the last window which cancels the others
+        if (i < EC_GEN_WINDOWS - 1) {
+            ec_jacobian_to_affine(&offset, &u_j);
+            ec_jadd_mixed(&offset_sum, &offset_sum, &offset);
+            ec_jdouble(&u_j, &u_j);
+        } else {
+            ec_jacobian_to_affine(&offset, &offset_sum);
+            fe_negate(&offset.y, &offset.y, 1);
+            fe_normalize(&offset.y);
+        }
+
+        ec_jpoint_t *row = &table[i * EC_GEN_WINDOW_SIZE];
+        ec_jacobian_from_affine(&row[0], &offset);
+        for (int j = 1; j < EC_GEN_WINDOW_SIZE; j++) ec_jadd_mixed(&row[j], &row[j - 1], &base);
+
+        // base = 16 * base
+        ec_jacobian_from_affine(&base_j, &base);
+        for (int j = 0; j < 4; j++) ec_jdouble(&base_j, &base_j);
+        ec_jacobian_to_affine(&base, &base_j);
+    }
+
+    ec_batch_to_affine(table_affine, table, EC_GEN_WINDOWS * EC_GEN_WINDOW_SIZE);
+
+    fprintf(out, "// Generated by tools/gen_ec_table.c -- do not edit.\n");
+    fprintf(out, "#include \"ec.h\"\n\n");
+    fprintf(out, "const ec_point_storage_t ec_gen_table[EC_GEN_WINDOWS][EC_GEN_WINDOW_SIZE] = {\n");
+    for (int i = 0; i < EC_GEN_WINDOWS; i++) {
+        fprintf(out, "  {\n");
+        for (int j = 0; j < EC_GEN_WINDOW_SIZE; j++) {
+            const ec_apoint_t *e = &table_affine[i * EC_GEN_WINDOW_SIZE + j];
+            if (e->is_infinity) { fprintf(stderr, "table entry %d/%d is infinity\n", i, j); return 1; }
+            bigint256_t x, y;
+            fe_get_bigint(&x, &e->x);
+            fe_get_bigint(&y, &e->y);
+            fprintf(out, "    {{{0x%016lxULL, 0x%016lxULL, 0x%016lxULL, 0x%016lxULL}},\n",
+                    x.limbs[0], x.limbs[1], x.limbs[2], x.limbs[3]);
+            fprintf(out, "     {{0x%016lxULL, 0x%016lxULL, 0x%016lxULL, 0x%016lxULL}}}%s\n",
+                    y.limbs[0], y.limbs[1], y.limbs[2], y.limbs[3], j + 1 < EC_GEN_WINDOW_SIZE ? "," : "");
+        }
+        fprintf(out, "  }%s\n", i + 1 < EC_GEN_WINDOWS ? "," : "");
+    }
+    fprintf(out, "};\n");
+
+    if (out != stdout) fclose(out);
+    return 0;
+}
\ No newline at end of file